@@ -80,6 +80,9 @@ class MACManager : public std::list<protobuf::ModemTransmission>
 
     bool running() { return started_up_; }
 
+    /// \brief Start of the next slot (when do_work() will next begin a slot)
+    time::SystemClock::time_point next_slot_time() const { return next_slot_t_; }
+
     //@}
 
     /// \name Modem Signals
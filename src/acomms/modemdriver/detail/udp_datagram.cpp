@@ -0,0 +1,255 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "udp_datagram.h"
+
+#include <cerrno> // for errno, EAGAIN
+
+#include <boost/asio/buffer.hpp>                           // for buffer
+#include <boost/asio/error.hpp>                            // for would_block
+#include <google/protobuf/io/coded_stream.h>               // for CodedInputStream, Code...
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h> // for StringOutputStream
+
+#include "goby/acomms/protobuf/modem_message.pb.h" // for ModemTransmission
+
+namespace
+{
+// first byte of a packed datagram: field number zero is never a valid Protobuf tag so this cannot be confused with a plain ModemTransmission
+constexpr char packed_marker{0};
+} // namespace
+
+void goby::acomms::detail::UDPTransmissionPacker::add(const protobuf::ModemTransmission& msg)
+{
+    std::string bytes;
+    msg.SerializeToString(&bytes);
+
+    std::size_t framed_size =
+        google::protobuf::io::CodedOutputStream::VarintSize32(bytes.size()) + bytes.size();
+
+    if (!pending_.empty() && pending_bytes_ + framed_size > max_datagram_size_)
+        close_datagram();
+
+    pending_.push_back(std::move(bytes));
+    pending_bytes_ += framed_size;
+}
+
+void goby::acomms::detail::UDPTransmissionPacker::flush(std::vector<std::string>* datagrams)
+{
+    close_datagram();
+    for (auto& datagram : datagrams_) datagrams->push_back(std::move(datagram));
+    datagrams_.clear();
+}
+
+void goby::acomms::detail::UDPTransmissionPacker::close_datagram()
+{
+    if (pending_.empty())
+        return;
+
+    if (pending_.size() == 1)
+    {
+        // send as a plain ModemTransmission so that receivers without packing support can still read it
+        datagrams_.push_back(std::move(pending_.front()));
+    }
+    else
+    {
+        std::string datagram;
+        datagram.reserve(pending_bytes_);
+        {
+            google::protobuf::io::StringOutputStream zero_copy_output(&datagram);
+            google::protobuf::io::CodedOutputStream coded_output(&zero_copy_output);
+            coded_output.WriteRaw(&packed_marker, 1);
+            for (const auto& bytes : pending_)
+            {
+                coded_output.WriteVarint32(bytes.size());
+                coded_output.WriteString(bytes);
+            }
+        }
+        datagrams_.push_back(std::move(datagram));
+    }
+
+    pending_.clear();
+    pending_bytes_ = 1;
+}
+
+bool goby::acomms::detail::unpack_udp_datagram(const char* data, std::size_t size,
+                                               std::vector<protobuf::ModemTransmission>* msgs)
+{
+    if (size == 0 || data[0] != packed_marker)
+    {
+        protobuf::ModemTransmission msg;
+        bool parsed = msg.ParseFromArray(data, size);
+        msgs->push_back(msg);
+        return parsed;
+    }
+
+    google::protobuf::io::CodedInputStream coded_input(
+        reinterpret_cast<const google::protobuf::uint8*>(data + 1), size - 1);
+    while (!coded_input.ExpectAtEnd())
+    {
+        google::protobuf::uint32 length;
+        if (!coded_input.ReadVarint32(&length))
+            return false;
+
+        auto limit = coded_input.PushLimit(length);
+        protobuf::ModemTransmission msg;
+        if (!msg.ParseFromCodedStream(&coded_input) || !coded_input.ConsumedEntireMessage())
+            return false;
+        coded_input.PopLimit(limit);
+        msgs->push_back(msg);
+    }
+    return true;
+}
+
+std::size_t goby::acomms::detail::send_udp_datagrams(boost::asio::ip::udp::socket& socket,
+                                                     const std::vector<UDPDatagram>& datagrams,
+                                                     boost::system::error_code& ec)
+{
+    ec.clear();
+    std::size_t sent = 0, bytes_sent = 0;
+
+#ifdef __linux__
+    std::vector<iovec> iovecs(datagrams.size());
+    std::vector<mmsghdr> headers(datagrams.size());
+    for (std::size_t i = 0, n = datagrams.size(); i < n; ++i)
+    {
+        const auto& datagram = datagrams[i];
+        iovecs[i].iov_base = const_cast<char*>(datagram.bytes.data());
+        iovecs[i].iov_len = datagram.bytes.size();
+        headers[i] = mmsghdr();
+        headers[i].msg_hdr.msg_name = const_cast<void*>(
+            static_cast<const void*>(datagram.destination.data()));
+        headers[i].msg_hdr.msg_namelen = datagram.destination.size();
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (sent < datagrams.size())
+    {
+        int result = ::sendmmsg(socket.native_handle(), &headers[sent], datagrams.size() - sent,
+                                MSG_DONTWAIT);
+        // would block or failed: fall through to individual sends, which block as needed and report any error
+        if (result <= 0)
+            break;
+
+        for (int i = 0; i < result; ++i) bytes_sent += headers[sent + i].msg_len;
+        sent += result;
+    }
+#endif
+
+    for (; sent < datagrams.size(); ++sent)
+    {
+        const auto& datagram = datagrams[sent];
+        bytes_sent += socket.send_to(boost::asio::buffer(datagram.bytes), datagram.destination,
+                                     0, ec);
+        if (ec)
+            break;
+    }
+
+    return bytes_sent;
+}
+
+goby::acomms::detail::UDPDatagramReceiver::UDPDatagramReceiver(std::size_t batch_size)
+    : batch_size_(batch_size > 0 ? batch_size : 1),
+      buffer_(batch_size_ * UDP_MAX_PACKET_SIZE),
+      senders_(batch_size_)
+#ifdef __linux__
+      ,
+      iovecs_(batch_size_),
+      headers_(batch_size_)
+#endif
+{
+}
+
+std::size_t goby::acomms::detail::UDPDatagramReceiver::drain(boost::asio::ip::udp::socket& socket,
+                                                             const Handler& handler,
+                                                             boost::system::error_code& ec)
+{
+    ec.clear();
+    std::size_t received = 0;
+
+    for (int batch = 0; batch < MAX_BATCHES_PER_DRAIN; ++batch)
+    {
+#ifdef __linux__
+        for (std::size_t i = 0; i < batch_size_; ++i)
+        {
+            iovecs_[i].iov_base = &buffer_[i * UDP_MAX_PACKET_SIZE];
+            iovecs_[i].iov_len = UDP_MAX_PACKET_SIZE;
+            headers_[i] = mmsghdr();
+            headers_[i].msg_hdr.msg_name = senders_[i].data();
+            headers_[i].msg_hdr.msg_namelen = senders_[i].capacity();
+            headers_[i].msg_hdr.msg_iov = &iovecs_[i];
+            headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int result =
+            ::recvmmsg(socket.native_handle(), headers_.data(), batch_size_, MSG_DONTWAIT, nullptr);
+        if (result < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                ec.assign(errno, boost::system::system_category());
+            return received;
+        }
+
+        for (int i = 0; i < result; ++i)
+        {
+            senders_[i].resize(headers_[i].msg_hdr.msg_namelen);
+            handler(&buffer_[i * UDP_MAX_PACKET_SIZE], headers_[i].msg_len, senders_[i]);
+        }
+        received += result;
+
+        if (static_cast<std::size_t>(result) < batch_size_)
+            return received;
+#else
+        bool was_non_blocking = socket.non_blocking();
+        socket.non_blocking(true, ec);
+        if (ec)
+            return received;
+
+        std::size_t i = 0;
+        for (; i < batch_size_; ++i)
+        {
+            std::size_t size = socket.receive_from(
+                boost::asio::buffer(&buffer_[0], UDP_MAX_PACKET_SIZE), senders_[0], 0, ec);
+            if (ec)
+                break;
+            handler(&buffer_[0], size, senders_[0]);
+            ++received;
+        }
+
+        boost::system::error_code ignored_ec;
+        socket.non_blocking(was_non_blocking, ignored_ec);
+
+        if (ec == boost::asio::error::would_block)
+        {
+            ec.clear();
+            return received;
+        }
+        else if (ec)
+        {
+            return received;
+        }
+#endif
+    }
+    return received;
+}
@@ -0,0 +1,155 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef GOBY_ACOMMS_MODEMDRIVER_DETAIL_UDP_DATAGRAM_H
+#define GOBY_ACOMMS_MODEMDRIVER_DETAIL_UDP_DATAGRAM_H
+
+#include <cstddef>    // for size_t
+#include <functional> // for function
+#include <string>     // for string
+#include <vector>     // for vector
+
+#include <boost/asio/ip/udp.hpp>       // for udp::socket, udp::endpoint
+#include <boost/system/error_code.hpp> // for error_code
+#include <boost/version.hpp>           // for BOOST_VERSION
+
+#if BOOST_VERSION < 106600
+#include <boost/asio/buffer.hpp> // for null_buffers
+#endif
+
+#ifdef __linux__
+#include <sys/socket.h> // for mmsghdr
+#endif
+
+namespace goby
+{
+namespace acomms
+{
+namespace protobuf
+{
+class ModemTransmission;
+} // namespace protobuf
+
+namespace detail
+{
+/// \brief Packs serialized ModemTransmissions into as few datagrams as possible, each no larger than a given size.
+///
+/// A datagram holding a single transmission is the plain serialized ModemTransmission (identical to what UDPDriver sends without packing). A datagram holding several transmissions starts with a zero byte (never a valid Protobuf tag) followed by each transmission prefixed with its varint encoded length.
+class UDPTransmissionPacker
+{
+  public:
+    explicit UDPTransmissionPacker(std::size_t max_datagram_size)
+        : max_datagram_size_(max_datagram_size)
+    {
+    }
+
+    /// \brief Add a transmission, closing out the current datagram first if this transmission would not fit
+    void add(const protobuf::ModemTransmission& msg);
+
+    /// \brief Move all pending datagrams (including the partially filled one) into datagrams
+    void flush(std::vector<std::string>* datagrams);
+
+    bool empty() const { return pending_.empty() && datagrams_.empty(); }
+
+  private:
+    void close_datagram();
+
+  private:
+    std::size_t max_datagram_size_;
+    // serialized transmissions for the datagram currently being filled
+    std::vector<std::string> pending_;
+    std::size_t pending_bytes_{1};
+    std::vector<std::string> datagrams_;
+};
+
+/// \brief Parse a received datagram (either plain or packed by UDPTransmissionPacker) into one or more transmissions
+///
+/// \return false if the datagram could not be parsed (msgs contains any transmissions parsed before the error)
+bool unpack_udp_datagram(const char* data, std::size_t size,
+                         std::vector<protobuf::ModemTransmission>* msgs);
+
+struct UDPDatagram
+{
+    boost::asio::ip::udp::endpoint destination;
+    std::string bytes;
+};
+
+/// \brief Send a set of datagrams, using a single sendmmsg() call on Linux where possible
+///
+/// Any datagrams not accepted by the kernel without blocking are sent individually using a blocking send
+/// \return number of bytes sent
+std::size_t send_udp_datagrams(boost::asio::ip::udp::socket& socket,
+                               const std::vector<UDPDatagram>& datagrams,
+                               boost::system::error_code& ec);
+
+/// \brief Calls handler once the socket has data available to read, without consuming any of it
+template <typename Handler>
+void async_wait_readable(boost::asio::ip::udp::socket& socket, Handler handler)
+{
+#if BOOST_VERSION >= 106600
+    socket.async_wait(boost::asio::ip::udp::socket::wait_read,
+                      [handler](const boost::system::error_code& ec) mutable { handler(ec); });
+#else
+    socket.async_receive(
+        boost::asio::null_buffers(),
+        [handler](const boost::system::error_code& ec, std::size_t) mutable { handler(ec); });
+#endif
+}
+
+/// \brief Drains all the datagrams currently queued on a UDP socket, reading up to batch_size datagrams per system call (recvmmsg() on Linux)
+class UDPDatagramReceiver
+{
+  public:
+    using Handler = std::function<void(const char* data, std::size_t size,
+                                       const boost::asio::ip::udp::endpoint& sender)>;
+
+    /// \param batch_size Maximum number of datagrams read per system call
+    explicit UDPDatagramReceiver(std::size_t batch_size);
+
+    /// \brief Read until the socket would block, calling handler for each datagram
+    ///
+    /// At most MAX_BATCHES_PER_DRAIN system calls are made so that a continuous stream cannot starve the rest of the driver; any remaining datagrams will be reported readable again immediately.
+    /// \return number of datagrams read
+    std::size_t drain(boost::asio::ip::udp::socket& socket, const Handler& handler,
+                      boost::system::error_code& ec);
+
+  private:
+    // (16 bit length = 65535 - 8 byte UDP header - 20 byte IP
+    static constexpr std::size_t UDP_MAX_PACKET_SIZE = 65507;
+    static constexpr int MAX_BATCHES_PER_DRAIN = 16;
+
+    std::size_t batch_size_;
+    std::vector<char> buffer_;
+    std::vector<boost::asio::ip::udp::endpoint> senders_;
+#ifdef __linux__
+    std::vector<iovec> iovecs_;
+    std::vector<mmsghdr> headers_;
+#endif
+};
+
+} // namespace detail
+} // namespace acomms
+} // namespace goby
+
+#endif
@@ -23,7 +23,8 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
-#include <boost/bind/bind.hpp>                                   // for bind_t, arg
+#include <algorithm>                                        // for max, min
+#include <boost/bind/bind.hpp>                              // for bind_t, arg
 #include <boost/date_time/posix_time/posix_time_config.hpp> // for posix_time
 #include <boost/date_time/posix_time/posix_time_types.hpp>  // for second_c...
 #include <boost/date_time/posix_time/time_formatters.hpp>   // for to_iso_s...
@@ -31,6 +32,7 @@
 #include <boost/lexical_cast/bad_lexical_cast.hpp>          // for bad_lexi...
 #include <fstream>                                          // for basic_os...
 #include <list>                                             // for operator!=
+#include <thread>                                           // for thread
 #include <unistd.h>                                         // for usleep
 
 #include "driver_base.h"
@@ -38,6 +40,7 @@
 #include "goby/acomms/connect.h"                         // for connect
 #include "goby/acomms/protobuf/modem_driver_status.pb.h" // for ModemDri...
 #include "goby/acomms/protobuf/modem_message.pb.h"       // for ModemRaw
+#include "goby/time/simulation.h"                        // for SimulatorSettings
 #include "goby/util/as.h"                                // for as
 #include "goby/util/debug_logger/flex_ostream.h"         // for FlexOstream
 #include "goby/util/debug_logger/flex_ostreambuf.h"      // for DEBUG1
@@ -53,6 +56,53 @@ using namespace goby::util::logger_lock;
 
 std::atomic<int> goby::acomms::ModemDriverBase::count_(0);
 
+namespace
+{
+// convert (possibly warped) SystemClock duration to wall time for asio timers
+std::chrono::steady_clock::duration real_duration(goby::time::SystemClock::duration d)
+{
+    if (goby::time::SimulatorSettings::using_sim_time)
+        d /= goby::time::SimulatorSettings::warp_factor;
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(d);
+}
+} // namespace
+
+// thread to handle synchronization between boost::asio and goby condition_variable signaling
+struct goby::acomms::ModemDriverBase::EventSource
+{
+    EventSource(boost::asio::io_context& io, std::shared_ptr<std::timed_mutex> poll_mutex,
+                std::shared_ptr<std::condition_variable_any> cv)
+        : poll_mutex(std::move(poll_mutex)), cv(std::move(cv))
+    {
+        notify_thread = std::thread([this, &io]() {
+            // held except while waiting, so notifications (sent under this lock) are never lost
+            std::unique_lock<std::timed_mutex> lock(*this->poll_mutex);
+            while (alive)
+            {
+                this->cv->wait(lock);
+                // post empty handler to cause run_events() to return
+                if (alive)
+                    io.post([]() {});
+            }
+        });
+    }
+
+    ~EventSource()
+    {
+        {
+            std::lock_guard<std::timed_mutex> lock(*poll_mutex);
+            alive = false;
+        }
+        cv->notify_all();
+        notify_thread.join();
+    }
+
+    std::shared_ptr<std::timed_mutex> poll_mutex;
+    std::shared_ptr<std::condition_variable_any> cv;
+    bool alive{true};
+    std::thread notify_thread;
+};
+
 goby::acomms::ModemDriverBase::ModemDriverBase() : order_(++count_)
 {
     // temporarily set these to the value set by the order in which the driver was started and update to more useful names in modem_start
@@ -80,7 +130,69 @@ bool goby::acomms::ModemDriverBase::modem_read(std::string* in)
                                    protobuf::ModemDriverStatus::CONNECTION_TO_MODEM_FAILED));
 }
 
-void goby::acomms::ModemDriverBase::modem_close() { modem_.reset(); }
+void goby::acomms::ModemDriverBase::modem_close()
+{
+    modem_event_source_.reset();
+    modem_.reset();
+}
+
+void goby::acomms::ModemDriverBase::run_events(time::SystemClock::duration max_wait)
+{
+    if (event_mode())
+    {
+        auto max_interval = std::chrono::duration_cast<time::SystemClock::duration>(
+            std::chrono::duration<double>(cfg_.event_max_work_interval()));
+
+        if (io_.stopped())
+            io_.reset();
+
+        boost::asio::steady_timer wait_timer(io_);
+        wait_timer.expires_at(std::chrono::steady_clock::now() +
+                              real_duration(std::max(std::min(max_wait, max_interval),
+                                                     time::SystemClock::duration::zero())));
+        wait_timer.async_wait([](const boost::system::error_code& /*ec*/) {});
+
+        // blocks until any handler runs: modem data, event source, driver I/O or a timer
+        io_.run_one();
+        wait_timer.cancel();
+        io_.poll();
+    }
+
+    do_work();
+}
+
+void goby::acomms::ModemDriverBase::add_event_source(
+    std::shared_ptr<std::timed_mutex> poll_mutex, std::shared_ptr<std::condition_variable_any> cv)
+{
+    if (event_mode())
+        event_sources_.emplace_back(new EventSource(io_, std::move(poll_mutex), std::move(cv)));
+}
+
+void goby::acomms::ModemDriverBase::schedule_work(time::SystemClock::duration delay)
+{
+    if (!event_mode())
+        return;
+
+    auto deadline = std::chrono::steady_clock::now() + real_duration(delay);
+    work_deadlines_.insert(deadline);
+    if (deadline == *work_deadlines_.begin())
+        arm_work_timer();
+}
+
+void goby::acomms::ModemDriverBase::arm_work_timer()
+{
+    work_timer_.expires_at(*work_deadlines_.begin());
+    work_timer_.async_wait([this](const boost::system::error_code& ec) {
+        // superseded by an earlier deadline
+        if (ec == boost::asio::error::operation_aborted)
+            return;
+
+        work_deadlines_.erase(work_deadlines_.begin(),
+                              work_deadlines_.upper_bound(std::chrono::steady_clock::now()));
+        if (!work_deadlines_.empty())
+            arm_work_timer();
+    });
+}
 
 void goby::acomms::ModemDriverBase::modem_start(const protobuf::DriverConfig& cfg)
 {
@@ -191,6 +303,10 @@ void goby::acomms::ModemDriverBase::modem_start(const protobuf::DriverConfig& cf
     {
         modem_->start();
 
+        if (event_mode())
+            modem_event_source_.reset(
+                new EventSource(io_, modem_->poll_mutex(), modem_->poll_cv()));
+
         // give it this much startup time
         const int max_startup_ms = 10000;
         int startup_elapsed_ms = 0;
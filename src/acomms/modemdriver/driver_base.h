@@ -26,13 +26,21 @@
 #define GOBY_ACOMMS_MODEMDRIVER_DRIVER_BASE_H
 
 #include <atomic>                         // for atomic
+#include <boost/asio/steady_timer.hpp>    // for steady_timer
 #include <boost/signals2/signal.hpp>      // for signal
 #include <boost/smart_ptr/shared_ptr.hpp> // for shared_ptr
+#include <chrono>                         // for steady_clock
+#include <condition_variable>             // for condition_variable_any
 #include <iosfwd>                         // for ofstream
 #include <memory>                         // for shared_ptr, __shared_p...
+#include <mutex>                          // for timed_mutex
+#include <set>                            // for multiset
 #include <string>                         // for string
+#include <vector>                         // for vector
 
 #include "goby/acomms/protobuf/driver_base.pb.h" // for DriverCo...
+#include "goby/time/system_clock.h"              // for SystemClock
+#include "goby/util/asio_compat.h"               // for io_context
 
 namespace goby
 {
@@ -79,6 +87,25 @@ class ModemDriverBase
 
     //@}
 
+    /// \name Event mode
+    //@{
+
+    /// \brief Blocks until the driver has work to do, then calls do_work().
+    ///
+    /// In DriverConfig::WORK_MODE_EVENT, returns as soon as data arrives from the modem, a handler on io() completes, a timer set with schedule_work() expires, an event source (see add_event_source()) is notified, or max_wait (capped at DriverConfig::event_max_work_interval) elapses. In WORK_MODE_POLLING (the default), calls do_work() immediately.
+    void run_events(time::SystemClock::duration max_wait);
+
+    /// \brief Also wake run_events() when the given condition variable is notified, e.g. the Poller of the owning thread so that incoming mail is not delayed. Notifiers must lock poll_mutex before notifying (as InterThreadTransporter does). Does nothing in WORK_MODE_POLLING.
+    void add_event_source(std::shared_ptr<std::timed_mutex> poll_mutex,
+                          std::shared_ptr<std::condition_variable_any> cv);
+
+    /// \brief True if the driver was started with DriverConfig::WORK_MODE_EVENT
+    bool event_mode() const
+    {
+        return cfg_.work_mode() == protobuf::DriverConfig::WORK_MODE_EVENT;
+    }
+    //@}
+
     /// \name MAC Slots
     //@{
     /// \brief Virtual initiate_transmission method. Typically connected to MACManager::signal_initiate_transmission() using bind().
@@ -181,13 +208,34 @@ class ModemDriverBase
     util::LineBasedInterface& modem() { return *modem_; }
 
     //@}
+
+    /// \name Event scheduling
+    //@{
+
+    /// \brief io_context for the driver's own asynchronous I/O. Handlers run from within run_events() (event mode) and should be polled from do_work() (both modes).
+    boost::asio::io_context& io() { return io_; }
+
+    /// \brief Request a call to do_work() after (at most) delay, e.g. for a driver timeout. Does nothing in WORK_MODE_POLLING, where do_work() is already called regularly.
+    void schedule_work(time::SystemClock::duration delay);
+
+    //@}
   protected:
     static std::atomic<int> count_;
 
   private:
     void write_raw(const protobuf::ModemRaw& msg, bool rx);
+    void arm_work_timer();
+
+    struct EventSource;
 
   private:
+    boost::asio::io_context io_;
+    boost::asio::steady_timer work_timer_{io_};
+    // pending schedule_work() deadlines, work_timer_ is set for the earliest
+    std::multiset<std::chrono::steady_clock::time_point> work_deadlines_;
+    std::vector<std::unique_ptr<EventSource>> event_sources_;
+    std::unique_ptr<EventSource> modem_event_source_;
+
     // represents the line based communications interface to the modem
     std::shared_ptr<util::LineBasedInterface> modem_;
 
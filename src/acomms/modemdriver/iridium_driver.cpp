@@ -362,7 +362,8 @@ void goby::acomms::IridiumDriver::send(const protobuf::ModemTransmission& msg)
             serialize_iridium_modem_message(&iridium_packet, msg);
 
             std::string rudics_packet;
-            serialize_rudics_packet(iridium_packet, &rudics_packet);
+            serialize_rudics_packet(iridium_packet, &rudics_packet, rudics_default_reserved(), true,
+                                    rudics_packet_version(iridium_driver_cfg()));
             fsm_.process_event(iridium::fsm::EvSBDBeginData(rudics_packet));
         }
     }
@@ -28,6 +28,7 @@
 #include <dccl/field_codec_fixed.h>
 #include <dccl/field_codec_manager.h>
 
+#include "goby/acomms/modemdriver/rudics_packet.h"
 #include "goby/acomms/protobuf/iridium_driver.pb.h"
 #include "goby/time/system_clock.h"
 #include "goby/util/dccl_compat.h"
@@ -94,6 +95,11 @@ class IridiumHeaderIdentifierCodec : public dccl::TypedFixedFieldCodec<std::uint
     virtual unsigned size() { return 0; }
 };
 
+inline RudicsPacketVersion rudics_packet_version(const iridium::protobuf::Config& cfg)
+{
+    return static_cast<RudicsPacketVersion>(cfg.rudics_packet_version());
+}
+
 extern std::shared_ptr<dccl::Codec> iridium_header_dccl_;
 
 inline void init_iridium_dccl()
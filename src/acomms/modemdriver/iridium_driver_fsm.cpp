@@ -376,7 +376,9 @@ void goby::acomms::iridium::fsm::OnCall::in_state_react(const EvTxOnCallSerial&)
 
         // frame message
         std::string rudics_packet;
-        serialize_rudics_packet(bytes, &rudics_packet);
+        serialize_rudics_packet(
+            bytes, &rudics_packet, rudics_default_reserved(), true,
+            rudics_packet_version(context<IridiumDriverFSM>().iridium_driver_cfg()));
 
         context<IridiumDriverFSM>().serial_tx_buffer().push_back(rudics_packet);
         data_out.pop_front();
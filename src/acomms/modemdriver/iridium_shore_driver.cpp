@@ -21,6 +21,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm> // for min
 #include <chrono>    // for opera...
 #include <exception> // for excep...
 #include <list>      // for opera...
@@ -226,7 +227,8 @@ void goby::acomms::IridiumShoreDriver::send(const protobuf::ModemTransmission& m
 
         // frame message
         std::string rudics_packet;
-        serialize_rudics_packet(bytes, &rudics_packet);
+        serialize_rudics_packet(bytes, &rudics_packet, rudics_default_reserved(), true,
+                                remote.rudics_packet_version);
         rudics_send(rudics_packet, msg.dest());
         std::shared_ptr<OnCallBase> on_call_base = remote.on_call;
         on_call_base->set_last_tx_time(time::SystemClock::now().time_since_epoch() /
@@ -239,7 +241,8 @@ void goby::acomms::IridiumShoreDriver::send(const protobuf::ModemTransmission& m
         serialize_iridium_modem_message(&bytes, msg);
 
         std::string sbd_packet;
-        serialize_rudics_packet(bytes, &sbd_packet);
+        serialize_rudics_packet(bytes, &sbd_packet, rudics_default_reserved(), true,
+                                remote.rudics_packet_version);
 
         if (modem_id_to_imei_.count(msg.dest()))
             send_sbd_mt(sbd_packet, modem_id_to_imei_[msg.dest()]);
@@ -249,6 +252,21 @@ void goby::acomms::IridiumShoreDriver::send(const protobuf::ModemTransmission& m
     }
 }
 
+void goby::acomms::IridiumShoreDriver::update_rudics_packet_version(
+    ModemId id, RudicsPacketVersion received_version)
+{
+    RudicsPacketVersion version =
+        std::min(received_version, rudics_packet_version(iridium_driver_cfg()));
+
+    RudicsPacketVersion& current_version = remote_[id].rudics_packet_version;
+    if (version != current_version)
+    {
+        glog.is(DEBUG1) && glog << "Using RUDICS packet version " << version
+                                << " for modem id: " << id << std::endl;
+        current_version = version;
+    }
+}
+
 void goby::acomms::IridiumShoreDriver::rudics_send(const std::string& data,
                                                    goby::acomms::IridiumShoreDriver::ModemId id)
 {
@@ -334,7 +352,8 @@ void goby::acomms::IridiumShoreDriver::rudics_line(
         }
         else
         {
-            parse_rudics_packet(&decoded_line, data);
+            RudicsPacketVersion version;
+            parse_rudics_packet(&decoded_line, data, rudics_default_reserved(), true, &version);
 
             protobuf::ModemTransmission modem_msg;
             parse_iridium_modem_message(decoded_line, &modem_msg);
@@ -351,6 +370,7 @@ void goby::acomms::IridiumShoreDriver::rudics_line(
 
             remote_[modem_msg.src()].on_call->set_last_rx_time(
                 time::SystemClock::now<time::SITime>() / boost::units::si::seconds);
+            update_rudics_packet_version(modem_msg.src(), version);
 
             receive(modem_msg);
         }
@@ -392,8 +412,11 @@ void goby::acomms::IridiumShoreDriver::receive_sbd_mo()
             std::string bytes;
             try
             {
-                parse_rudics_packet(&bytes, (*it)->message().body().payload());
+                RudicsPacketVersion version;
+                parse_rudics_packet(&bytes, (*it)->message().body().payload(),
+                                    rudics_default_reserved(), true, &version);
                 parse_iridium_modem_message(bytes, &modem_msg);
+                update_rudics_packet_version(modem_msg.src(), version);
 
                 glog.is(DEBUG1) && glog << "Rx SBD ModemTransmission: "
                                         << modem_msg.ShortDebugString() << std::endl;
@@ -34,6 +34,7 @@
 #include <boost/circular_buffer.hpp> // for circular_b...
 
 #include "goby/acomms/modemdriver/driver_base.h"          // for ModemDrive...
+#include "goby/acomms/modemdriver/rudics_packet.h"        // for RudicsPack...
 #include "goby/acomms/protobuf/driver_base.pb.h"          // for DriverConfig
 #include "goby/acomms/protobuf/iridium_driver.pb.h"       // for MessageTyp...
 #include "goby/acomms/protobuf/iridium_shore_driver.pb.h" // for ShoreConfig
@@ -117,8 +118,12 @@ class IridiumShoreDriver : public ModemDriverBase
 
         std::shared_ptr<OnCallBase> on_call;
         boost::circular_buffer<protobuf::ModemTransmission> data_out;
+        // version last received from this remote (capped by our configured version)
+        RudicsPacketVersion rudics_packet_version{RUDICS_PACKET_V1};
     };
 
+    void update_rudics_packet_version(ModemId id, RudicsPacketVersion received_version);
+
     std::map<ModemId, RemoteNode> remote_;
 
     boost::asio::io_service rudics_io_;
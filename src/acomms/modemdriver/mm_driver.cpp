@@ -498,6 +498,7 @@ void goby::acomms::MMDriver::query_all_cfg()
 {
     waiting_for_multimsg_ = true;
     last_multimsg_rx_time_ = time::SystemClock::now();
+    schedule_work(MULTI_REPLY_WAIT);
     if (revision_.mm_major >= 2)
     {
         NMEASentence nmea("$CCCFQ,TOP", NMEASentence::IGNORE);
@@ -1075,6 +1076,8 @@ void goby::acomms::MMDriver::mm_write(const util::NMEASentence& nmea)
 
     waiting_for_modem_ = true;
     last_write_time_ = time::SystemClock::now();
+    // check for the serial ack timeout (resend) on time
+    schedule_work(MODEM_WAIT);
 }
 
 void goby::acomms::MMDriver::increment_present_fail()
@@ -1196,6 +1199,7 @@ void goby::acomms::MMDriver::process_receive(const NMEASentence& nmea)
                 // the message should only be popped once all messages are received
                 // CAREV sentence can be received midway through CFG messages
                 last_multimsg_rx_time_ = time::SystemClock::now();
+                schedule_work(MULTI_REPLY_WAIT);
             }
             else
                 pop_out();
@@ -29,11 +29,37 @@
 #include <boost/crc.hpp>                             // for crc_32_type
 #include <netinet/in.h>                              // for htonl, ntohl
 
-#include "goby/util/base_convert.h" // for base_convert
+#include "goby/exception.h"         // for Exception
+#include "goby/util/base_convert.h" // for base_convert, block_base_encode
 #include "rudics_packet.h"
 
+namespace
+{
+// the highest symbol of the reduced alphabet is never produced by the version 2 block encoding, so it is used to mark the start of a version 2 packet
+int v2_marker(int reduced_base) { return reduced_base - 1; }
+
+void check_and_remove_crc(std::string* bytes)
+{
+    const unsigned CRC_BYTE_SIZE = 4;
+    if (bytes->size() < CRC_BYTE_SIZE)
+        throw(goby::acomms::RudicsPacketException("Packet too short for CRC32"));
+
+    std::string crc_str = bytes->substr(bytes->size() - 4, 4);
+    uint32_t given_crc = goby::acomms::byte_string_to_uint32(crc_str);
+    *bytes = bytes->substr(0, bytes->size() - 4);
+
+    boost::crc_32_type crc;
+    crc.process_bytes(bytes->data(), bytes->length());
+    uint32_t computed_crc = crc.checksum();
+
+    if (given_crc != computed_crc)
+        throw(goby::acomms::RudicsPacketException("Bad CRC32"));
+}
+} // namespace
+
 void goby::acomms::serialize_rudics_packet(std::string bytes, std::string* rudics_pkt,
-                                           const std::string& reserved, bool include_crc)
+                                           const std::string& reserved, bool include_crc,
+                                           RudicsPacketVersion version)
 {
     if (include_crc)
     {
@@ -46,7 +72,16 @@ void goby::acomms::serialize_rudics_packet(std::string bytes, std::string* rudic
     // 2. convert to base (256 minus reserved)
     const int reduced_base = 256 - reserved.size();
 
-    goby::util::base_convert(bytes, rudics_pkt, 256, reduced_base);
+    switch (version)
+    {
+        case RUDICS_PACKET_V1:
+            goby::util::base_convert(bytes, rudics_pkt, 256, reduced_base);
+            break;
+        case RUDICS_PACKET_V2:
+            goby::util::block_base_encode(bytes, rudics_pkt, v2_marker(reduced_base));
+            rudics_pkt->insert(rudics_pkt->begin(), static_cast<char>(v2_marker(reduced_base)));
+            break;
+    }
 
     // 3. replace reserved characters
     for (int i = 0, n = reserved.size(); i < n; ++i)
@@ -60,7 +95,8 @@ void goby::acomms::serialize_rudics_packet(std::string bytes, std::string* rudic
 }
 
 void goby::acomms::parse_rudics_packet(std::string* bytes, std::string rudics_pkt,
-                                       const std::string& reserved, bool include_crc)
+                                       const std::string& reserved, bool include_crc,
+                                       RudicsPacketVersion* version)
 {
     const unsigned CR_SIZE = 1;
     if (rudics_pkt.size() < CR_SIZE)
@@ -84,26 +120,34 @@ void goby::acomms::parse_rudics_packet(std::string* bytes, std::string rudics_pk
     }
 
     // 2. convert to base
-    goby::util::base_convert(rudics_pkt, bytes, reduced_base, 256);
-
-    if (include_crc)
+    if (include_crc && !rudics_pkt.empty() && (0xFF & rudics_pkt[0]) == v2_marker(reduced_base))
     {
-        // 1. check CRC
-        const unsigned CRC_BYTE_SIZE = 4;
-        if (bytes->size() < CRC_BYTE_SIZE)
-            throw(RudicsPacketException("Packet too short for CRC32"));
+        // a version 1 packet can also start with this symbol, in which case either the block decoding or the CRC check fails and we fall back to version 1
+        try
+        {
+            goby::util::block_base_decode(rudics_pkt.substr(1), bytes, v2_marker(reduced_base));
+            // 1. check CRC
+            check_and_remove_crc(bytes);
+            if (version)
+                *version = RUDICS_PACKET_V2;
+            return;
+        }
+        catch (goby::Exception&)
+        {
+        }
+        catch (RudicsPacketException&)
+        {
+        }
+    }
 
-        std::string crc_str = bytes->substr(bytes->size() - 4, 4);
-        uint32_t given_crc = byte_string_to_uint32(crc_str);
-        *bytes = bytes->substr(0, bytes->size() - 4);
+    goby::util::base_convert(rudics_pkt, bytes, reduced_base, 256);
 
-        boost::crc_32_type crc;
-        crc.process_bytes(bytes->data(), bytes->length());
-        uint32_t computed_crc = crc.checksum();
+    // 1. check CRC
+    if (include_crc)
+        check_and_remove_crc(bytes);
 
-        if (given_crc != computed_crc)
-            throw(RudicsPacketException("Bad CRC32"));
-    }
+    if (version)
+        *version = RUDICS_PACKET_V1;
 }
 
 std::string goby::acomms::uint32_to_byte_string(uint32_t i)
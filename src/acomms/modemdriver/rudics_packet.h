@@ -39,14 +39,33 @@ class RudicsPacketException : public std::runtime_error
     RudicsPacketException(const std::string& what) : std::runtime_error(what) {}
 };
 
+/// \brief Encoding used for the body of a RUDICS packet
+enum RudicsPacketVersion
+{
+    /// whole packet converted as a single integer (cost is quadratic in packet length)
+    RUDICS_PACKET_V1 = 1,
+    /// marker symbol followed by fixed size blocks (cost is linear in packet length)
+    RUDICS_PACKET_V2 = 2
+};
+
+/// \brief Characters that are never sent in the body of a RUDICS packet (unless otherwise specified)
+inline std::string rudics_default_reserved()
+{
+    return std::string("\0\r\n", 3) + std::string(1, 0xff);
+}
+
 void serialize_rudics_packet(std::string bytes, std::string* rudics_pkt,
-                             const std::string& reserved = std::string("\0\r\n", 3) +
-                                                           std::string(1, 0xff),
-                             bool include_crc = true);
+                             const std::string& reserved = rudics_default_reserved(),
+                             bool include_crc = true,
+                             RudicsPacketVersion version = RUDICS_PACKET_V1);
+
+/// \brief Parse a RUDICS packet of either version
+///
+/// Version 2 packets are only detected when include_crc is true, as the CRC is used to reject version 1 packets that happen to begin with the version 2 marker symbol.
+/// \param version If not null, set to the version of the packet that was parsed
 void parse_rudics_packet(std::string* bytes, std::string rudics_pkt,
-                         const std::string& reserved = std::string("\0\r\n", 3) +
-                                                       std::string(1, 0xff),
-                         bool include_crc = true);
+                         const std::string& reserved = rudics_default_reserved(),
+                         bool include_crc = true, RudicsPacketVersion* version = nullptr);
 std::string uint32_to_byte_string(uint32_t i);
 uint32_t byte_string_to_uint32(const std::string& s);
 } // namespace acomms
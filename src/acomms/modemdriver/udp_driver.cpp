@@ -29,9 +29,11 @@
 #include <ostream> // for basic_ostream
 #include <string>  // for string, oper...
 #include <utility> // for pair, make_pair
+#include <vector>  // for vector
 
 #include <boost/asio/basic_datagram_socket.hpp>      // for basic_datagr...
 #include <boost/asio/buffer.hpp>                     // for buffer, muta...
+#include <boost/asio/error.hpp>                      // for operation_ab...
 #include <boost/asio/ip/address.hpp>                 // for address
 #include <boost/asio/ip/basic_endpoint.hpp>          // for basic_endpoint
 #include <boost/asio/ip/basic_resolver.hpp>          // for basic_resolv...
@@ -68,7 +70,7 @@ void goby::acomms::UDPDriver::startup(const protobuf::DriverConfig& cfg)
 
     modem_start(driver_cfg_);
 
-    socket_ = std::make_unique<boost::asio::ip::udp::socket>(io_context_);
+    socket_ = std::make_unique<boost::asio::ip::udp::socket>(io());
     const auto& local = driver_cfg_.GetExtension(udp::protobuf::config).local();
     socket_->open(boost::asio::ip::udp::v4());
     socket_->bind(boost::asio::ip::udp::endpoint(boost::asio::ip::udp::v4(), local.port()));
@@ -79,7 +81,7 @@ void goby::acomms::UDPDriver::startup(const protobuf::DriverConfig& cfg)
         glog.is(DEBUG1) && glog << group(glog_out_group())
                                 << "Resolving receiver: " << remote.ShortDebugString() << std::endl;
 
-        boost::asio::ip::udp::resolver resolver(io_context_);
+        boost::asio::ip::udp::resolver resolver(io());
         boost::asio::ip::udp::resolver::query query(
             boost::asio::ip::udp::v4(), remote.ip(), goby::util::as<std::string>(remote.port()),
             boost::asio::ip::resolver_query_base::numeric_service);
@@ -99,14 +101,19 @@ void goby::acomms::UDPDriver::startup(const protobuf::DriverConfig& cfg)
          driver_cfg_.GetExtension(udp::protobuf::config).additional_application_ack_modem_id())
         application_ack_ids_.insert(id);
 
+    datagram_receiver_ = std::make_unique<detail::UDPDatagramReceiver>(
+        driver_cfg_.GetExtension(udp::protobuf::config).receive_batch_size());
+    packers_.clear();
+
     start_receive();
-    io_context_.reset();
+    io().reset();
 }
 
 void goby::acomms::UDPDriver::shutdown()
 {
-    io_context_.stop();
+    io().stop();
     socket_.reset();
+    packers_.clear();
 }
 
 void goby::acomms::UDPDriver::handle_initiate_transmission(
@@ -133,7 +140,11 @@ void goby::acomms::UDPDriver::handle_initiate_transmission(
         start_send(msg);
 }
 
-void goby::acomms::UDPDriver::do_work() { io_context_.poll(); }
+void goby::acomms::UDPDriver::do_work()
+{
+    io().poll();
+    flush_packed_sends();
+}
 
 void goby::acomms::UDPDriver::receive_message(const protobuf::ModemTransmission& msg)
 {
@@ -167,9 +178,26 @@ void goby::acomms::UDPDriver::start_send(const protobuf::ModemTransmission& msg)
     raw_msg.set_raw(bytes);
     signal_raw_outgoing(raw_msg);
 
+    const auto& udp_cfg = driver_cfg_.GetExtension(udp::protobuf::config);
     auto send = [&](const boost::asio::ip::udp::endpoint& receiver) {
-        socket_->async_send_to(boost::asio::buffer(bytes), receiver,
-                               boost::bind(&UDPDriver::send_complete, this, boost::placeholders::_1, boost::placeholders::_2));
+        if (udp_cfg.pack_transmissions())
+        {
+            auto it = packers_.find(receiver);
+            if (it == packers_.end())
+                it = packers_
+                         .insert(std::make_pair(
+                             receiver, detail::UDPTransmissionPacker(udp_cfg.max_datagram_size())))
+                         .first;
+            it->second.add(msg);
+            // flush at the end of the next do_work()
+            schedule_work(time::SystemClock::duration::zero());
+        }
+        else
+        {
+            socket_->async_send_to(boost::asio::buffer(bytes), receiver,
+                                   boost::bind(&UDPDriver::send_complete, this,
+                                               boost::placeholders::_1, boost::placeholders::_2));
+        }
     };
 
     auto broadcast_receivers = receivers_.equal_range(goby::acomms::BROADCAST_ID);
@@ -200,36 +228,74 @@ void goby::acomms::UDPDriver::send_complete(const boost::system::error_code& err
                             << std::endl;
 }
 
+void goby::acomms::UDPDriver::flush_packed_sends()
+{
+    std::vector<detail::UDPDatagram> datagrams;
+    for (auto& endpoint_packer_pair : packers_)
+    {
+        if (endpoint_packer_pair.second.empty())
+            continue;
+
+        std::vector<std::string> packed;
+        endpoint_packer_pair.second.flush(&packed);
+        for (auto& bytes : packed)
+            datagrams.push_back({endpoint_packer_pair.first, std::move(bytes)});
+    }
+
+    if (datagrams.empty())
+        return;
+
+    boost::system::error_code ec;
+    std::size_t bytes_transferred = detail::send_udp_datagrams(*socket_, datagrams, ec);
+    send_complete(ec, bytes_transferred);
+}
+
 void goby::acomms::UDPDriver::start_receive()
 {
-    socket_->async_receive_from(boost::asio::buffer(receive_buffer_), sender_,
-                                boost::bind(&UDPDriver::receive_complete, this, boost::placeholders::_1, boost::placeholders::_2));
+    detail::async_wait_readable(
+        *socket_, [this](const boost::system::error_code& ec) { receive_complete(ec); });
 }
 
-void goby::acomms::UDPDriver::receive_complete(const boost::system::error_code& error,
-                                               std::size_t bytes_transferred)
+void goby::acomms::UDPDriver::receive_complete(const boost::system::error_code& error)
 {
-    if (error)
+    if (error == boost::asio::error::operation_aborted)
+        return;
+
+    boost::system::error_code ec = error;
+    if (!ec)
+        datagram_receiver_->drain(
+            *socket_,
+            [this](const char* data, std::size_t size,
+                   const boost::asio::ip::udp::endpoint& sender) {
+                receive_datagram(data, size, sender);
+            },
+            ec);
+
+    if (ec)
     {
         glog.is(DEBUG1) && glog << group(glog_in_group()) << warn
-                                << "Receive error: " << error.message() << std::endl;
-        start_receive();
-        return;
+                                << "Receive error: " << ec.message() << std::endl;
     }
 
+    start_receive();
+}
+
+void goby::acomms::UDPDriver::receive_datagram(const char* data, std::size_t size,
+                                               const boost::asio::ip::udp::endpoint& sender)
+{
     protobuf::ModemRaw raw_msg;
-    raw_msg.set_raw(std::string(&receive_buffer_[0], bytes_transferred));
+    raw_msg.set_raw(std::string(data, size));
     signal_raw_incoming(raw_msg);
 
-    glog.is(DEBUG1) && glog << group(glog_in_group()) << "Received " << bytes_transferred
-                            << " bytes from " << sender_.address().to_string() << ":"
-                            << sender_.port() << std::endl;
+    glog.is(DEBUG1) && glog << group(glog_in_group()) << "Received " << size << " bytes from "
+                            << sender.address().to_string() << ":" << sender.port() << std::endl;
 
-    protobuf::ModemTransmission msg;
-    msg.ParseFromArray(&receive_buffer_[0], bytes_transferred);
-    receive_message(msg);
+    std::vector<protobuf::ModemTransmission> msgs;
+    if (!detail::unpack_udp_datagram(data, size, &msgs))
+        glog.is(DEBUG1) && glog << group(glog_in_group()) << warn
+                                << "Failed to parse all transmissions in datagram" << std::endl;
 
-    start_receive();
+    for (const auto& msg : msgs) receive_message(msg);
 }
 
 void goby::acomms::UDPDriver::report(protobuf::ModemReport* report)
@@ -25,18 +25,18 @@
 #ifndef GOBY_ACOMMS_MODEMDRIVER_UDP_DRIVER_H
 #define GOBY_ACOMMS_MODEMDRIVER_UDP_DRIVER_H
 
-#include <array>   // for array
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
-#include <map>     // for multimap
+#include <map>     // for multimap, map
 #include <memory>  // for unique_ptr
 #include <set>     // for set
 
 #include <boost/asio/ip/udp.hpp> // for udp, udp::endpoint
 
-#include "goby/acomms/modemdriver/driver_base.h" // for ModemDriverBase
-#include "goby/acomms/protobuf/driver_base.pb.h" // for DriverConfig
-#include "goby/util/asio_compat.h"               // for io_context
+#include "goby/acomms/modemdriver/detail/udp_datagram.h" // for UDPTransmissionPacker, UDPD...
+#include "goby/acomms/modemdriver/driver_base.h"         // for ModemDriverBase
+#include "goby/acomms/protobuf/driver_base.pb.h"         // for DriverConfig
+#include "goby/util/asio_compat.h"                       // for io_context
 
 namespace boost
 {
@@ -71,22 +71,22 @@ class UDPDriver : public ModemDriverBase
   private:
     void start_send(const protobuf::ModemTransmission& msg);
     void send_complete(const boost::system::error_code& error, std::size_t bytes_transferred);
+    void flush_packed_sends();
     void start_receive();
-    void receive_complete(const boost::system::error_code& error, std::size_t bytes_transferred);
+    void receive_complete(const boost::system::error_code& error);
+    void receive_datagram(const char* data, std::size_t size,
+                          const boost::asio::ip::udp::endpoint& sender);
     void receive_message(const protobuf::ModemTransmission& m);
 
   private:
     protobuf::DriverConfig driver_cfg_;
-    boost::asio::io_context io_context_;
     std::unique_ptr<boost::asio::ip::udp::socket> socket_;
     // modem id to endpoint
     std::multimap<int, boost::asio::ip::udp::endpoint> receivers_;
-    boost::asio::ip::udp::endpoint sender_;
 
-    // (16 bit length = 65535 - 8 byte UDP header - 20 byte IP
-    static constexpr size_t UDP_MAX_PACKET_SIZE = 65507;
-
-    std::array<char, UDP_MAX_PACKET_SIZE> receive_buffer_;
+    std::unique_ptr<detail::UDPDatagramReceiver> datagram_receiver_;
+    // transmissions waiting for the end of do_work() when pack_transmissions is set
+    std::map<boost::asio::ip::udp::endpoint, detail::UDPTransmissionPacker> packers_;
 
     // ids we are providing acks for, normally just our modem_id()
     std::set<unsigned> application_ack_ids_;
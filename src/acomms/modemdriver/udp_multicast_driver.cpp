@@ -27,8 +27,10 @@
 #include <list>    // for operator!=
 #include <ostream> // for basic_ostream
 #include <string>  // for operator<<
+#include <vector>  // for vector
 
 #include <boost/asio/buffer.hpp>       // for buffer, muta...
+#include <boost/asio/error.hpp>        // for operation_ab...
 #include <boost/asio/ip/address.hpp>   // for address
 #include <boost/asio/ip/multicast.hpp> // for join_group
 #include <boost/asio/socket_base.hpp>  // for socket_base:...
@@ -76,13 +78,19 @@ void goby::acomms::UDPMulticastDriver::startup(const protobuf::DriverConfig& cfg
     receiver_ =
         boost::asio::ip::udp::endpoint(multicast_address, multicast_driver_cfg().multicast_port());
 
+    datagram_receiver_ =
+        std::make_unique<detail::UDPDatagramReceiver>(multicast_driver_cfg().receive_batch_size());
+    packer_ =
+        std::make_unique<detail::UDPTransmissionPacker>(multicast_driver_cfg().max_datagram_size());
+
     start_receive();
 }
 
 void goby::acomms::UDPMulticastDriver::shutdown()
 {
-    io_context_.stop();
+    io().stop();
     socket_.close();
+    packer_.reset();
 }
 
 void goby::acomms::UDPMulticastDriver::handle_initiate_transmission(
@@ -115,7 +123,11 @@ void goby::acomms::UDPMulticastDriver::handle_initiate_transmission(
         start_send(msg);
 }
 
-void goby::acomms::UDPMulticastDriver::do_work() { io_context_.poll(); }
+void goby::acomms::UDPMulticastDriver::do_work()
+{
+    io().poll();
+    flush_packed_sends();
+}
 
 void goby::acomms::UDPMulticastDriver::receive_message(const protobuf::ModemTransmission& msg)
 {
@@ -148,9 +160,18 @@ void goby::acomms::UDPMulticastDriver::start_send(const protobuf::ModemTransmiss
     raw_msg.set_raw(bytes);
     signal_raw_outgoing(raw_msg);
 
-    socket_.async_send_to(
-        boost::asio::buffer(bytes), receiver_,
-        [this](boost::system::error_code ec, std::size_t length) { send_complete(ec, length); });
+    if (multicast_driver_cfg().pack_transmissions())
+    {
+        packer_->add(msg);
+        // flush at the end of the next do_work()
+        schedule_work(time::SystemClock::duration::zero());
+    }
+    else
+    {
+        socket_.async_send_to(
+            boost::asio::buffer(bytes), receiver_,
+            [this](boost::system::error_code ec, std::size_t length) { send_complete(ec, length); });
+    }
 
     signal_transmit_result(msg);
 }
@@ -169,42 +190,76 @@ void goby::acomms::UDPMulticastDriver::send_complete(const boost::system::error_
                             << std::endl;
 }
 
+void goby::acomms::UDPMulticastDriver::flush_packed_sends()
+{
+    if (!packer_ || packer_->empty())
+        return;
+
+    std::vector<std::string> packed;
+    packer_->flush(&packed);
+
+    std::vector<detail::UDPDatagram> datagrams;
+    for (auto& bytes : packed) datagrams.push_back({receiver_, std::move(bytes)});
+
+    boost::system::error_code ec;
+    std::size_t bytes_transferred = detail::send_udp_datagrams(socket_, datagrams, ec);
+    send_complete(ec, bytes_transferred);
+}
+
 void goby::acomms::UDPMulticastDriver::start_receive()
 {
-    socket_.async_receive_from(
-        boost::asio::buffer(receive_buffer_), sender_,
-        [this](boost::system::error_code ec, std::size_t length) { receive_complete(ec, length); });
+    detail::async_wait_readable(
+        socket_, [this](const boost::system::error_code& ec) { receive_complete(ec); });
 }
 
-void goby::acomms::UDPMulticastDriver::receive_complete(const boost::system::error_code& error,
-                                                        std::size_t bytes_transferred)
+void goby::acomms::UDPMulticastDriver::receive_complete(const boost::system::error_code& error)
 {
-    if (error)
+    if (error == boost::asio::error::operation_aborted)
+        return;
+
+    boost::system::error_code ec = error;
+    if (!ec)
+        datagram_receiver_->drain(
+            socket_,
+            [this](const char* data, std::size_t size,
+                   const boost::asio::ip::udp::endpoint& sender) {
+                receive_datagram(data, size, sender);
+            },
+            ec);
+
+    if (ec)
     {
         glog.is(DEBUG1) && glog << group(glog_in_group()) << warn
-                                << "Receive error: " << error.message() << std::endl;
-        start_receive();
-        return;
+                                << "Receive error: " << ec.message() << std::endl;
     }
 
+    start_receive();
+}
+
+void goby::acomms::UDPMulticastDriver::receive_datagram(
+    const char* data, std::size_t size, const boost::asio::ip::udp::endpoint& sender)
+{
     protobuf::ModemRaw raw_msg;
-    raw_msg.set_raw(std::string(&receive_buffer_[0], bytes_transferred));
+    raw_msg.set_raw(std::string(data, size));
     signal_raw_incoming(raw_msg);
 
-    protobuf::ModemTransmission msg;
-    msg.ParseFromArray(&receive_buffer_[0], bytes_transferred);
+    std::vector<protobuf::ModemTransmission> msgs;
+    if (!detail::unpack_udp_datagram(data, size, &msgs))
+        glog.is(DEBUG1) && glog << group(glog_in_group()) << warn
+                                << "Failed to parse all transmissions in datagram" << std::endl;
 
-    // reject messages to ourselves
-    if (msg.src() != driver_cfg_.modem_id())
+    for (const auto& msg : msgs)
     {
-        glog.is(DEBUG1) && glog << group(glog_in_group()) << "Received " << bytes_transferred
-                                << " bytes from " << sender_.address().to_string() << ":"
-                                << sender_.port() << std::endl;
-
-        receive_message(msg);
+        // reject messages to ourselves
+        if (msg.src() != driver_cfg_.modem_id())
+        {
+            glog.is(DEBUG1) && glog << group(glog_in_group()) << "Received " << size
+                                    << " bytes from " << sender.address().to_string() << ":"
+                                    << sender.port() << std::endl;
+
+            receive_message(msg);
+        }
     }
-
-    start_receive();
 }
 
 void goby::acomms::UDPMulticastDriver::report(protobuf::ModemReport* report)
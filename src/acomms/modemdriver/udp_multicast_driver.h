@@ -25,12 +25,13 @@
 #ifndef GOBY_ACOMMS_MODEMDRIVER_UDP_MULTICAST_DRIVER_H
 #define GOBY_ACOMMS_MODEMDRIVER_UDP_MULTICAST_DRIVER_H
 
-#include <array>                 // for array
 #include <boost/asio/ip/udp.hpp> // for udp, udp::...
 #include <cstddef>               // for size_t
 #include <cstdint>               // for uint32_t
 #include <map>                   // for map
+#include <memory>                // for unique_ptr
 
+#include "goby/acomms/modemdriver/detail/udp_datagram.h"  // for UDPTransmi...
 #include "goby/acomms/modemdriver/driver_base.h"          // for ModemDrive...
 #include "goby/acomms/protobuf/driver_base.pb.h"          // for DriverConfig
 #include "goby/acomms/protobuf/udp_multicast_driver.pb.h" // for Config
@@ -69,8 +70,11 @@ class UDPMulticastDriver : public ModemDriverBase
   private:
     void start_send(const protobuf::ModemTransmission& m);
     void send_complete(const boost::system::error_code& error, std::size_t bytes_transferred);
+    void flush_packed_sends();
     void start_receive();
-    void receive_complete(const boost::system::error_code& error, std::size_t bytes_transferred);
+    void receive_complete(const boost::system::error_code& error);
+    void receive_datagram(const char* data, std::size_t size,
+                          const boost::asio::ip::udp::endpoint& sender);
     void receive_message(const protobuf::ModemTransmission& m);
 
     const udp_multicast::protobuf::Config& multicast_driver_cfg() const
@@ -80,15 +84,12 @@ class UDPMulticastDriver : public ModemDriverBase
 
   private:
     protobuf::DriverConfig driver_cfg_;
-    boost::asio::io_context io_context_;
-    boost::asio::ip::udp::socket socket_{io_context_};
+    boost::asio::ip::udp::socket socket_{io()};
     boost::asio::ip::udp::endpoint receiver_;
-    boost::asio::ip::udp::endpoint sender_;
 
-    // (16 bit length = 65535 - 8 byte UDP header - 20 byte IP
-    static constexpr size_t UDP_MAX_PACKET_SIZE = 65507;
-
-    std::array<char, UDP_MAX_PACKET_SIZE> receive_buffer_;
+    std::unique_ptr<detail::UDPDatagramReceiver> datagram_receiver_;
+    // transmissions waiting for the end of do_work() when pack_transmissions is set
+    std::unique_ptr<detail::UDPTransmissionPacker> packer_;
     std::uint32_t next_frame_{0};
 
     std::map<int, int> rate_to_bytes_;
@@ -38,6 +38,7 @@ set(ACOMMS_SRC
   acomms/modemdriver/mm_driver.cpp
   acomms/modemdriver/udp_driver.cpp
   acomms/modemdriver/udp_multicast_driver.cpp
+  acomms/modemdriver/detail/udp_datagram.cpp
   acomms/modemdriver/rudics_packet.cpp
   acomms/modemdriver/iridium_driver.cpp
   acomms/modemdriver/iridium_driver_fsm.cpp
@@ -0,0 +1,113 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cstdint>       // for uint64_t
+#include <fstream>       // for ifstream
+#include <iostream>      // for cout, cerr
+#include <string>        // for string
+#include <unordered_map> // for unordered_map
+#include <vector>        // for vector
+
+#include "goby/exception.h"                    // for Exception
+#include "goby/util/debug_logger/binary_log.h" // for BinaryLogReader
+
+using goby::util::logger::BinaryLogReader;
+
+// renders the binary debug log written by goby::glog (GLogConfig.binary_log) to text
+int main(int argc, char* argv[])
+{
+    auto usage = []() {
+        std::cerr << "usage: goby_glog_render [-t] [-v QUIET|WARN|VERBOSE|DEBUG1|DEBUG2|DEBUG3] "
+                     "input_file"
+                  << std::endl;
+        std::cerr << "  -t: show the logging thread (T1, T2, ...) of each line" << std::endl;
+        std::cerr << "  -v: only show lines up to this verbosity (default DEBUG3)" << std::endl;
+        return 1;
+    };
+
+    bool show_threads = false;
+    int max_verbosity = goby::util::protobuf::GLogConfig::DEBUG3;
+    std::string input_file;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg == "-t")
+        {
+            show_threads = true;
+        }
+        else if (arg == "-v" && i + 1 < argc)
+        {
+            goby::util::protobuf::GLogConfig::Verbosity verbosity;
+            if (!goby::util::protobuf::GLogConfig::Verbosity_Parse(argv[++i], &verbosity))
+                return usage();
+            max_verbosity = verbosity;
+        }
+        else if (input_file.empty())
+        {
+            input_file = arg;
+        }
+        else
+        {
+            return usage();
+        }
+    }
+
+    if (input_file.empty())
+        return usage();
+
+    std::ifstream in(input_file.c_str(), std::ios_base::in | std::ios_base::binary);
+    if (!in.is_open())
+    {
+        std::cerr << "Cannot open " << input_file << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        BinaryLogReader reader(&in);
+        std::unordered_map<std::uint64_t, int> threads;
+
+        goby::util::protobuf::GLogBinaryRecord::Entry entry;
+        std::vector<goby::util::logger::Payload> payloads;
+        while (reader.read(&entry, &payloads))
+        {
+            if (entry.verbosity() > max_verbosity)
+                continue;
+
+            if (show_threads)
+            {
+                auto it = threads.insert(std::make_pair(entry.thread(), threads.size() + 1)).first;
+                std::cout << "T" << it->second << " ";
+            }
+            BinaryLogReader::write_text(std::cout, entry, payloads);
+        }
+    }
+    catch (const goby::Exception& e)
+    {
+        std::cerr << input_file << ": " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -23,6 +23,7 @@
 
 #include <algorithm>     // for copy
 #include <chrono>        // for duration
+#include <deque>         // for deque
 #include <map>           // for operat...
 #include <ostream>       // for basic_...
 #include <ratio>         // for ratio
@@ -67,7 +68,9 @@ class Coroner : public goby::zeromq::SingleThreadApplication<protobuf::CoronerCo
           request_interval_(goby::time::convert_duration<decltype(request_interval_)>(
               cfg().request_interval_with_units())),
           response_timeout_(goby::time::convert_duration<decltype(response_timeout_)>(
-              cfg().response_timeout_with_units()))
+              cfg().response_timeout_with_units())),
+          rss_growth_window_(goby::time::convert_duration<decltype(rss_growth_window_)>(
+              cfg().rss_growth_window_with_units()))
     {
         for (const std::string& expected : cfg().expected_name()) tracked_names_.insert(expected);
 
@@ -128,12 +131,23 @@ class Coroner : public goby::zeromq::SingleThreadApplication<protobuf::CoronerCo
                 }
                 else
                 {
+                    check_resources(it->second, now);
                     if (it->second.main().state() > health_state)
                         health_state = it->second.main().state();
                     *report.add_process() = it->second;
                 }
             }
 
+            // forget the RSS history of processes missing from this report, so that it does
+            // not grow with process churn and a restarted process starts a new trend
+            for (auto it = rss_history_.begin(); it != rss_history_.end();)
+            {
+                if (tracked_names_.count(it->first) && responses_.count(it->first))
+                    ++it;
+                else
+                    it = rss_history_.erase(it);
+            }
+
             report.set_platform(cfg().interprocess().platform());
             report.set_state(health_state);
 
@@ -152,6 +166,71 @@ class Coroner : public goby::zeromq::SingleThreadApplication<protobuf::CoronerCo
         }
     }
 
+    // flag runaway CPU or memory growth as HEALTH__DEGRADED
+    void check_resources(goby::middleware::protobuf::ProcessHealth& process,
+                         goby::time::SystemClock::time_point now)
+    {
+        std::vector<std::string> problems;
+        check_thread_cpu(process.main(), problems);
+
+        if (process.has_resources())
+        {
+            const auto& resources = process.resources();
+            if (cfg().max_process_cpu_percent() > 0 && resources.has_cpu_percent() &&
+                resources.cpu_percent() > cfg().max_process_cpu_percent())
+                problems.push_back("process CPU " + std::to_string(resources.cpu_percent()) +
+                                   "%");
+
+            if (resources.has_rss())
+            {
+                auto& history = rss_history_[process.name()];
+                // restarted
+                if (!history.empty() && process.pid() != history.back().pid)
+                    history.clear();
+                history.push_back({now, process.pid(), resources.rss()});
+
+                // keep one sample at least rss_growth_window old
+                while (history.size() > 2 && history[1].time <= now - rss_growth_window_)
+                    history.pop_front();
+
+                const auto& oldest = history.front();
+                if (cfg().max_rss_growth_rate() > 0 && oldest.time <= now - rss_growth_window_)
+                {
+                    double rate = (static_cast<double>(resources.rss()) - oldest.rss) /
+                                  std::chrono::duration<double>(now - oldest.time).count();
+                    if (rate > cfg().max_rss_growth_rate())
+                        problems.push_back("RSS growing at " + std::to_string(rate) +
+                                           " bytes/s");
+                }
+            }
+        }
+
+        if (!problems.empty())
+        {
+            std::string message;
+            for (const auto& problem : problems)
+                message += (message.empty() ? "" : ", ") + problem;
+            glog.is_warn() && glog << process.name() << ": " << message << std::endl;
+
+            auto& main = *process.mutable_main();
+            if (main.state() < goby::middleware::protobuf::HEALTH__DEGRADED)
+            {
+                main.set_state(goby::middleware::protobuf::HEALTH__DEGRADED);
+                main.set_error_message(message);
+            }
+        }
+    }
+
+    void check_thread_cpu(const goby::middleware::protobuf::ThreadHealth& thread,
+                          std::vector<std::string>& problems)
+    {
+        if (cfg().max_thread_cpu_percent() > 0 && thread.resources().has_cpu_percent() &&
+            thread.resources().cpu_percent() > cfg().max_thread_cpu_percent())
+            problems.push_back("thread " + thread.name() + " CPU " +
+                               std::to_string(thread.resources().cpu_percent()) + "%");
+        for (const auto& child : thread.child()) check_thread_cpu(child, problems);
+    }
+
   private:
     goby::time::SystemClock::time_point last_request_time_{std::chrono::seconds(0)};
     goby::time::SystemClock::duration request_interval_;
@@ -161,6 +240,15 @@ class Coroner : public goby::zeromq::SingleThreadApplication<protobuf::CoronerCo
     std::map<std::string, goby::middleware::protobuf::ProcessHealth> responses_;
 
     std::set<std::string> tracked_names_;
+
+    struct RSSSample
+    {
+        goby::time::SystemClock::time_point time;
+        std::uint32_t pid;
+        std::uint64_t rss;
+    };
+    std::map<std::string, std::deque<RSSSample>> rss_history_;
+    goby::time::SystemClock::duration rss_growth_window_;
 };
 } // namespace zeromq
 } // namespace apps
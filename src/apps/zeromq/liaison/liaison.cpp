@@ -70,6 +70,7 @@
 #endif
 #include "goby/util/dccl_compat.h"
 
+#include "liaison_scope.h"     // for ScopeC...
 #include "liaison_wt_thread.h" // for Liaiso...
 
 namespace Wt
@@ -191,6 +192,10 @@ goby::apps::zeromq::Liaison::Liaison()
         }
     }
 
+    // one subscription and decoded message cache shared by all the scope sessions
+    if (cfg().add_scope_tab())
+        launch_thread<ScopeCacheThread>();
+
     try
     {
         std::string doc_root;
@@ -76,6 +76,8 @@ using namespace goby::util::logger;
 goby::apps::zeromq::LiaisonScope::LiaisonScope(const protobuf::LiaisonConfig& cfg)
     : LiaisonContainerWithComms<LiaisonScope, ScopeCommsThread>(cfg),
       pb_scope_config_(cfg.pb_scope_config()),
+      rate_limit_(pb_scope_config_.max_row_update_freq(),
+                  pb_scope_config_.max_bytes_per_second()),
       history_model_(new Wt::WStringListModel(this)),
       model_(new LiaisonScopeProtobufModel(pb_scope_config_, this)),
       proxy_(new Wt::WSortFilterProxyModel(this)),
@@ -138,12 +140,57 @@ void goby::apps::zeromq::LiaisonScope::update_freq(double hertz)
 {
     this->update_comms_freq(hertz);
 
+    rate_limit_.set_scope_update_freq(hertz);
     scope_timer_.stop();
     scope_timer_.setInterval(1 / hertz * 1.0e3);
     scope_timer_.start();
 }
 
-void goby::apps::zeromq::LiaisonScope::loop() { handle_refresh(); }
+void goby::apps::zeromq::LiaisonScope::loop()
+{
+    auto now = ScopeRateLimit::Clock::now();
+    if (rate_limit_.update(now))
+        glog.is(DEBUG2) && glog << "LiaisonScope: sent " << rate_limit_.last_rate()
+                                << " bytes/s, scaling row update interval by "
+                                << rate_limit_.row_interval_scale() << std::endl;
+
+    // rows that are not due yet keep their (latest) pending value for a later loop
+    for (auto it = paused_buffer_.begin(); it != paused_buffer_.end();)
+    {
+        if (!rate_limit_.row_due(it->first, now))
+        {
+            ++it;
+            continue;
+        }
+
+        handle_message(it->first, *it->second, false);
+        rate_limit_.row_updated(it->first, now);
+        it = paused_buffer_.erase(it);
+    }
+
+    history_header_div_->flush_buffer();
+}
+
+void goby::apps::zeromq::LiaisonScope::set_text(Wt::WStandardItem* item, const std::string& text)
+{
+    if (item->text().toUTF8() != text)
+    {
+        item->setText(WString::fromUTF8(text));
+        rate_limit_.add_bytes(text.size());
+    }
+}
+
+void goby::apps::zeromq::LiaisonScope::set_data(Wt::WStandardItem* item, const std::string& data,
+                                                int role)
+{
+    boost::any current = item->data(role);
+    const auto* current_data = boost::any_cast<std::string>(&current);
+    if (!current_data || *current_data != data)
+    {
+        item->setData(data, role);
+        rate_limit_.add_bytes(data.size());
+    }
+}
 
 void goby::apps::zeromq::LiaisonScope::attach_pb_rows(const std::vector<Wt::WStandardItem*>& items,
                                                       const std::string& debug_string)
@@ -166,53 +213,65 @@ void goby::apps::zeromq::LiaisonScope::attach_pb_rows(const std::vector<Wt::WSta
             if (!key_item->child(i, j))
                 key_item->setChild(i, j, new Wt::WStandardItem);
 
+            // only the fields that changed are sent to the browser
             if (j == protobuf::ProtobufScopeConfig::COLUMN_VALUE)
             {
                 if (i < result.size())
-                    key_item->child(i, j)->setText(result[i]);
+                    set_text(key_item->child(i, j), result[i]);
                 else
-                    key_item->child(i, j)->setText("");
+                    set_text(key_item->child(i, j), "");
             }
             else
             {
                 // so we can still sort by these fields
-                key_item->child(i, j)->setText(items[j]->text());
-                key_item->child(i, j)->setStyleClass("invisible");
+                set_text(key_item->child(i, j), items[j]->text().toUTF8());
+                if (key_item->child(i, j)->styleClass() != "invisible")
+                    key_item->child(i, j)->setStyleClass("invisible");
             }
         }
     }
 }
 
 std::vector<Wt::WStandardItem*> goby::apps::zeromq::LiaisonScope::create_row(
-    const std::string& group, const google::protobuf::Message& msg, bool do_attach_pb_rows)
+    const std::string& group, const ScopeCache::Value& value, bool do_attach_pb_rows)
 {
     std::vector<Wt::WStandardItem*> items;
     for (int i = 0; i <= protobuf::ProtobufScopeConfig::COLUMN_MAX; ++i)
         items.push_back(new WStandardItem);
-    update_row(group, msg, items, do_attach_pb_rows);
+    update_row(group, value, items, do_attach_pb_rows);
 
     return items;
 }
 
 void goby::apps::zeromq::LiaisonScope::update_row(const std::string& group,
-                                                  const google::protobuf::Message& msg,
+                                                  const ScopeCache::Value& value,
                                                   const std::vector<WStandardItem*>& items,
                                                   bool do_attach_pb_rows)
 {
+    const google::protobuf::Message& msg = *value.message();
     std::string debug_string = msg.DebugString();
 
-    items[protobuf::ProtobufScopeConfig::COLUMN_GROUP]->setText(group);
+    set_text(items[protobuf::ProtobufScopeConfig::COLUMN_GROUP], group);
 
-    items[protobuf::ProtobufScopeConfig::COLUMN_TYPE]->setText(msg.GetDescriptor()->full_name());
+    set_text(items[protobuf::ProtobufScopeConfig::COLUMN_TYPE], msg.GetDescriptor()->full_name());
 
-    items[protobuf::ProtobufScopeConfig::COLUMN_VALUE]->setData(msg.ShortDebugString(),
-                                                                DisplayRole);
-    items[protobuf::ProtobufScopeConfig::COLUMN_VALUE]->setData(debug_string, ToolTipRole);
-    items[protobuf::ProtobufScopeConfig::COLUMN_VALUE]->setData(debug_string, UserRole);
+    set_data(items[protobuf::ProtobufScopeConfig::COLUMN_VALUE], msg.ShortDebugString(),
+             DisplayRole);
+    set_data(items[protobuf::ProtobufScopeConfig::COLUMN_VALUE], debug_string, ToolTipRole);
+    set_data(items[protobuf::ProtobufScopeConfig::COLUMN_VALUE], debug_string, UserRole);
 
-    items[protobuf::ProtobufScopeConfig::COLUMN_TIME]->setData(
-        WDateTime::fromPosixTime(goby::time::SystemClock::now<boost::posix_time::ptime>()),
-        DisplayRole);
+    // time received, as the cache may hold values from before this session started
+    auto* time_item = items[protobuf::ProtobufScopeConfig::COLUMN_TIME];
+    WDateTime time =
+        WDateTime::fromPosixTime(goby::time::convert<boost::posix_time::ptime>(value.time()));
+    boost::any current_time = time_item->data(DisplayRole);
+    const auto* current = boost::any_cast<WDateTime>(&current_time);
+    if (!current || *current != time)
+    {
+        time_item->setData(time, DisplayRole);
+        // as formatted for display
+        rate_limit_.add_bytes(time_item->text().toUTF8().size());
+    }
 
     if (do_attach_pb_rows)
         attach_pb_rows(items, debug_string);
@@ -236,42 +295,29 @@ void goby::apps::zeromq::LiaisonScope::resume()
     handle_refresh();
 }
 
-void goby::apps::zeromq::LiaisonScope::inbox(
-    const std::string& group, const std::shared_ptr<const google::protobuf::Message>& msg)
+void goby::apps::zeromq::LiaisonScope::inbox(const std::string& group,
+                                             const std::shared_ptr<const ScopeCache::Value>& value)
 {
-    if (msg->ByteSizeLong() > pb_scope_config_.max_message_size_bytes())
-    {
-        glog.is_warn() && glog << "Discarding message [" << msg->GetDescriptor()->full_name()
-                               << " because it is larger than max_message_size_bytes ["
-                               << msg->ByteSizeLong() << ">"
-                               << pb_scope_config_.max_message_size_bytes() << " ]." << std::endl;
-
-        return;
-    }
+    paused_buffer_[group] = value;
+}
 
-    //  if (is_paused())
-    //  {
+void goby::apps::zeromq::LiaisonScope::history_inbox(
+    const std::string& group, const std::shared_ptr<const ScopeCache::Value>& value)
+{
     auto hist_it = history_header_div_->history_models_.find(group);
     if (hist_it != history_header_div_->history_models_.end())
     {
         // buffer for later display
-        history_header_div_->buffer_.push_back(std::make_pair(group, msg));
+        history_header_div_->buffer_.push_back(std::make_pair(group, value));
     }
-
-    paused_buffer_[group] = msg;
-    //  }
-    //  else
-    //  {
-    //      handle_message(group, *msg, true);
-    //  }
 }
 
 void goby::apps::zeromq::LiaisonScope::handle_message(const std::string& group,
-                                                      const google::protobuf::Message& msg,
+                                                      const ScopeCache::Value& value,
                                                       bool fresh_message)
 {
-    glog.is(DEBUG1) && glog << "LiaisonScope: got message:  " << msg.ShortDebugString()
-                            << std::endl;
+    glog.is(DEBUG1) && glog << "LiaisonScope: got message:  "
+                            << value.message()->ShortDebugString() << std::endl;
     auto it = msg_map_.find(group);
     if (it != msg_map_.end())
     {
@@ -280,11 +326,11 @@ void goby::apps::zeromq::LiaisonScope::handle_message(const std::string& group,
         items.push_back(model_->item(it->second, protobuf::ProtobufScopeConfig::COLUMN_TYPE));
         items.push_back(model_->item(it->second, protobuf::ProtobufScopeConfig::COLUMN_VALUE));
         items.push_back(model_->item(it->second, protobuf::ProtobufScopeConfig::COLUMN_TIME));
-        update_row(group, msg, items);
+        update_row(group, value, items);
     }
     else
     {
-        std::vector<WStandardItem*> items = create_row(group, msg);
+        std::vector<WStandardItem*> items = create_row(group, value);
         msg_map_.insert(make_pair(group, model_->rowCount()));
         model_->appendRow(items);
         history_model_->addString(group);
@@ -294,7 +340,7 @@ void goby::apps::zeromq::LiaisonScope::handle_message(const std::string& group,
 
     if (fresh_message)
     {
-        history_header_div_->display_message(group, msg);
+        history_header_div_->display_message(group, value);
     }
 }
 
@@ -479,6 +525,8 @@ void goby::apps::zeromq::LiaisonScope::HistoryContainer::add_history(
 
     if (!history_models_.count(selected_key))
     {
+        scope_->post_to_comms([=]() { scope_->goby_thread()->add_history(selected_key); });
+
         auto* new_container = new WGroupBox("History");
 
         auto* text_container = new WContainerWidget(new_container);
@@ -559,6 +607,8 @@ void goby::apps::zeromq::LiaisonScope::HistoryContainer::handle_remove_history(
 {
     glog.is(DEBUG2) && glog << "LiaisonScope: removing history for: " << key << std::endl;
 
+    scope_->post_to_comms([=]() { scope_->goby_thread()->remove_history(key); });
+
     main_layout_->removeWidget(history_models_[key].container);
     // main_layout_->removeWidget(history_models_[key].tree);
 
@@ -592,13 +642,13 @@ void goby::apps::zeromq::LiaisonScope::HistoryContainer::view_clicked(
 }
 
 void goby::apps::zeromq::LiaisonScope::HistoryContainer::display_message(
-    const std::string& group, const google::protobuf::Message& msg)
+    const std::string& group, const ScopeCache::Value& value)
 {
     auto hist_it = history_models_.find(group);
     if (hist_it != history_models_.end())
     {
         // when the pb_row children exist, Wt segfaults when removing the parent... for now don't attach pb_rows for history items
-        hist_it->second.model->appendRow(scope_->create_row(group, msg, false));
+        hist_it->second.model->appendRow(scope_->create_row(group, value, false));
         while (hist_it->second.model->rowCount() > pb_scope_config_.max_history_items())
         {
             int row_to_remove = 0;
@@ -736,3 +786,77 @@ void goby::apps::zeromq::LiaisonScope::ControlsContainer::clear_clicked_messages
 {
     while (clicked_message_stack_->children().size() > 0) remove_clicked_message(event);
 }
+
+goby::apps::zeromq::ScopeCacheThread::ScopeCacheThread(const protobuf::LiaisonConfig& config)
+    : goby::middleware::SimpleThread<protobuf::LiaisonConfig>(config)
+{
+    const auto max_size = config.pb_scope_config().max_message_size_bytes();
+    auto subscription_handler = [max_size](const std::vector<unsigned char>& data,
+                                           int /*scheme*/, const std::string& type,
+                                           const goby::middleware::Group& group) {
+        if (static_cast<int>(data.size()) > max_size)
+        {
+            glog.is_warn() && glog << "Discarding message [" << type
+                                   << " because it is larger than max_message_size_bytes ["
+                                   << data.size() << ">" << max_size << " ]." << std::endl;
+            return;
+        }
+        cache().insert(group, type, data);
+    };
+
+    interprocess().subscribe_regex(subscription_handler,
+                                   {goby::middleware::MarshallingScheme::PROTOBUF}, ".*", ".*");
+}
+
+goby::apps::zeromq::ScopeCache& goby::apps::zeromq::ScopeCacheThread::cache()
+{
+    static ScopeCache cache;
+    return cache;
+}
+
+void goby::apps::zeromq::ScopeCommsThread::loop()
+{
+    LiaisonCommsThread<LiaisonScope>::loop();
+
+    // only the values that this session displays are parsed (once, for all sessions), here
+    // rather than in the Wt thread
+    std::vector<ScopeCache::Update> updates;
+    for (auto& update : ScopeCacheThread::cache().updates(sequence_))
+    {
+        if (matches(update.group, update.value->type()) && update.value->message())
+            updates.push_back(std::move(update));
+    }
+
+    std::vector<ScopeCache::Update> history_updates;
+    for (auto& history : history_)
+    {
+        for (auto& value : ScopeCacheThread::cache().history(history.first, history.second))
+        {
+            if (value->message())
+                history_updates.push_back({history.first, std::move(value)});
+        }
+    }
+
+    if (!updates.empty() || !history_updates.empty())
+    {
+        LiaisonScope* scope = scope_;
+        scope_->post_to_wt([scope, updates, history_updates]() {
+            for (const auto& update : updates) scope->inbox(update.group, update.value);
+            for (const auto& update : history_updates)
+                scope->history_inbox(update.group, update.value);
+        });
+    }
+}
+
+bool goby::apps::zeromq::ScopeCommsThread::matches(const std::string& group,
+                                                   const std::string& type)
+{
+    std::string key = group + '\0' + type;
+    auto it = matches_.find(key);
+    if (it == matches_.end())
+    {
+        bool match = std::regex_match(type, type_regex_) && std::regex_match(group, group_regex_);
+        it = matches_.insert(std::make_pair(key, match)).first;
+    }
+    return it->second;
+}
@@ -26,9 +26,11 @@
 #define GOBY_APPS_ZEROMQ_LIAISON_LIAISON_SCOPE_H
 
 #include <algorithm>     // for max
+#include <cstdint>       // for uint64_t
 #include <map>           // for operator!=, map
 #include <memory>        // for shared_ptr, __sh...
 #include <ostream>       // for operator<<, basi...
+#include <regex>         // for regex, regex_match
 #include <set>           // for set
 #include <string>        // for string
 #include <unordered_map> // for unordered_map<>:...
@@ -42,7 +44,6 @@
 #include <Wt/WTreeView>                    // for WTreeView
 #include <boost/circular_buffer.hpp>       // for circular_buffer
 #include <boost/units/quantity.hpp>        // for operator/
-#include <dccl/dynamic_protobuf_manager.h> // for DynamicProtobufM...
 #include <google/protobuf/message.h>       // for Message
 
 #include "goby/middleware/group.h"                  // for Group
@@ -51,6 +52,9 @@
 #include "goby/zeromq/liaison/liaison_container.h"  // for LiaisonCommsThread
 #include "goby/zeromq/protobuf/liaison_config.pb.h" // for LiaisonConfig (p...
 
+#include "liaison_scope_cache.h" // for ScopeCache
+#include "liaison_scope_rate.h"  // for ScopeRateLimit
+
 namespace Wt
 {
 class WAbstractItemModel;
@@ -80,19 +84,22 @@ class LiaisonScope : public goby::zeromq::LiaisonContainerWithComms<LiaisonScope
   public:
     LiaisonScope(const protobuf::LiaisonConfig& cfg);
 
-    void inbox(const std::string& group,
-               const std::shared_ptr<const google::protobuf::Message>& msg);
+    // latest value for the group
+    void inbox(const std::string& group, const std::shared_ptr<const ScopeCache::Value>& value);
+    // every value for a group with history
+    void history_inbox(const std::string& group,
+                       const std::shared_ptr<const ScopeCache::Value>& value);
 
-    void handle_message(const std::string& group, const google::protobuf::Message& msg,
+    void handle_message(const std::string& group, const ScopeCache::Value& value,
                         bool fresh_message);
 
     std::vector<Wt::WStandardItem*> create_row(const std::string& group,
-                                               const google::protobuf::Message& msg,
+                                               const ScopeCache::Value& value,
                                                bool do_attach_pb_rows = true);
     void attach_pb_rows(const std::vector<Wt::WStandardItem*>& items,
                         const std::string& debug_string);
 
-    void update_row(const std::string& group, const google::protobuf::Message& msg,
+    void update_row(const std::string& group, const ScopeCache::Value& value,
                     const std::vector<Wt::WStandardItem*>& items, bool do_attach_pb_rows = true);
 
     void update_freq(double hertz);
@@ -137,8 +144,13 @@ class LiaisonScope : public goby::zeromq::LiaisonContainerWithComms<LiaisonScope
 
     void display_notify(const std::string& value);
 
+    // set the item's data only if it changed (Wt sends every change to the browser)
+    void set_text(Wt::WStandardItem* item, const std::string& text);
+    void set_data(Wt::WStandardItem* item, const std::string& data, int role);
+
   private:
     const protobuf::ProtobufScopeConfig& pb_scope_config_;
+    ScopeRateLimit rate_limit_;
 
     Wt::WStringListModel* history_model_;
     Wt::WStandardItemModel* model_;
@@ -176,7 +188,7 @@ class LiaisonScope : public goby::zeromq::LiaisonContainerWithComms<LiaisonScope
         void handle_remove_history(const std::string& type);
         void add_history(const protobuf::ProtobufScopeConfig::HistoryConfig& config);
         void toggle_history_plot(Wt::WWidget* plot);
-        void display_message(const std::string& group, const google::protobuf::Message& msg);
+        void display_message(const std::string& group, const ScopeCache::Value& value);
         void flush_buffer();
 
         void view_clicked(const Wt::WModelIndex& proxy_index, const Wt::WMouseEvent& event,
@@ -200,8 +212,7 @@ class LiaisonScope : public goby::zeromq::LiaisonContainerWithComms<LiaisonScope
         Wt::WComboBox* history_box_;
         Wt::WPushButton* history_button_;
 
-        boost::circular_buffer<
-            std::pair<std::string, std::shared_ptr<const google::protobuf::Message>>>
+        boost::circular_buffer<std::pair<std::string, std::shared_ptr<const ScopeCache::Value>>>
             buffer_;
         LiaisonScope* scope_;
     };
@@ -279,7 +290,7 @@ class LiaisonScope : public goby::zeromq::LiaisonContainerWithComms<LiaisonScope
     // maps group into row
     std::map<std::string, int> msg_map_;
 
-    std::map<std::string, std::shared_ptr<const google::protobuf::Message>> paused_buffer_;
+    std::map<std::string, std::shared_ptr<const ScopeCache::Value>> paused_buffer_;
 };
 
 class LiaisonScopeProtobufTreeView : public Wt::WTreeView
@@ -299,47 +310,76 @@ class LiaisonScopeProtobufModel : public Wt::WStandardItemModel
                               Wt::WContainerWidget* parent = nullptr);
 };
 
+/// \brief Subscribes to all the interprocess Protobuf messages on behalf of all the LiaisonScope sessions, and stores them in the cache()
+class ScopeCacheThread : public goby::middleware::SimpleThread<protobuf::LiaisonConfig>
+{
+  public:
+    ScopeCacheThread(const protobuf::LiaisonConfig& config);
+
+    static ScopeCache& cache();
+};
+
+// pulls the changes of interest to a session from ScopeCacheThread::cache() at the update frequency
 class ScopeCommsThread : public goby::zeromq::LiaisonCommsThread<LiaisonScope>
 {
   public:
     ScopeCommsThread(LiaisonScope* scope, const protobuf::LiaisonConfig& config, int index)
-        : LiaisonCommsThread<LiaisonScope>(scope, config, index), scope_(scope)
+        : LiaisonCommsThread<LiaisonScope>(scope, config, index),
+          scope_(scope),
+          max_history_items_(config.pb_scope_config().max_history_items())
     {
-        auto subscription_handler = [this](const std::vector<unsigned char>& data, int /*scheme*/,
-                                           const std::string& type,
-                                           const goby::middleware::Group& group) {
-            std::string gr = group;
-            try
-            {
-                auto pb_msg = dccl::DynamicProtobufManager::new_protobuf_message<
-                    std::shared_ptr<google::protobuf::Message>>(type);
-                pb_msg->ParseFromArray(&data[0], data.size());
-                scope_->post_to_wt([=]() { scope_->inbox(gr, pb_msg); });
-            }
-            catch (const std::exception& e)
-            {
-                goby::glog.is_warn() && goby::glog << "Unhandled subscription: " << e.what()
-                                                   << std::endl;
-            }
-        };
-
-        regex_subscription_ = interprocess().subscribe_regex(
-            subscription_handler, {goby::middleware::MarshallingScheme::PROTOBUF}, ".*", ".*");
     }
-    ~ScopeCommsThread() override = default;
+    ~ScopeCommsThread() override
+    {
+        for (const auto& history : history_)
+            ScopeCacheThread::cache().remove_history(history.first);
+    }
+
+    void loop() override;
 
     void update_subscription(std::string group_regex, std::string type_regex)
     {
         glog.is_debug1() && glog << "Updated subscriptions with group: [" << group_regex
                                  << "], type: [" << type_regex << "]" << std::endl;
-        regex_subscription_->update_group_regex(group_regex);
-        regex_subscription_->update_type_regex(type_regex);
+        group_regex_.assign(group_regex);
+        type_regex_.assign(type_regex);
+        matches_.clear();
+        // resend everything that now matches
+        sequence_ = 0;
     }
 
+    void add_history(const std::string& group)
+    {
+        if (!history_.count(group))
+        {
+            ScopeCacheThread::cache().add_history(group, max_history_items_);
+            history_.insert(std::make_pair(group, 0));
+        }
+    }
+
+    void remove_history(const std::string& group)
+    {
+        if (history_.erase(group))
+            ScopeCacheThread::cache().remove_history(group);
+    }
+
+  private:
+    bool matches(const std::string& group, const std::string& type);
+
   private:
     friend class LiaisonScope;
     LiaisonScope* scope_;
-    std::shared_ptr<middleware::SerializationSubscriptionRegex> regex_subscription_;
+    const int max_history_items_;
+
+    std::regex group_regex_{".*"};
+    std::regex type_regex_{".*"};
+    // group + '\0' + type -> matches the regexes
+    std::unordered_map<std::string, bool> matches_;
+
+    // last sequence number received from the cache
+    std::uint64_t sequence_{0};
+    // group -> last sequence number received for its history
+    std::map<std::string, std::uint64_t> history_;
 };
 
 } // namespace zeromq
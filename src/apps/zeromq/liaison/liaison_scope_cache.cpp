@@ -0,0 +1,123 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm> // for max
+
+#include <dccl/dynamic_protobuf_manager.h> // for DynamicProtobufManager
+
+#include "goby/util/debug_logger/flex_ostream.h" // for FlexOstream, glog
+
+#include "liaison_scope_cache.h"
+
+using goby::glog;
+
+std::shared_ptr<const google::protobuf::Message>
+goby::apps::zeromq::ScopeCache::Value::message() const
+{
+    std::call_once(parse_flag_, [this]() {
+        try
+        {
+            auto pb_msg = dccl::DynamicProtobufManager::new_protobuf_message<
+                std::shared_ptr<google::protobuf::Message>>(type_);
+            if (pb_msg->ParseFromArray(data_.data(), data_.size()))
+                message_ = pb_msg;
+            else
+                glog.is_warn() && glog << "Failed to parse message of type " << type_ << " ("
+                                       << data_.size() << " bytes)" << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            glog.is_warn() && glog << "Unhandled subscription: " << e.what() << std::endl;
+        }
+    });
+    return message_;
+}
+
+void goby::apps::zeromq::ScopeCache::insert(const std::string& group, const std::string& type,
+                                            std::vector<unsigned char> data)
+{
+    auto now = goby::time::SystemClock::now();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto value = std::make_shared<const Value>(type, std::move(data), ++sequence_, now);
+
+    auto it = latest_.find(Key(group, type));
+    if (it == latest_.end())
+        it = latest_.insert(std::make_pair(Key(group, type), value)).first;
+    else
+    {
+        changes_.erase(it->second->sequence());
+        it->second = value;
+    }
+    changes_.insert(std::make_pair(value->sequence(), &it->first));
+
+    auto hist_it = history_.find(group);
+    if (hist_it != history_.end())
+        hist_it->second.values.push_back(value);
+}
+
+std::vector<goby::apps::zeromq::ScopeCache::Update>
+goby::apps::zeromq::ScopeCache::updates(std::uint64_t& since) const
+{
+    std::vector<Update> updates;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = changes_.upper_bound(since), end = changes_.end(); it != end; ++it)
+        updates.push_back({it->second->first, latest_.at(*it->second)});
+    since = sequence_;
+    return updates;
+}
+
+void goby::apps::zeromq::ScopeCache::add_history(const std::string& group, std::size_t max_items)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& history = history_[group];
+    ++history.users;
+    if (history.values.capacity() < max_items)
+        history.values.set_capacity(max_items);
+}
+
+void goby::apps::zeromq::ScopeCache::remove_history(const std::string& group)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = history_.find(group);
+    if (it != history_.end() && --it->second.users <= 0)
+        history_.erase(it);
+}
+
+std::vector<std::shared_ptr<const goby::apps::zeromq::ScopeCache::Value>>
+goby::apps::zeromq::ScopeCache::history(const std::string& group, std::uint64_t& since) const
+{
+    std::vector<std::shared_ptr<const Value>> values;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = history_.find(group);
+    if (it != history_.end())
+    {
+        for (const auto& value : it->second.values)
+        {
+            if (value->sequence() > since)
+                values.push_back(value);
+        }
+    }
+    since = std::max(since, sequence_);
+    return values;
+}
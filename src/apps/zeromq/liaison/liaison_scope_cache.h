@@ -0,0 +1,123 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_APPS_ZEROMQ_LIAISON_LIAISON_SCOPE_CACHE_H
+#define GOBY_APPS_ZEROMQ_LIAISON_LIAISON_SCOPE_CACHE_H
+
+#include <cstdint> // for uint64_t
+#include <map>     // for map
+#include <memory>  // for shared_ptr
+#include <mutex>   // for mutex, once_flag
+#include <string>  // for string
+#include <utility> // for pair
+#include <vector>  // for vector
+
+#include <boost/circular_buffer.hpp> // for circular_buffer
+#include <google/protobuf/message.h> // for Message
+
+#include "goby/time/system_clock.h" // for SystemClock
+
+namespace goby
+{
+namespace apps
+{
+namespace zeromq
+{
+/// \brief Latest value for each (group, type) received by the scope, shared by all the browser sessions
+///
+/// Messages are stored serialized and parsed at most once (on first request by any session), so the decoding cost does not grow with the number of sessions, and messages that no session displays are never parsed. All methods are thread-safe.
+class ScopeCache
+{
+  public:
+    class Value
+    {
+      public:
+        Value(std::string type, std::vector<unsigned char> data, std::uint64_t sequence,
+              goby::time::SystemClock::time_point time)
+            : type_(std::move(type)), data_(std::move(data)), sequence_(sequence), time_(time)
+        {
+        }
+
+        /// \brief Parsed message (nullptr if the type is unknown or the data cannot be parsed)
+        std::shared_ptr<const google::protobuf::Message> message() const;
+
+        const std::string& type() const { return type_; }
+        std::uint64_t sequence() const { return sequence_; }
+        goby::time::SystemClock::time_point time() const { return time_; }
+
+      private:
+        const std::string type_;
+        const std::vector<unsigned char> data_;
+        const std::uint64_t sequence_;
+        const goby::time::SystemClock::time_point time_;
+
+        mutable std::once_flag parse_flag_;
+        mutable std::shared_ptr<const google::protobuf::Message> message_;
+    };
+
+    struct Update
+    {
+        std::string group;
+        std::shared_ptr<const Value> value;
+    };
+
+    void insert(const std::string& group, const std::string& type,
+                std::vector<unsigned char> data);
+
+    /// \brief Returns the latest values that changed after the given sequence number (oldest first), and sets it to the most recent
+    ///
+    /// \param since Sequence number returned by the previous call, or 0 for all values
+    std::vector<Update> updates(std::uint64_t& since) const;
+
+    /// \brief Start (or, for additional callers, continue) keeping every value received for the group, up to max_items
+    void add_history(const std::string& group, std::size_t max_items);
+    /// \brief Called once for each add_history() call when the history is no longer needed
+    void remove_history(const std::string& group);
+
+    /// \brief Returns the values kept for the group since add_history() that were received after the given sequence number (oldest first), and sets it to the most recent
+    std::vector<std::shared_ptr<const Value>> history(const std::string& group,
+                                                      std::uint64_t& since) const;
+
+  private:
+    using Key = std::pair<std::string, std::string>; // group, type
+
+    mutable std::mutex mutex_;
+    std::uint64_t sequence_{0};
+
+    std::map<Key, std::shared_ptr<const Value>> latest_;
+    // sequence of the latest value -> its key, to find the changes since a given sequence
+    std::map<std::uint64_t, const Key*> changes_;
+
+    struct History
+    {
+        int users{0};
+        boost::circular_buffer<std::shared_ptr<const Value>> values;
+    };
+    std::map<std::string, History> history_;
+};
+
+} // namespace zeromq
+} // namespace apps
+} // namespace goby
+
+#endif
@@ -0,0 +1,64 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm> // for max
+#include <cmath>     // for abs
+
+#include "liaison_scope_rate.h"
+
+goby::apps::zeromq::ScopeRateLimit::Clock::duration
+goby::apps::zeromq::ScopeRateLimit::row_interval() const
+{
+    double scope_interval = 1.0 / scope_update_freq_;
+    double interval = scope_interval;
+    if (max_row_update_freq_ > 0)
+        interval = std::max(interval, 1.0 / max_row_update_freq_);
+    interval *= row_interval_scale_;
+
+    // less half a scope interval so that rows due around the next refresh are updated on it
+    return std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(interval - 0.5 * scope_interval));
+}
+
+bool goby::apps::zeromq::ScopeRateLimit::update(Clock::time_point now)
+{
+    if (max_bytes_per_second_ <= 0)
+        return false;
+
+    double window = std::chrono::duration<double>(now - window_start_).count();
+    if (window < 1)
+        return false;
+
+    // the bytes sent scale approximately with the inverse of the row interval, so scale it by the
+    // fraction over (or under) budget, averaged with the previous scale to smooth bursts
+    last_rate_ = bytes_sent_ / window;
+    double scale = row_interval_scale_ * last_rate_ / max_bytes_per_second_;
+    double new_scale = std::max(1.0, 0.5 * (row_interval_scale_ + scale));
+
+    bool changed = std::abs(new_scale - row_interval_scale_) > 0.1 * row_interval_scale_;
+
+    row_interval_scale_ = new_scale;
+    bytes_sent_ = 0;
+    window_start_ = now;
+    return changed;
+}
@@ -0,0 +1,111 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_APPS_ZEROMQ_LIAISON_LIAISON_SCOPE_RATE_H
+#define GOBY_APPS_ZEROMQ_LIAISON_LIAISON_SCOPE_RATE_H
+
+#include <chrono>  // for steady_clock
+#include <cstddef> // for size_t
+#include <map>     // for map
+#include <string>  // for string
+
+namespace goby
+{
+namespace apps
+{
+namespace zeromq
+{
+/// \brief Row update interval and bandwidth budget for one LiaisonScope session
+///
+/// Each row (group) is redrawn at most once per row_interval(). If a byte budget is set, the bytes of row changes are compared against it once a second and the interval is scaled (smoothed, never below the configured rate) so the traffic fits.
+///
+/// Uses the real (unwarped) steady clock, as this paces traffic to the browser.
+class ScopeRateLimit
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /// \param max_row_update_freq maximum rate (Hz) that each row is redrawn (0 for no limit beyond the scope update rate)
+    /// \param max_bytes_per_second approximate budget for row changes sent to the session (0 for none)
+    /// \param start start of the first budget window
+    ScopeRateLimit(double max_row_update_freq, double max_bytes_per_second,
+                   Clock::time_point start = Clock::now())
+        : max_row_update_freq_(max_row_update_freq),
+          max_bytes_per_second_(max_bytes_per_second),
+          window_start_(start)
+    {
+    }
+
+    /// \brief Set the rate of the scope refresh timer (Hz)
+    void set_scope_update_freq(double hertz) { scope_update_freq_ = hertz; }
+
+    /// \brief Is the row for this group due to be redrawn?
+    bool row_due(const std::string& group, Clock::time_point now) const
+    {
+        auto it = row_next_update_.find(group);
+        return it == row_next_update_.end() || now >= it->second;
+    }
+
+    /// \brief Record that the row for this group was redrawn
+    void row_updated(const std::string& group, Clock::time_point now)
+    {
+        row_next_update_[group] = now + row_interval();
+    }
+
+    /// \brief Minimum time between redraws of a row
+    Clock::duration row_interval() const;
+
+    /// \brief Add the size of a change sent to the browser
+    void add_bytes(std::size_t bytes) { bytes_sent_ += bytes; }
+
+    /// \brief Once per second (of \c now), rescale the row interval to fit the byte budget
+    ///
+    /// \return true if the scale changed by more than 10%
+    bool update(Clock::time_point now);
+
+    /// \brief Bytes of row changes in the current budget window
+    std::size_t bytes_sent() const { return bytes_sent_; }
+    /// \brief Rate (bytes/s) measured over the last complete budget window
+    double last_rate() const { return last_rate_; }
+    /// \brief Current multiplier on the row update interval
+    double row_interval_scale() const { return row_interval_scale_; }
+
+  private:
+    const double max_row_update_freq_;
+    const double max_bytes_per_second_;
+    double scope_update_freq_{1};
+
+    // group -> earliest time the row may be redrawn again
+    std::map<std::string, Clock::time_point> row_next_update_;
+    // multiplies the row update interval to fit max_bytes_per_second_
+    double row_interval_scale_{1};
+    // bytes of row changes since window_start_
+    std::size_t bytes_sent_{0};
+    Clock::time_point window_start_;
+    double last_rate_{0};
+};
+} // namespace zeromq
+} // namespace apps
+} // namespace goby
+
+#endif
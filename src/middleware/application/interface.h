@@ -36,6 +36,9 @@
 
 #include "goby/exception.h"
 #include "goby/middleware/application/configurator.h"
+#include "goby/middleware/application/scheduling.h"
+#include "goby/middleware/coroner/profiler.h"
+#include "goby/middleware/io/io_context_pool.h"
 #include "goby/middleware/marshalling/detail/dccl_serializer_parser.h"
 #include "goby/middleware/protobuf/app_config.pb.h"
 #include "goby/time.h"
@@ -76,6 +79,8 @@ template <typename Config> class Application
     virtual ~Application()
     {
         goby::glog.is_debug2() && goby::glog << "Application: destructing cleanly" << std::endl;
+        // write out any queued messages while the attached streams are guaranteed to exist
+        goby::glog.disable_async();
     }
 
     using ConfigType = Config;
@@ -140,6 +145,11 @@ template <typename Config> class Application
 
     void configure_logger();
 
+    // opens the file for file_log or binary_log
+    template <typename FileLogConfig>
+    std::unique_ptr<std::ofstream> open_glog_file(const FileLogConfig& file_log,
+                                                  std::ios_base::openmode mode);
+
   private:
     // sets configuration (before Application construction)
     static std::unique_ptr<Config> app_cfg_;
@@ -150,6 +160,7 @@ template <typename Config> class Application
 
     // static here allows fout_ to live until program exit to log glog output
     static std::unique_ptr<std::ofstream> fout_;
+    static std::unique_ptr<std::ofstream> binary_fout_;
 
     std::unique_ptr<goby::util::UTMGeodesy> geodesy_;
 };
@@ -159,6 +170,8 @@ template <typename Config> class Application
 
 template <typename Config>
 std::unique_ptr<std::ofstream> goby::middleware::Application<Config>::fout_;
+template <typename Config>
+std::unique_ptr<std::ofstream> goby::middleware::Application<Config>::binary_fout_;
 
 template <typename Config> std::unique_ptr<Config> goby::middleware::Application<Config>::app_cfg_;
 
@@ -175,6 +188,15 @@ template <typename Config> goby::middleware::Application<Config>::Application()
         configure_geodesy({app3_base_configuration_->geodesy().lat_origin_with_units(),
                            app3_base_configuration_->geodesy().lon_origin_with_units()});
 
+    if (app3_base_configuration_->io_pool().threads() > 0)
+        io::IOContextPool::configure(app3_base_configuration_->io_pool().threads());
+
+    if (app3_base_configuration_->scheduling().mlockall())
+        lock_memory();
+
+    if (app3_base_configuration_->callback_profiling().enable())
+        CallbackProfiler::configure(app3_base_configuration_->callback_profiling());
+
     if (!app3_base_configuration_->IsInitialized())
         throw(middleware::ConfigException("Invalid base configuration"));
 
@@ -199,56 +221,77 @@ template <typename Config> void goby::middleware::Application<Config>::configure
     if (app3_base_configuration_->glog_config().has_file_log())
     {
         const auto& file_log = app3_base_configuration_->glog_config().file_log();
-        std::string file_format_str;
+        fout_ = open_glog_file(file_log, std::ios_base::out);
+        glog.add_stream(file_log.verbosity(), fout_.get());
+    }
 
-        if (file_log.has_file_dir() && !file_log.file_dir().empty())
-        {
-            auto file_dir = file_log.file_dir();
-            if (file_dir.back() != '/')
-                file_dir += "/";
-            file_format_str = file_dir + file_log.file_name();
-        }
-        else
-        {
-            file_format_str = file_log.file_name();
-        }
+    if (app3_base_configuration_->glog_config().has_binary_log())
+    {
+        const auto& binary_log = app3_base_configuration_->glog_config().binary_log();
+        binary_fout_ = open_glog_file(binary_log, std::ios_base::out | std::ios_base::binary);
+        glog.add_binary_stream(static_cast<util::logger::Verbosity>(binary_log.verbosity()),
+                               binary_fout_.get());
+    }
 
-        boost::format file_format(file_format_str);
+    if (app3_base_configuration_->glog_config().show_dccl_log())
+        goby::middleware::detail::DCCLSerializerParserHelperBase::setup_dlog();
 
-        if (file_format_str.find("%1") == std::string::npos)
-            glog.is_die() &&
-                glog << "file_name string must contain \"%1%\" which is expanded to the current "
-                        "application start time (e.g. 20190201T184925). Erroneous file_name is: "
-                     << file_format_str << std::endl;
+    if (app3_base_configuration_->glog_config().has_async())
+        glog.enable_async(app3_base_configuration_->glog_config().async());
+}
 
-        file_format.exceptions(boost::io::all_error_bits ^
-                               (boost::io::too_many_args_bit | boost::io::too_few_args_bit));
+template <typename Config>
+template <typename FileLogConfig>
+std::unique_ptr<std::ofstream>
+goby::middleware::Application<Config>::open_glog_file(const FileLogConfig& file_log,
+                                                      std::ios_base::openmode mode)
+{
+    using goby::glog;
 
-        std::string file_name =
-            (file_format % goby::time::file_str() % app3_base_configuration_->name()).str();
-        std::string file_symlink =
-            (file_format % "latest" % app3_base_configuration_->name()).str();
+    std::string file_format_str;
 
-        glog.is_verbose() && glog << "logging output to file: " << file_name << std::endl;
+    if (file_log.has_file_dir() && !file_log.file_dir().empty())
+    {
+        auto file_dir = file_log.file_dir();
+        if (file_dir.back() != '/')
+            file_dir += "/";
+        file_format_str = file_dir + file_log.file_name();
+    }
+    else
+    {
+        file_format_str = file_log.file_name();
+    }
 
-        fout_.reset(new std::ofstream(file_name.c_str()));
+    boost::format file_format(file_format_str);
 
-        if (!fout_->is_open())
-            glog.is_die() && glog << "cannot write glog output to requested file: " << file_name
-                                  << std::endl;
+    if (file_format_str.find("%1") == std::string::npos)
+        glog.is_die() &&
+            glog << "file_name string must contain \"%1%\" which is expanded to the current "
+                    "application start time (e.g. 20190201T184925). Erroneous file_name is: "
+                 << file_format_str << std::endl;
 
-        remove(file_symlink.c_str());
-        int result = symlink(realpath(file_name.c_str(), NULL), file_symlink.c_str());
-        if (result != 0)
-            glog.is_warn() &&
-                glog << "Cannot create symlink to latest file. Continuing onwards anyway"
-                     << std::endl;
+    file_format.exceptions(boost::io::all_error_bits ^
+                           (boost::io::too_many_args_bit | boost::io::too_few_args_bit));
 
-        glog.add_stream(file_log.verbosity(), fout_.get());
-    }
+    std::string file_name =
+        (file_format % goby::time::file_str() % app3_base_configuration_->name()).str();
+    std::string file_symlink = (file_format % "latest" % app3_base_configuration_->name()).str();
 
-    if (app3_base_configuration_->glog_config().show_dccl_log())
-        goby::middleware::detail::DCCLSerializerParserHelperBase::setup_dlog();
+    glog.is_verbose() && glog << "logging output to file: " << file_name << std::endl;
+
+    std::unique_ptr<std::ofstream> fout(new std::ofstream(file_name.c_str(), mode));
+
+    if (!fout->is_open())
+        glog.is_die() && glog << "cannot write glog output to requested file: " << file_name
+                              << std::endl;
+
+    remove(file_symlink.c_str());
+    int result = symlink(realpath(file_name.c_str(), NULL), file_symlink.c_str());
+    if (result != 0)
+        glog.is_warn() && glog << "Cannot create symlink to latest file. Continuing onwards anyway"
+                               << std::endl;
+
+    return fout;
 }
 
 template <typename Config>
@@ -315,6 +358,20 @@ int goby::run(const goby::middleware::ConfiguratorInterface<typename App::Config
                 goby::time::SimulatorSettings::reference_time =
                     std::chrono::system_clock::time_point(std::chrono::microseconds(
                         App::app3_base_configuration_->simulation().time().reference_microtime()));
+
+            if (App::app3_base_configuration_->simulation().time().has_discrete_event())
+            {
+                const auto& discrete_event =
+                    App::app3_base_configuration_->simulation().time().discrete_event();
+                goby::time::SimulatorSettings::discrete_event = true;
+                goby::time::SimulatorSettings::discrete_event_time =
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        goby::time::SimulatorSettings::reference_time.time_since_epoch())
+                        .count();
+                goby::time::SimulatorSettings::discrete_event_settle_time =
+                    std::chrono::microseconds(
+                        static_cast<std::int64_t>(discrete_event.settle_time() * 1e6));
+            }
         }
 
         // instantiate the application (with the configuration already set)
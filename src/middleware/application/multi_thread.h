@@ -179,6 +179,11 @@ class MultiThreadApplicationBase : public goby::middleware::Application<Config>,
     {
         goby::glog.set_lock_action(goby::util::logger_lock::lock);
 
+        // before launching any threads, which inherit these settings
+        MainThreadBase::set_scheduling(
+            thread_scheduling(this->app_cfg().app().scheduling(), this->app_name()));
+        MainThreadBase::apply_scheduling();
+
         interthread_.template subscribe<MainThreadBase::joinable_group_>(
             [this](const ThreadIdentifier& joinable) {
                 _join_thread(joinable.type_i, joinable.index);
@@ -325,7 +330,11 @@ class MultiThreadApplication
             this->app_cfg());
 
         if (this->app_cfg().app().health_cfg().run_health_monitor_thread())
-            this->template launch_thread_without_cfg<HealthMonitorThread>();
+            this->template launch_thread<HealthMonitorThread>(
+                this->app_cfg().app().health_cfg());
+
+        if (this->app_cfg().app().transport_metrics().enable())
+            this->template launch_thread<TransportMetricsThread>(this->app_cfg().app());
     }
 
     virtual ~MultiThreadApplication() {}
@@ -443,6 +452,8 @@ void goby::middleware::MultiThreadApplicationBase<Config, Transporter>::_launch_
             goby_thread->set_name(thread_manager.name);
             goby_thread->set_type_index(type_i);
             goby_thread->set_uid(thread_manager.uid);
+            goby_thread->set_scheduling(
+                thread_scheduling(this->app_cfg().app().scheduling(), thread_manager.name));
             goby_thread->run(thread_manager.alive);
         }
         catch (...)
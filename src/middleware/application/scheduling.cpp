@@ -0,0 +1,182 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm> // for max
+#include <cerrno>    // for errno
+#include <cstring>   // for strerror
+#include <ostream>   // for endl, basic_ostream
+#include <string>    // for string, to_string
+
+#include <pthread.h>      // for pthread_self, pthread_setschedparam
+#include <sched.h>        // for sched_param, SCHED_FIFO, CPU_SET
+#include <sys/mman.h>     // for mlockall, MCL_CURRENT, MCL_FUTURE
+#include <sys/resource.h> // for setpriority, getpriority, PRIO_PROCESS
+
+#include "goby/middleware/common.h" // for gettid
+#include "goby/util/debug_logger.h"  // for glog
+
+#include "scheduling.h"
+
+using goby::glog;
+using goby::middleware::protobuf::ThreadScheduling;
+
+namespace
+{
+void warn(const std::string& setting, int error)
+{
+    glog.is_warn() && glog << "Could not set " << setting << " for thread "
+                           << goby::middleware::gettid() << ": " << std::strerror(error)
+                           << std::endl;
+}
+
+int native_policy(ThreadScheduling::Policy policy)
+{
+    switch (policy)
+    {
+        case ThreadScheduling::OTHER: break;
+        case ThreadScheduling::FIFO: return SCHED_FIFO;
+        case ThreadScheduling::RR: return SCHED_RR;
+    }
+    return SCHED_OTHER;
+}
+
+ThreadScheduling::Policy policy_from_native(int policy)
+{
+    switch (policy)
+    {
+        case SCHED_FIFO: return ThreadScheduling::FIFO;
+        case SCHED_RR: return ThreadScheduling::RR;
+        default: return ThreadScheduling::OTHER;
+    }
+}
+} // namespace
+
+goby::middleware::protobuf::ThreadScheduling
+goby::middleware::thread_scheduling(const protobuf::AppConfig::Scheduling& cfg,
+                                    const std::string& name)
+{
+    ThreadScheduling scheduling = cfg.default_thread();
+    for (const auto& thread : cfg.thread())
+    {
+        if (thread.name() == name)
+        {
+            // replace rather than append to the default CPU list
+            if (thread.scheduling().cpu_size() > 0)
+                scheduling.clear_cpu();
+            scheduling.MergeFrom(thread.scheduling());
+        }
+    }
+    return scheduling;
+}
+
+goby::middleware::protobuf::ThreadScheduling
+goby::middleware::apply_thread_scheduling(const protobuf::ThreadScheduling& cfg)
+{
+    ThreadScheduling applied;
+
+    if (cfg.cpu_size() > 0)
+    {
+#ifdef __APPLE__
+        glog.is_warn() && glog << "CPU affinity is not supported on this platform" << std::endl;
+#else
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (auto cpu : cfg.cpu())
+        {
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &cpus);
+        }
+        if (int error = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus))
+            warn("CPU affinity", error);
+
+        CPU_ZERO(&cpus);
+        if (pthread_getaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0)
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &cpus))
+                    applied.add_cpu(cpu);
+            }
+        }
+#endif
+    }
+
+    if (cfg.has_policy() || cfg.has_priority())
+    {
+        int policy;
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &policy, &param);
+        if (cfg.has_policy())
+            policy = native_policy(cfg.policy());
+
+        // the static priority must be zero for SCHED_OTHER and within [min, max] for FIFO/RR
+        if (policy == SCHED_OTHER)
+            param.sched_priority = 0;
+        else if (cfg.has_priority())
+            param.sched_priority = cfg.priority();
+        else
+            param.sched_priority =
+                std::max(param.sched_priority, sched_get_priority_min(policy));
+
+        if (int error = pthread_setschedparam(pthread_self(), policy, &param))
+            warn("scheduling policy " + std::to_string(policy) + " with priority " +
+                     std::to_string(param.sched_priority),
+                 error);
+
+        if (pthread_getschedparam(pthread_self(), &policy, &param) == 0)
+        {
+            applied.set_policy(policy_from_native(policy));
+            if (policy != SCHED_OTHER)
+                applied.set_priority(param.sched_priority);
+        }
+    }
+
+    if (cfg.has_nice())
+    {
+#ifdef __APPLE__
+        glog.is_warn() && glog << "Per-thread nice level is not supported on this platform"
+                               << std::endl;
+#else
+        // on Linux, the nice level is a per-thread attribute
+        if (setpriority(PRIO_PROCESS, gettid(), cfg.nice()) != 0)
+            warn("nice level " + std::to_string(cfg.nice()), errno);
+
+        errno = 0;
+        int nice = getpriority(PRIO_PROCESS, gettid());
+        if (errno == 0)
+            applied.set_nice(nice);
+#endif
+    }
+
+    glog.is_debug1() && glog << "Thread " << gettid()
+                             << " scheduling: " << applied.ShortDebugString() << std::endl;
+
+    return applied;
+}
+
+void goby::middleware::lock_memory()
+{
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        glog.is_warn() && glog << "Could not lock memory (mlockall): " << std::strerror(errno)
+                               << std::endl;
+}
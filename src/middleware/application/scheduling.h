@@ -0,0 +1,52 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_APPLICATION_SCHEDULING_H
+#define GOBY_MIDDLEWARE_APPLICATION_SCHEDULING_H
+
+#include <string> // for string
+
+#include "goby/middleware/protobuf/app_config.pb.h"        // for AppConfig
+#include "goby/middleware/protobuf/thread_scheduling.pb.h" // for ThreadScheduling
+
+namespace goby
+{
+namespace middleware
+{
+/// \brief Returns the settings for the thread with the given name: AppConfig::Scheduling::default_thread, with any fields set in a matching AppConfig::Scheduling::Thread replacing those of the default
+protobuf::ThreadScheduling thread_scheduling(const protobuf::AppConfig::Scheduling& cfg,
+                                             const std::string& name);
+
+/// \brief Applies the CPU affinity, scheduling policy and priority, and nice level to the calling thread
+///
+/// Settings that cannot be applied (e.g. for lack of privileges) are reported as a warning to goby::glog, rather than throwing an exception.
+/// \return The settings in effect for the calling thread afterwards (only the fields set in cfg are filled)
+protobuf::ThreadScheduling apply_thread_scheduling(const protobuf::ThreadScheduling& cfg);
+
+/// \brief Locks all current and future pages of the process into memory (mlockall), warning to goby::glog on failure
+void lock_memory();
+
+} // namespace middleware
+} // namespace goby
+
+#endif
@@ -76,6 +76,10 @@ class SingleThreadApplication : public goby::middleware::Application<Config>,
     {
         this->set_transporter(&intervehicle_);
 
+        this->set_scheduling(
+            thread_scheduling(this->app_cfg().app().scheduling(), this->app_name()));
+        this->apply_scheduling();
+
         // handle goby_terminate request
         this->interprocess()
             .template subscribe<groups::terminate_request, protobuf::TerminateRequest>(
@@ -98,6 +102,8 @@ class SingleThreadApplication : public goby::middleware::Application<Config>,
                 resp.set_name(this->app_name());
                 resp.set_pid(getpid());
                 this->thread_health(*resp.mutable_main());
+                if (this->app_cfg().app().health_cfg().sample_resources())
+                    resources_.sample(resp);
                 this->interprocess().template publish<groups::health_response>(resp);
             });
 
@@ -109,6 +115,16 @@ class SingleThreadApplication : public goby::middleware::Application<Config>,
 
         this->interprocess().template publish<goby::middleware::groups::configuration>(
             this->app_cfg());
+
+        if (this->app_cfg().app().transport_metrics().enable())
+        {
+            TransportMetrics::set_enabled(true);
+            transport_metrics_interval_ = goby::time::convert_duration<decltype(
+                transport_metrics_interval_)>(
+                this->app_cfg().app().transport_metrics().report_interval_with_units());
+            next_transport_metrics_time_ =
+                goby::time::SteadyClock::now() + transport_metrics_interval_;
+        }
     }
 
     virtual ~SingleThreadApplication() {}
@@ -127,7 +143,24 @@ class SingleThreadApplication : public goby::middleware::Application<Config>,
     virtual void post_initialize() override { interprocess().ready(); };
 
   private:
-    void run() override { MainThread::run_once(); }
+    void run() override
+    {
+        MainThread::run_once();
+
+        if (TransportMetrics::enabled() &&
+            goby::time::SteadyClock::now() >= next_transport_metrics_time_)
+        {
+            protobuf::TransportMetrics metrics = TransportMetrics::summary();
+            metrics.set_name(this->app_name());
+            this->interprocess().template publish<groups::transport_metrics>(metrics);
+            next_transport_metrics_time_ += transport_metrics_interval_;
+        }
+    }
+
+  private:
+    ResourceSampler resources_;
+    goby::time::SteadyClock::duration transport_metrics_interval_{0};
+    goby::time::SteadyClock::time_point next_transport_metrics_time_;
 };
 
 } // namespace middleware
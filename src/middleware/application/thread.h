@@ -37,9 +37,12 @@
 #include "goby/middleware/marshalling/interface.h"
 #include "goby/middleware/protobuf/coroner.pb.h"
 
+#include "goby/middleware/application/scheduling.h"
 #include "goby/middleware/common.h"
+#include "goby/middleware/coroner/profiler.h"
 #include "goby/middleware/group.h"
-#include "goby/time/simulation.h"
+#include "goby/time/discrete_event.h"
+#include "goby/time/steady_clock.h"
 
 namespace goby
 {
@@ -63,7 +66,8 @@ template <typename Config, typename TransporterType> class Thread
     TransporterType* transporter_{nullptr};
 
     boost::units::quantity<boost::units::si::frequency> loop_frequency_;
-    std::chrono::steady_clock::time_point loop_time_;
+    // in (possibly warped or discrete event) simulation time
+    time::SteadyClock::time_point loop_time_;
     unsigned long long loop_count_{0};
     const Config cfg_;
     int index_;
@@ -84,6 +88,10 @@ template <typename Config, typename TransporterType> class Thread
 
     bool finalize_run_{false};
 
+    // requested CPU affinity, scheduling policy, etc. and those in effect after applying them
+    protobuf::ThreadScheduling scheduling_cfg_;
+    protobuf::ThreadScheduling scheduling_;
+
   public:
     using Transporter = TransporterType;
 
@@ -131,9 +139,26 @@ template <typename Config, typename TransporterType> class Thread
     void run(std::atomic<bool>& alive)
     {
         alive_ = &alive;
-        do_subscribe();
-        initialize();
-        while (alive) { run_once(); }
+        apply_scheduling();
+        // hold the simulation time until this thread first waits
+        if (time::DiscreteEventClock::enabled())
+            time::DiscreteEventClock::add_participant();
+        try
+        {
+            do_subscribe();
+            initialize();
+            while (alive) { run_once(); }
+        }
+        catch (...)
+        {
+            // shut down (e.g. close I/O objects) before the exception destroys this thread
+            if (!finalize_run_)
+            {
+                finalize_run_ = true;
+                finalize();
+            }
+            throw;
+        }
         if (!finalize_run_)
         {
             finalize();
@@ -153,6 +178,12 @@ template <typename Config, typename TransporterType> class Thread
     int uid() { return uid_; }
     void set_uid(int uid) { uid_ = uid; }
 
+    /// \brief Set the CPU affinity, scheduling policy and priority, and nice level to apply to the thread that calls run()
+    void set_scheduling(const protobuf::ThreadScheduling& scheduling)
+    {
+        scheduling_cfg_ = scheduling;
+    }
+
     static constexpr goby::middleware::Group shutdown_group_{"goby::middleware::Thread::shutdown"};
     static constexpr goby::middleware::Group joinable_group_{"goby::middleware::Thread::joinable"};
 
@@ -160,7 +191,7 @@ template <typename Config, typename TransporterType> class Thread
     Thread(const Config& cfg, boost::units::quantity<boost::units::si::frequency> loop_freq,
            int index = -1)
         : loop_frequency_(loop_freq),
-          loop_time_(std::chrono::steady_clock::now()),
+          loop_time_(time::SteadyClock::now()),
           cfg_(cfg),
           index_(index),
           thread_id_(goby::middleware::gettid()),
@@ -170,15 +201,14 @@ template <typename Config, typename TransporterType> class Thread
         if (loop_frequency_hertz() > 0 &&
             loop_frequency_hertz() != std::numeric_limits<double>::infinity())
         {
-            unsigned long long microsec_interval =
-                1000000.0 / (loop_frequency_hertz() * time::SimulatorSettings::warp_factor);
+            unsigned long long microsec_interval = 1000000.0 / loop_frequency_hertz();
 
             unsigned long long ticks_since_epoch =
                 std::chrono::duration_cast<std::chrono::microseconds>(loop_time_.time_since_epoch())
                     .count() /
                 microsec_interval;
 
-            loop_time_ = std::chrono::steady_clock::time_point(
+            loop_time_ = time::SteadyClock::time_point(
                 std::chrono::microseconds((ticks_since_epoch + 1) * microsec_interval));
         }
     }
@@ -200,6 +230,13 @@ template <typename Config, typename TransporterType> class Thread
 
     const Config& cfg() const { return cfg_; }
 
+    /// \brief Applies the settings given to set_scheduling() to the calling thread (called by run())
+    void apply_scheduling()
+    {
+        if (scheduling_cfg_.ByteSizeLong() > 0)
+            scheduling_ = apply_thread_scheduling(scheduling_cfg_);
+    }
+
     // called after alive() is true, but before run()
     virtual void initialize() {}
 
@@ -216,7 +253,11 @@ template <typename Config, typename TransporterType> class Thread
 #endif
         if (uid_ >= 0)
             health.set_uid(uid_);
+        if (scheduling_cfg_.ByteSizeLong() > 0)
+            *health.mutable_scheduling() = scheduling_;
         this->health(health);
+        if (CallbackProfiler::enabled())
+            CallbackProfiler::this_thread().report(health);
     }
 
     /// \brief Called when HealthRequest is made by goby_coroner
@@ -240,6 +281,29 @@ template <typename Config, typename TransporterType> class Thread
     bool alive() { return alive_ && *alive_; }
 
   private:
+    // calls loop(), timing it if the CallbackProfiler is enabled
+    void profiled_loop(bool periodic)
+    {
+        if (!CallbackProfiler::enabled())
+        {
+            loop();
+            return;
+        }
+
+        auto start = CallbackProfiler::Clock::now();
+        loop();
+        auto execution = CallbackProfiler::Clock::now() - start;
+        // finished after the next loop() was due
+        bool overrun = periodic && time::SteadyClock::now() > loop_time_ + loop_period();
+        CallbackProfiler::this_thread().loop(execution, overrun);
+    }
+
+    std::chrono::microseconds loop_period() const
+    {
+        return std::chrono::microseconds(
+            (unsigned long long)(1000000ull / loop_frequency_hertz()));
+    }
+
     void do_subscribe()
     {
         if (!transporter_)
@@ -281,7 +345,7 @@ void goby::middleware::Thread<Config, TransporterType>::run_once()
     {
         // call loop as fast as possible
         transporter_->poll(std::chrono::seconds(0));
-        loop();
+        profiled_loop(false);
     }
     else if (loop_frequency_hertz() > 0)
     {
@@ -290,11 +354,9 @@ void goby::middleware::Thread<Config, TransporterType>::run_once()
         // timeout
         if (events == 0)
         {
-            loop();
+            profiled_loop(true);
             ++loop_count_;
-            loop_time_ += std::chrono::nanoseconds(
-                (unsigned long long)(1000000000ull / (loop_frequency_hertz() *
-                                                      time::SimulatorSettings::warp_factor)));
+            loop_time_ += loop_period();
         }
     }
     else
@@ -23,8 +23,9 @@
 
 #include "goby/middleware/coroner/coroner.h"
 
-goby::middleware::HealthMonitorThread::HealthMonitorThread()
-    : SimpleThread<NullConfig>(NullConfig(), 1.0 * boost::units::si::hertz)
+goby::middleware::HealthMonitorThread::HealthMonitorThread(
+    const protobuf::AppConfig::Health& cfg)
+    : SimpleThread<protobuf::AppConfig::Health>(cfg, 1.0 * boost::units::si::hertz)
 {
     // handle goby_coroner request
     this->interprocess().template subscribe<groups::health_request, protobuf::HealthRequest>(
@@ -70,6 +71,9 @@ void goby::middleware::HealthMonitorThread::loop()
 
         health_response_.mutable_main()->set_state(health_state);
 
+        if (cfg().sample_resources())
+            resources_.sample(health_response_);
+
         if (health_response_.IsInitialized())
             this->interprocess().template publish<groups::health_response>(health_response_);
 
@@ -78,3 +82,17 @@ void goby::middleware::HealthMonitorThread::loop()
         health_response_.Clear();
     }
 }
+
+goby::middleware::TransportMetricsThread::TransportMetricsThread(const protobuf::AppConfig& cfg)
+    : SimpleThread<protobuf::AppConfig>(
+          cfg, 1.0 / cfg.transport_metrics().report_interval() * boost::units::si::hertz)
+{
+    TransportMetrics::set_enabled(true);
+}
+
+void goby::middleware::TransportMetricsThread::loop()
+{
+    protobuf::TransportMetrics metrics = TransportMetrics::summary();
+    metrics.set_name(cfg().name());
+    this->interprocess().template publish<groups::transport_metrics>(metrics);
+}
@@ -25,8 +25,11 @@
 #define GOBY_MIDDLEWARE_CORONER_H
 
 #include "goby/middleware/coroner/groups.h"
+#include "goby/middleware/coroner/resources.h"
 #include "goby/middleware/marshalling/protobuf.h"
+#include "goby/middleware/protobuf/app_config.pb.h"
 #include "goby/middleware/protobuf/coroner.pb.h"
+#include "goby/middleware/transport/metrics.h"
 
 #include "goby/middleware/application/simple_thread.h"
 
@@ -38,10 +41,10 @@ struct NullConfig
 {
 };
 
-class HealthMonitorThread : public SimpleThread<NullConfig>
+class HealthMonitorThread : public SimpleThread<protobuf::AppConfig::Health>
 {
   public:
-    HealthMonitorThread();
+    HealthMonitorThread(const protobuf::AppConfig::Health& cfg);
 
   private:
     void loop() override;
@@ -54,6 +57,18 @@ class HealthMonitorThread : public SimpleThread<NullConfig>
     goby::time::SteadyClock::time_point last_health_request_time_;
     const goby::time::SteadyClock::duration health_request_timeout_{std::chrono::seconds(1)};
     bool waiting_for_responses_{false};
+    ResourceSampler resources_;
+};
+
+/// \brief Publishes TransportMetrics::summary() on groups::transport_metrics every AppConfig::transport_metrics().report_interval()
+class TransportMetricsThread : public SimpleThread<protobuf::AppConfig>
+{
+  public:
+    TransportMetricsThread(const protobuf::AppConfig& cfg);
+
+  private:
+    void loop() override;
+    void initialize() override { this->set_name("transport_metrics"); }
 };
 } // namespace middleware
 } // namespace goby
@@ -0,0 +1,207 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm> // for min
+
+#include "goby/util/debug_logger/flex_ostream.h" // for glog
+
+#include "profiler.h"
+
+constexpr int goby::middleware::LatencyHistogram::sub_bucket_bits_;
+constexpr int goby::middleware::LatencyHistogram::max_bits_;
+constexpr int goby::middleware::LatencyHistogram::linear_buckets_;
+constexpr int goby::middleware::LatencyHistogram::bucket_count_;
+
+std::atomic<bool> goby::middleware::CallbackProfiler::enabled_{false};
+goby::middleware::CallbackProfiler::Clock::duration
+    goby::middleware::CallbackProfiler::slow_handler_threshold_;
+double goby::middleware::CallbackProfiler::max_loop_overrun_fraction_{0};
+goby::middleware::CallbackProfiler::Clock::duration
+    goby::middleware::CallbackProfiler::max_dispatch_latency_;
+
+int goby::middleware::LatencyHistogram::bucket(std::uint64_t value)
+{
+    if (value < static_cast<std::uint64_t>(linear_buckets_))
+        return value;
+
+    int msb = 63 - __builtin_clzll(value);
+    if (msb >= max_bits_)
+        return bucket_count_ - 1;
+
+    // keep the top sub_bucket_bits_ + 1 bits
+    int shift = msb - sub_bucket_bits_;
+    return linear_buckets_ + (shift - 1) * (1 << sub_bucket_bits_) +
+           static_cast<int>((value >> shift) - (1 << sub_bucket_bits_));
+}
+
+std::uint64_t goby::middleware::LatencyHistogram::bucket_upper_bound(int index)
+{
+    if (index < linear_buckets_)
+        return index;
+
+    int shift = (index - linear_buckets_) / (1 << sub_bucket_bits_) + 1;
+    std::uint64_t mantissa = (index - linear_buckets_) % (1 << sub_bucket_bits_) +
+                             (1 << sub_bucket_bits_);
+    return ((mantissa + 1) << shift) - 1;
+}
+
+void goby::middleware::LatencyHistogram::record(std::uint64_t microseconds)
+{
+    ++counts_[bucket(microseconds)];
+    ++count_;
+    sum_ += microseconds;
+    max_ = std::max(max_, microseconds);
+}
+
+std::uint64_t goby::middleware::LatencyHistogram::percentile(double p) const
+{
+    if (count_ == 0)
+        return 0;
+
+    // rank of the requested sample (1 to count_)
+    auto rank = static_cast<std::uint64_t>(p / 100.0 * count_ + 0.5);
+    rank = std::min(std::max<std::uint64_t>(rank, 1), count_);
+
+    std::uint64_t cumulative = 0;
+    for (int i = 0; i < bucket_count_; ++i)
+    {
+        cumulative += counts_[i];
+        if (cumulative >= rank)
+            return std::min(bucket_upper_bound(i), max_);
+    }
+    return max_;
+}
+
+void goby::middleware::LatencyHistogram::reset()
+{
+    counts_.fill(0);
+    count_ = 0;
+    sum_ = 0;
+    max_ = 0;
+}
+
+void goby::middleware::LatencyHistogram::summarize(protobuf::LatencySummary& summary) const
+{
+    summary.set_count(count_);
+    if (count_ == 0)
+        return;
+    summary.set_mean(mean());
+    summary.set_p50(percentile(50));
+    summary.set_p90(percentile(90));
+    summary.set_p99(percentile(99));
+    summary.set_max(max_);
+}
+
+void goby::middleware::CallbackProfiler::configure(
+    const protobuf::AppConfig::CallbackProfiling& cfg)
+{
+    slow_handler_threshold_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(cfg.slow_handler_threshold()));
+    max_loop_overrun_fraction_ = cfg.max_loop_overrun_fraction();
+    max_dispatch_latency_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(cfg.max_dispatch_latency()));
+    enabled_ = cfg.enable();
+}
+
+goby::middleware::CallbackProfiler& goby::middleware::CallbackProfiler::this_thread()
+{
+    static thread_local CallbackProfiler profiler;
+    return profiler;
+}
+
+void goby::middleware::CallbackProfiler::handler(const std::string& group,
+                                                 const std::string& type,
+                                                 Clock::duration execution)
+{
+    handler_.record(execution);
+    if (execution > slow_handler_threshold_)
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(execution).count();
+        auto& slow = slow_handlers_[std::make_pair(group, type)];
+        ++slow.first;
+        slow.second = std::max<std::uint64_t>(slow.second, us);
+
+        goby::glog.is_debug1() && goby::glog << "Slow handler for group: " << group
+                                             << ", type: " << type << " took " << us << " us"
+                                             << std::endl;
+    }
+}
+
+void goby::middleware::CallbackProfiler::loop(Clock::duration execution, bool overrun)
+{
+    loop_.record(execution);
+    if (overrun)
+        ++loop_overruns_;
+}
+
+void goby::middleware::CallbackProfiler::report(protobuf::ThreadHealth& health)
+{
+    auto now = Clock::now();
+    auto& profile = *health.mutable_profile();
+    profile.set_interval(std::chrono::duration<double>(now - window_start_).count());
+
+    if (loop_.count() > 0)
+    {
+        loop_.summarize(*profile.mutable_loop());
+        profile.set_loop_overruns(loop_overruns_);
+    }
+    if (handler_.count() > 0)
+        handler_.summarize(*profile.mutable_handler());
+    if (dispatch_latency_.count() > 0)
+        dispatch_latency_.summarize(*profile.mutable_dispatch_latency());
+
+    for (const auto& slow_p : slow_handlers_)
+    {
+        auto& slow = *profile.add_slow_handler();
+        slow.set_group(slow_p.first.first);
+        slow.set_type(slow_p.first.second);
+        slow.set_count(slow_p.second.first);
+        slow.set_max(slow_p.second.second);
+    }
+
+    std::string degraded_reason;
+    if (!slow_handlers_.empty())
+        degraded_reason = "Slow subscription handler(s)";
+    else if (loop_.count() > 0 && loop_overruns_ > max_loop_overrun_fraction_ * loop_.count())
+        degraded_reason = "loop() overruns: " + std::to_string(loop_overruns_) + " of " +
+                          std::to_string(loop_.count());
+    else if (dispatch_latency_.count() > 0 &&
+             std::chrono::microseconds(dispatch_latency_.percentile(99)) > max_dispatch_latency_)
+        degraded_reason = "Dispatch latency (99th percentile): " +
+                          std::to_string(dispatch_latency_.percentile(99)) + " us";
+
+    if (!degraded_reason.empty() &&
+        (!health.has_state() || health.state() < protobuf::HEALTH__DEGRADED))
+    {
+        health.set_state(protobuf::HEALTH__DEGRADED);
+        if (!health.has_error_message())
+            health.set_error_message(degraded_reason);
+    }
+
+    loop_.reset();
+    loop_overruns_ = 0;
+    handler_.reset();
+    dispatch_latency_.reset();
+    slow_handlers_.clear();
+    window_start_ = now;
+}
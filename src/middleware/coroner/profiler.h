@@ -0,0 +1,122 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_CORONER_PROFILER_H
+#define GOBY_MIDDLEWARE_CORONER_PROFILER_H
+
+#include <array>   // for array
+#include <atomic>  // for atomic
+#include <chrono>  // for steady_clock
+#include <cstdint> // for uint64_t
+#include <map>     // for map
+#include <string>  // for string
+#include <utility> // for pair
+
+#include "goby/middleware/protobuf/app_config.pb.h" // for AppConfig
+#include "goby/middleware/protobuf/coroner.pb.h"    // for ThreadHealth
+
+namespace goby
+{
+namespace middleware
+{
+/// \brief Fixed size histogram of durations (in microseconds) with log-linear buckets (in the style of HdrHistogram): exact below 16 us, and within 1/8 (12.5%) of the value above, up to 2^37 us (~38 hours)
+class LatencyHistogram
+{
+  public:
+    void record(std::uint64_t microseconds);
+    template <typename Duration> void record(Duration d)
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+        record(us > 0 ? static_cast<std::uint64_t>(us) : 0);
+    }
+
+    std::uint64_t count() const { return count_; }
+    std::uint64_t max() const { return max_; }
+    std::uint64_t mean() const { return count_ ? sum_ / count_ : 0; }
+    /// \brief Upper bound of the bucket containing the given percentile (0-100), limited to max()
+    std::uint64_t percentile(double p) const;
+
+    void reset();
+    void summarize(protobuf::LatencySummary& summary) const;
+
+  private:
+    static constexpr int sub_bucket_bits_{3};
+    static constexpr int max_bits_{37};
+    static constexpr int linear_buckets_{2 << sub_bucket_bits_};
+    static constexpr int bucket_count_{
+        linear_buckets_ + (max_bits_ - sub_bucket_bits_ - 1) * (1 << sub_bucket_bits_)};
+
+    static int bucket(std::uint64_t value);
+    static std::uint64_t bucket_upper_bound(int index);
+
+  private:
+    std::array<std::uint32_t, bucket_count_> counts_{};
+    std::uint64_t count_{0};
+    std::uint64_t sum_{0};
+    std::uint64_t max_{0};
+};
+
+/// \brief Per thread timing of loop() and subscription handlers, reported in the ThreadHealth (see AppConfig::callback_profiling)
+///
+/// Each thread records into its own instance (this_thread()) without locking; report() must be called from the same thread (as Thread::thread_health() is).
+class CallbackProfiler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+    /// \brief Sets the thresholds and enables or disables the profiler. Call before launching threads.
+    static void configure(const protobuf::AppConfig::CallbackProfiling& cfg);
+
+    static CallbackProfiler& this_thread();
+
+    void handler(const std::string& group, const std::string& type, Clock::duration execution);
+    void dispatch(Clock::duration latency) { dispatch_latency_.record(latency); }
+    void loop(Clock::duration execution, bool overrun);
+
+    /// \brief Adds the ThreadProfile since the previous report to health, sets HEALTH__DEGRADED if any threshold was exceeded, and resets
+    void report(protobuf::ThreadHealth& health);
+
+  private:
+    CallbackProfiler() : window_start_(Clock::now()) {}
+
+  private:
+    static std::atomic<bool> enabled_;
+    static Clock::duration slow_handler_threshold_;
+    static double max_loop_overrun_fraction_;
+    static Clock::duration max_dispatch_latency_;
+
+    LatencyHistogram loop_;
+    std::uint64_t loop_overruns_{0};
+    LatencyHistogram handler_;
+    LatencyHistogram dispatch_latency_;
+    // group, type -> count, max (us)
+    std::map<std::pair<std::string, std::string>, std::pair<std::uint64_t, std::uint64_t>>
+        slow_handlers_;
+    Clock::time_point window_start_;
+};
+
+} // namespace middleware
+} // namespace goby
+
+#endif
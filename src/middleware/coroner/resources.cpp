@@ -0,0 +1,183 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <fstream> // for ifstream
+#include <sstream> // for stringstream
+#include <vector>  // for vector
+
+#include <sys/resource.h> // for getrusage
+#include <unistd.h>       // for sysconf
+
+#include "resources.h"
+
+namespace
+{
+bool read_file(const std::string& path, std::string& contents)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+    std::stringstream ss;
+    ss << file.rdbuf();
+    contents = ss.str();
+    return true;
+}
+
+std::string proc_path(int tid, const std::string& file)
+{
+    return (tid < 0 ? std::string("/proc/self/") : "/proc/self/task/" + std::to_string(tid) + "/") +
+           file;
+}
+} // namespace
+
+bool goby::middleware::ResourceSampler::parse_stat(const std::string& contents, Stat& stat)
+{
+    // the command name (field 2) is in parentheses and may contain spaces or parentheses
+    auto comm_end = contents.rfind(')');
+    if (comm_end == std::string::npos)
+        return false;
+
+    std::stringstream ss(contents.substr(comm_end + 1));
+    // fields from 3 (state) on
+    std::vector<std::string> fields;
+    std::string field;
+    while (ss >> field) fields.push_back(field);
+
+    // see proc(5): field n is fields[n - 3]
+    enum
+    {
+        MINFLT = 10,
+        MAJFLT = 12,
+        UTIME = 14,
+        STIME = 15,
+        NUM_THREADS = 20,
+        RSS = 24
+    };
+    if (fields.size() < RSS - 2)
+        return false;
+
+    try
+    {
+        auto field_value = [&](int n) { return std::stoull(fields[n - 3]); };
+        stat.minor_faults = field_value(MINFLT);
+        stat.major_faults = field_value(MAJFLT);
+        stat.cpu_ticks = field_value(UTIME) + field_value(STIME);
+        stat.num_threads = field_value(NUM_THREADS);
+        stat.rss_pages = field_value(RSS);
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+void goby::middleware::ResourceSampler::parse_status(const std::string& contents,
+                                                     protobuf::ResourceUsage& usage)
+{
+    std::stringstream ss(contents);
+    std::string line;
+    while (std::getline(ss, line))
+    {
+        auto colon_pos = line.find(':');
+        if (colon_pos == std::string::npos)
+            continue;
+        auto key = line.substr(0, colon_pos);
+        try
+        {
+            if (key == "voluntary_ctxt_switches")
+                usage.set_voluntary_context_switches(std::stoull(line.substr(colon_pos + 1)));
+            else if (key == "nonvoluntary_ctxt_switches")
+                usage.set_involuntary_context_switches(std::stoull(line.substr(colon_pos + 1)));
+        }
+        catch (std::exception&)
+        {
+        }
+    }
+}
+
+void goby::middleware::ResourceSampler::sample(protobuf::ProcessHealth& health)
+{
+    auto now = Clock::now();
+    double elapsed = last_sample_time_ == Clock::time_point()
+                         ? 0
+                         : std::chrono::duration<double>(now - last_sample_time_).count();
+
+    sample(-1, elapsed, *health.mutable_resources());
+    sample_thread(*health.mutable_main(), elapsed);
+
+    // forget threads that no longer exist
+    last_ticks_.swap(ticks_);
+    ticks_.clear();
+    last_sample_time_ = now;
+}
+
+void goby::middleware::ResourceSampler::sample_thread(protobuf::ThreadHealth& thread,
+                                                      double elapsed)
+{
+    if (thread.has_thread_id())
+        sample(thread.thread_id(), elapsed, *thread.mutable_resources());
+    for (auto& child : *thread.mutable_child()) sample_thread(child, elapsed);
+}
+
+void goby::middleware::ResourceSampler::sample(int tid, double elapsed,
+                                               protobuf::ResourceUsage& usage)
+{
+    std::string contents;
+    Stat stat;
+    if (!read_file(proc_path(tid, "stat"), contents) || !parse_stat(contents, stat))
+        return;
+
+    usage.set_minor_faults(stat.minor_faults);
+    usage.set_major_faults(stat.major_faults);
+    if (tid < 0)
+    {
+        static const long page_size = sysconf(_SC_PAGESIZE);
+        usage.set_rss(stat.rss_pages * page_size);
+        usage.set_num_threads(stat.num_threads);
+    }
+
+    ticks_[tid] = stat.cpu_ticks;
+    auto last_it = last_ticks_.find(tid);
+    if (elapsed > 0 && last_it != last_ticks_.end() && stat.cpu_ticks >= last_it->second)
+    {
+        static const long ticks_per_second = sysconf(_SC_CLK_TCK);
+        usage.set_cpu_percent(100.0 * (stat.cpu_ticks - last_it->second) / ticks_per_second /
+                              elapsed);
+    }
+
+    if (tid < 0)
+    {
+        // /proc/self/status only counts the context switches of the main thread
+        rusage process_usage;
+        if (getrusage(RUSAGE_SELF, &process_usage) == 0)
+        {
+            usage.set_voluntary_context_switches(process_usage.ru_nvcsw);
+            usage.set_involuntary_context_switches(process_usage.ru_nivcsw);
+        }
+    }
+    else if (read_file(proc_path(tid, "status"), contents))
+    {
+        parse_status(contents, usage);
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_CORONER_RESOURCES_H
+#define GOBY_MIDDLEWARE_CORONER_RESOURCES_H
+
+#include <chrono>  // for steady_clock
+#include <cstdint> // for uint64_t
+#include <map>     // for map
+#include <string>  // for string
+
+#include "goby/middleware/protobuf/coroner.pb.h" // for ProcessHealth
+
+namespace goby
+{
+namespace middleware
+{
+/// \brief Samples the resource usage of this process and its threads from /proc (Linux)
+///
+/// Each sample reads /proc/self/stat (and getrusage() for the context switches), and /proc/self/task/[tid]/stat and status for each thread reported in the ProcessHealth. The CPU usage is computed from the change since the previous sample.
+class ResourceSampler
+{
+  public:
+    /// \brief Sets ProcessHealth::resources, and ThreadHealth::resources for each thread (main and children) with a thread_id
+    void sample(protobuf::ProcessHealth& health);
+
+    struct Stat
+    {
+        std::uint64_t cpu_ticks{0}; // utime + stime
+        std::uint64_t minor_faults{0};
+        std::uint64_t major_faults{0};
+        int num_threads{0};
+        std::uint64_t rss_pages{0};
+    };
+
+    /// \brief Parses the contents of /proc/[pid]/stat or /proc/[pid]/task/[tid]/stat
+    static bool parse_stat(const std::string& contents, Stat& stat);
+    /// \brief Sets the context switch counts from the contents of /proc/[pid]/status or /proc/[pid]/task/[tid]/status
+    static void parse_status(const std::string& contents, protobuf::ResourceUsage& usage);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    // sample the process (tid < 0) or a thread
+    void sample(int tid, double elapsed, protobuf::ResourceUsage& usage);
+    void sample_thread(protobuf::ThreadHealth& thread, double elapsed);
+
+  private:
+    // tid (-1 for the process) to cpu_ticks at the previous sample
+    std::map<int, std::uint64_t> last_ticks_;
+    std::map<int, std::uint64_t> ticks_;
+    Clock::time_point last_sample_time_;
+};
+
+} // namespace middleware
+} // namespace goby
+
+#endif
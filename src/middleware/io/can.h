@@ -34,20 +34,21 @@
 #include <string.h>        // for strcpy, strerror
 #include <string>          // for string, operator+
 #include <sys/ioctl.h>     // for ioctl, SIOCGIFINDEX
-#include <sys/socket.h>    // for bind, setsockopt
+#include <sys/socket.h>    // for bind, setsockopt, recvmmsg
+#include <sys/uio.h>       // for iovec
 #include <tuple>           // for make_tuple, tuple
 #include <vector>          // for vector
 
 #include <boost/asio/buffer.hpp>                  // for buffer
 #include <boost/asio/posix/stream_descriptor.hpp> // for stream_descriptor
 #include <boost/asio/read.hpp>                    // for async_read
-#include <boost/bind/bind.hpp>                         // for bind
-#include <boost/core/ref.hpp>                     // for ref
+#include <boost/system/error_code.hpp>            // for error_code
 
 #include "goby/exception.h"                         // for Exception
+#include "goby/middleware/io/can_reassembly.h"      // for CanReassembler
 #include "goby/middleware/io/detail/io_interface.h" // for PubSubLayer, IOT...
 #include "goby/middleware/protobuf/can_config.pb.h" // for CanConfig, CanCo...
-#include "goby/middleware/protobuf/io.pb.h"         // for IOData
+#include "goby/middleware/protobuf/io.pb.h"         // for IOData, CanPGNMe...
 namespace goby
 {
 namespace middleware
@@ -101,9 +102,21 @@ class CanThread : public detail::IOThread<line_in_group, line_out_group, publish
     /// \brief Constructs the thread.
     /// \param config A reference to the Protocol Buffers config read by the main application at launch
     /// \param index Thread index for multiple instances in a given application (-1 indicates a single instance)
+    ///
+    /// If config.reassembly is set, complete PGNs are also published as protobuf::CanPGNMessage.
     CanThread(const goby::middleware::protobuf::CanConfig& config, int index = -1)
         : Base(config, index, std::string("can: ") + config.interface())
     {
+        if (config.has_reassembly())
+            reassembler_.reset(new CanReassembler(config.reassembly()));
+
+        this->interthread().template subscribe<line_out_group, can_frame>(
+            [this](const can_frame& frame) {
+                auto io_msg = std::make_shared<goby::middleware::protobuf::IOData>();
+                io_msg->set_data(reinterpret_cast<const char*>(&frame), sizeof(can_frame));
+                this->write(io_msg);
+            });
+
         auto ready = ThreadState::SUBSCRIPTIONS_COMPLETE;
         this->interthread().template publish<line_in_group>(ready);
     }
@@ -119,10 +132,28 @@ class CanThread : public detail::IOThread<line_in_group, line_out_group, publish
 
     void open_socket() override;
 
-    void data_rec(struct can_frame& receive_frame_, boost::asio::posix::stream_descriptor& stream);
+    /// \brief Publishes a received frame, and the PGN it completes (if reassembling)
+    void handle_frame(const can_frame& frame);
+
+    /// \brief Batched mode (read_batch_size > 1): waits until the socket is readable
+    void async_wait_readable();
+
+    /// \brief Batched mode: reads the pending frames (up to max_frames_per_read) with as few recvmmsg() calls as possible
+    boost::system::error_code read_pending_frames();
 
   private:
+    // so that a busy bus does not starve the other handlers (e.g. writes, or other devices sharing
+    // the io_context); any remaining frames are read once the socket is polled again
+    static constexpr std::size_t max_frames_per_read{1024};
+
     struct can_frame receive_frame_;
+
+    // batched mode
+    std::vector<can_frame> frames_;
+    std::vector<iovec> frame_iovecs_;
+    std::vector<mmsghdr> frame_headers_;
+
+    std::unique_ptr<CanReassembler> reassembler_;
 };
 } // namespace io
 } // namespace middleware
@@ -140,7 +171,6 @@ void goby::middleware::io::CanThread<line_in_group, line_out_group, publish_laye
     struct sockaddr_can addr_
     {
     };
-    struct can_frame receive_frame_;
     struct ifreq ifr_;
     can_socket = socket(PF_CAN, SOCK_RAW, CAN_RAW);
 
@@ -179,16 +209,21 @@ void goby::middleware::io::CanThread<line_in_group, line_out_group, publish_laye
 
     this->mutable_socket().assign(can_socket);
 
-    this->interthread().template subscribe<line_out_group, can_frame>(
-        [this](const can_frame& frame) {
-            auto io_msg = std::make_shared<goby::middleware::protobuf::IOData>();
-            std::string& bytes = *io_msg->mutable_data();
-
-            const int frame_size = sizeof(can_frame);
-
-            for (int i = 0; i < frame_size; ++i)
-            { bytes += *(reinterpret_cast<const char*>(&frame) + i); } this->write(io_msg);
-        });
+    auto batch_size = this->cfg().read_batch_size();
+    if (batch_size > 1 && frames_.size() != batch_size)
+    {
+        frames_.resize(batch_size);
+        frame_iovecs_.resize(batch_size);
+        frame_headers_.resize(batch_size);
+        for (decltype(batch_size) i = 0; i < batch_size; ++i)
+        {
+            frame_iovecs_[i].iov_base = &frames_[i];
+            frame_iovecs_[i].iov_len = sizeof(can_frame);
+            frame_headers_[i] = mmsghdr();
+            frame_headers_[i].msg_hdr.msg_iov = &frame_iovecs_[i];
+            frame_headers_[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
 }
 
 template <const goby::middleware::Group& line_in_group,
@@ -198,10 +233,25 @@ template <const goby::middleware::Group& line_in_group,
 void goby::middleware::io::CanThread<line_in_group, line_out_group, publish_layer, subscribe_layer,
                                      ThreadType>::async_read()
 {
-    boost::asio::async_read(this->mutable_socket(),
-                            boost::asio::buffer(&receive_frame_, sizeof(receive_frame_)),
-                            boost::bind(&CanThread::data_rec, this, boost::ref(receive_frame_),
-                                        boost::ref(this->mutable_socket())));
+    if (!frames_.empty())
+    {
+        async_wait_readable();
+        return;
+    }
+
+    boost::asio::async_read(
+        this->mutable_socket(), boost::asio::buffer(&receive_frame_, sizeof(receive_frame_)),
+        [this](const boost::system::error_code& ec, std::size_t bytes_transferred) {
+            if (!ec && bytes_transferred > 0)
+            {
+                handle_frame(receive_frame_);
+                this->async_read();
+            }
+            else
+            {
+                this->handle_read_error(ec);
+            }
+        });
 }
 
 template <const goby::middleware::Group& line_in_group,
@@ -209,24 +259,85 @@ template <const goby::middleware::Group& line_in_group,
           goby::middleware::io::PubSubLayer publish_layer,
           goby::middleware::io::PubSubLayer subscribe_layer, template <class> class ThreadType>
 void goby::middleware::io::CanThread<line_in_group, line_out_group, publish_layer, subscribe_layer,
-                                     ThreadType>::data_rec(struct can_frame& receive_frame_,
-                                                           boost::asio::posix::stream_descriptor&
-                                                               stream)
+                                     ThreadType>::async_wait_readable()
 {
-    //  Within a process raw can frames are probably what we are looking for.
-    this->interthread().template publish<line_in_group>(receive_frame_);
+    auto readable = [this](const boost::system::error_code& ec) {
+        auto read_ec = ec ? ec : read_pending_frames();
+        if (!read_ec)
+            this->async_read();
+        else
+            this->handle_read_error(read_ec);
+    };
 
-    std::string bytes;
-    const int frame_size = sizeof(can_frame);
+#ifndef USE_BOOST_IO_SERVICE
+    this->mutable_socket().async_wait(boost::asio::posix::stream_descriptor::wait_read, readable);
+#else
+    this->mutable_socket().async_read_some(
+        boost::asio::null_buffers(),
+        [readable](const boost::system::error_code& ec, std::size_t) { readable(ec); });
+#endif
+}
 
-    for (int i = 0; i < frame_size; ++i)
-    { bytes += *(reinterpret_cast<char*>(&receive_frame_) + i); }
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, template <class> class ThreadType>
+boost::system::error_code
+goby::middleware::io::CanThread<line_in_group, line_out_group, publish_layer, subscribe_layer,
+                               ThreadType>::read_pending_frames()
+{
+    int fd = this->mutable_socket().native_handle();
+    for (std::size_t frames_read = 0; frames_read < max_frames_per_read;)
+    {
+        int count = recvmmsg(fd, frame_headers_.data(), frame_headers_.size(), MSG_DONTWAIT,
+                             nullptr);
+        if (count < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                return boost::system::error_code();
+            return boost::system::error_code(errno, boost::system::system_category());
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (frame_headers_[i].msg_len == sizeof(can_frame))
+                handle_frame(frames_[i]);
+        }
+
+        // fewer than requested: the socket is drained
+        if (static_cast<std::size_t>(count) < frame_headers_.size())
+            return boost::system::error_code();
+        frames_read += count;
+    }
+    return boost::system::error_code();
+}
+
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, template <class> class ThreadType>
+void goby::middleware::io::CanThread<line_in_group, line_out_group, publish_layer, subscribe_layer,
+                                     ThreadType>::handle_frame(const can_frame& frame)
+{
+    if (!reassembler_ || this->cfg().reassembly().publish_frames())
+    {
+        //  Within a process raw can frames are probably what we are looking for.
+        this->interthread().template publish<line_in_group>(frame);
 
-    this->handle_read_success(bytes.size(), bytes);
+        auto io_msg = this->make_io_data();
+        io_msg->mutable_data()->assign(reinterpret_cast<const char*>(&frame), sizeof(can_frame));
+        this->handle_read_success(sizeof(can_frame), io_msg);
+    }
 
-    boost::asio::async_read(
-        stream, boost::asio::buffer(&receive_frame_, sizeof(receive_frame_)),
-        boost::bind(&CanThread::data_rec, this, boost::ref(receive_frame_), boost::ref(stream)));
+    if (reassembler_)
+    {
+        if (auto pgn_msg = reassembler_->add_frame(frame))
+        {
+            if (this->index() != -1)
+                pgn_msg->set_index(this->index());
+            this->publish_in(pgn_msg);
+        }
+    }
 }
 
 #endif
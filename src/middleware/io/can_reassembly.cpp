@@ -0,0 +1,288 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm> // for min
+#include <chrono>    // for duration_cast
+
+#include "can_reassembly.h"
+
+namespace
+{
+// J1939-21 transport protocol
+constexpr std::uint8_t tp_cm_pdu_format{0xEC}; // connection management (PGN 60416)
+constexpr std::uint8_t tp_dt_pdu_format{0xEB}; // data transfer (PGN 60160)
+constexpr std::uint8_t tp_cm_rts{16};
+constexpr std::uint8_t tp_cm_bam{32};
+constexpr std::uint8_t tp_cm_abort{255};
+constexpr std::uint32_t tp_bytes_per_packet{7};
+
+// NMEA 2000 fast packet
+constexpr std::uint32_t fast_packet_first_frame_bytes{6};
+constexpr std::uint32_t fast_packet_bytes_per_frame{7};
+
+// PDU format values below this are PDU1 (PDU specific is the destination address)
+constexpr std::uint8_t pdu2_min_format{240};
+constexpr std::uint8_t global_address{255};
+
+std::uint32_t frame_length(const can_frame& frame)
+{
+    return std::min<std::uint32_t>(frame.can_dlc, CAN_MAX_DLEN);
+}
+} // namespace
+
+goby::middleware::io::CanReassembler::CanReassembler(
+    const protobuf::CanConfig::Reassembly& cfg)
+    : j1939_transport_protocol_(cfg.j1939_transport_protocol()),
+      fast_packet_pgns_(cfg.fast_packet_pgn().begin(), cfg.fast_packet_pgn().end()),
+      timeout_(std::chrono::duration_cast<goby::time::SteadyClock::duration>(
+          std::chrono::duration<double>(cfg.timeout())))
+{
+}
+
+std::shared_ptr<goby::middleware::protobuf::CanPGNMessage>
+goby::middleware::io::CanReassembler::add_frame(const can_frame& frame,
+                                                goby::time::SteadyClock::time_point now)
+{
+    // transfers from nodes that went silent would otherwise be held forever
+    if (now > next_expiry_)
+        remove_expired(now);
+
+    // J1939 uses extended (29-bit) data frames only
+    if (!(frame.can_id & CAN_EFF_FLAG) || (frame.can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG)))
+        return nullptr;
+
+    std::uint32_t id = frame.can_id & CAN_EFF_MASK;
+    std::uint8_t priority = (id >> 26) & 0x7;
+    std::uint8_t pdu_format = (id >> 16) & 0xFF;
+    std::uint8_t pdu_specific = (id >> 8) & 0xFF;
+    std::uint8_t source = id & 0xFF;
+
+    std::uint32_t pgn = (id >> 8) & 0x1FFFF;
+    std::uint8_t destination = global_address;
+    if (pdu_format < pdu2_min_format)
+    {
+        pgn &= ~0xFFu;
+        destination = pdu_specific;
+    }
+
+    if (j1939_transport_protocol_ && pdu_format == tp_cm_pdu_format)
+        return add_transport_management(frame, priority, source, destination, now);
+    if (j1939_transport_protocol_ && pdu_format == tp_dt_pdu_format)
+        return add_transport_data(frame, source, destination, now);
+    if (fast_packet_pgns_.count(pgn))
+        return add_fast_packet(frame, pgn, priority, source, destination, now);
+
+    auto msg = std::make_shared<protobuf::CanPGNMessage>();
+    msg->set_pgn(pgn);
+    msg->set_priority(priority);
+    msg->set_source(source);
+    msg->set_destination(destination);
+    msg->set_data(reinterpret_cast<const char*>(frame.data), frame_length(frame));
+    return msg;
+}
+
+std::shared_ptr<goby::middleware::protobuf::CanPGNMessage>
+goby::middleware::io::CanReassembler::add_transport_management(
+    const can_frame& frame, std::uint8_t priority, std::uint8_t source, std::uint8_t destination,
+    goby::time::SteadyClock::time_point now)
+{
+    if (frame_length(frame) < 8)
+        return nullptr;
+
+    const auto* data = frame.data;
+    switch (data[0])
+    {
+        case tp_cm_rts:
+        case tp_cm_bam:
+        {
+            Transfer transfer;
+            transfer.size = data[1] | (data[2] << 8);
+            std::uint32_t packets = data[3];
+            if (packets == 0 ||
+                packets != (transfer.size + tp_bytes_per_packet - 1) / tp_bytes_per_packet)
+            {
+                transport_.erase(std::make_pair(source, destination));
+                return nullptr;
+            }
+
+            transfer.pgn = (data[5] | (data[6] << 8) | (data[7] << 16)) & 0x1FFFF;
+            transfer.priority = priority;
+            // the transferred PGN is addressed to the destination of the connection if PDU1
+            transfer.destination = ((transfer.pgn >> 8) & 0xFF) < pdu2_min_format
+                                       ? destination
+                                       : global_address;
+            transfer.received.assign(packets, false);
+            transfer.data.assign(packets * tp_bytes_per_packet, '\xFF');
+            transfer.last_frame = now;
+            // a new transfer replaces any incomplete one on this connection
+            transport_[std::make_pair(source, destination)] = std::move(transfer);
+            next_expiry_ = std::min(next_expiry_, now + timeout_);
+            break;
+        }
+
+        case tp_cm_abort:
+            // may be sent by either end of the connection
+            transport_.erase(std::make_pair(source, destination));
+            transport_.erase(std::make_pair(destination, source));
+            break;
+
+        default:
+            // CTS and end of message acknowledgment need no action when listening
+            break;
+    }
+    return nullptr;
+}
+
+std::shared_ptr<goby::middleware::protobuf::CanPGNMessage>
+goby::middleware::io::CanReassembler::add_transport_data(const can_frame& frame,
+                                                         std::uint8_t source,
+                                                         std::uint8_t destination,
+                                                         goby::time::SteadyClock::time_point now)
+{
+    auto it = transport_.find(std::make_pair(source, destination));
+    if (it == transport_.end())
+        return nullptr;
+
+    Transfer& transfer = it->second;
+    if (expired(transfer, now))
+    {
+        transport_.erase(it);
+        return nullptr;
+    }
+
+    std::uint32_t length = frame_length(frame);
+    std::uint32_t sequence = frame.data[0];
+    if (length < 2 || sequence == 0 || sequence > transfer.received.size())
+        return nullptr;
+
+    // RTS/CTS transfers may resend packets, so place by sequence number
+    std::copy(frame.data + 1, frame.data + length,
+              transfer.data.begin() + (sequence - 1) * tp_bytes_per_packet);
+    if (!transfer.received[sequence - 1])
+    {
+        transfer.received[sequence - 1] = true;
+        ++transfer.packets_received;
+    }
+    transfer.last_frame = now;
+
+    if (transfer.packets_received < transfer.received.size())
+        return nullptr;
+
+    auto msg = complete(transfer, source);
+    transport_.erase(it);
+    return msg;
+}
+
+std::shared_ptr<goby::middleware::protobuf::CanPGNMessage>
+goby::middleware::io::CanReassembler::add_fast_packet(const can_frame& frame, std::uint32_t pgn,
+                                                      std::uint8_t priority, std::uint8_t source,
+                                                      std::uint8_t destination,
+                                                      goby::time::SteadyClock::time_point now)
+{
+    std::uint32_t length = frame_length(frame);
+    if (length < 2)
+        return nullptr;
+
+    auto key = std::make_pair(source, pgn);
+    std::uint8_t sequence = frame.data[0] >> 5;
+    std::uint32_t frame_index = frame.data[0] & 0x1F;
+
+    if (frame_index == 0)
+    {
+        Transfer transfer;
+        transfer.pgn = pgn;
+        transfer.priority = priority;
+        transfer.destination = destination;
+        transfer.size = frame.data[1];
+        transfer.sequence = sequence;
+        transfer.data.assign(frame.data + 2, frame.data + length);
+        transfer.packets_received = 1;
+        transfer.last_frame = now;
+
+        if (transfer.data.size() >= transfer.size)
+        {
+            fast_packet_.erase(key);
+            return complete(transfer, source);
+        }
+        fast_packet_[key] = std::move(transfer);
+        next_expiry_ = std::min(next_expiry_, now + timeout_);
+        return nullptr;
+    }
+
+    auto it = fast_packet_.find(key);
+    if (it == fast_packet_.end())
+        return nullptr;
+
+    Transfer& transfer = it->second;
+    // frames are sent in order, so anything else means one was lost
+    if (expired(transfer, now) || sequence != transfer.sequence ||
+        frame_index != transfer.packets_received)
+    {
+        fast_packet_.erase(it);
+        return nullptr;
+    }
+
+    transfer.data.append(reinterpret_cast<const char*>(frame.data) + 1, length - 1);
+    ++transfer.packets_received;
+    transfer.last_frame = now;
+
+    if (transfer.data.size() < transfer.size)
+        return nullptr;
+
+    auto msg = complete(transfer, source);
+    fast_packet_.erase(it);
+    return msg;
+}
+
+void goby::middleware::io::CanReassembler::remove_expired(goby::time::SteadyClock::time_point now)
+{
+    next_expiry_ = goby::time::SteadyClock::time_point::max();
+    auto sweep = [&](auto& transfers) {
+        for (auto it = transfers.begin(); it != transfers.end();)
+        {
+            if (expired(it->second, now))
+            {
+                it = transfers.erase(it);
+            }
+            else
+            {
+                next_expiry_ = std::min(next_expiry_, it->second.last_frame + timeout_);
+                ++it;
+            }
+        }
+    };
+    sweep(transport_);
+    sweep(fast_packet_);
+}
+
+std::shared_ptr<goby::middleware::protobuf::CanPGNMessage>
+goby::middleware::io::CanReassembler::complete(const Transfer& transfer, std::uint8_t source)
+{
+    auto msg = std::make_shared<protobuf::CanPGNMessage>();
+    msg->set_pgn(transfer.pgn);
+    msg->set_priority(transfer.priority);
+    msg->set_source(source);
+    msg->set_destination(transfer.destination);
+    msg->set_data(transfer.data.substr(0, transfer.size));
+    return msg;
+}
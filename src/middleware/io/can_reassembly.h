@@ -0,0 +1,119 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_IO_CAN_REASSEMBLY_H
+#define GOBY_MIDDLEWARE_IO_CAN_REASSEMBLY_H
+
+#include <cstdint>     // for uint32_t, uint8_t
+#include <linux/can.h> // for can_frame
+#include <map>         // for map
+#include <memory>      // for shared_ptr
+#include <set>         // for set
+#include <string>      // for string
+#include <utility>     // for pair
+#include <vector>      // for vector
+
+#include "goby/middleware/protobuf/can_config.pb.h" // for CanConfig
+#include "goby/middleware/protobuf/io.pb.h"         // for CanPGNMessage
+#include "goby/time/steady_clock.h"                 // for SteadyClock
+
+namespace goby
+{
+namespace middleware
+{
+namespace io
+{
+/// \brief Reassembles J1939-21 transport protocol (BAM and RTS/CTS) transfers and NMEA 2000 fast packets from CAN frames into complete PGNs
+///
+/// Transfers are reassembled passively: this never sends CTS or acknowledgements, so RTS/CTS transfers to other nodes are reassembled by observing their handshake.
+class CanReassembler
+{
+  public:
+    CanReassembler(const protobuf::CanConfig::Reassembly& cfg);
+
+    /// \brief Adds a received frame
+    ///
+    /// \return The complete PGN if this frame completes one (a single frame PGN, or the last frame of a transfer), otherwise nullptr. Standard (11-bit) frames and transport protocol management frames return nullptr.
+    std::shared_ptr<protobuf::CanPGNMessage>
+    add_frame(const can_frame& frame,
+              goby::time::SteadyClock::time_point now = goby::time::SteadyClock::now());
+
+    /// \brief Discards all the incomplete transfers that have timed out (also done by add_frame())
+    void remove_expired(goby::time::SteadyClock::time_point now = goby::time::SteadyClock::now());
+
+    /// \brief Number of incomplete transfers currently held
+    std::size_t pending() const { return transport_.size() + fast_packet_.size(); }
+
+  private:
+    struct Transfer
+    {
+        std::uint32_t pgn{0};
+        std::uint8_t priority{0};
+        std::uint8_t destination{0};
+        std::uint32_t size{0};
+        // J1939 TP: received[i] for packet i+1; fast packet: frames received so far in order
+        std::vector<bool> received;
+        std::uint32_t packets_received{0};
+        // fast packet sequence counter (upper 3 bits of the first byte)
+        std::uint8_t sequence{0};
+        std::string data;
+        goby::time::SteadyClock::time_point last_frame;
+    };
+
+    std::shared_ptr<protobuf::CanPGNMessage>
+    add_transport_management(const can_frame& frame, std::uint8_t priority, std::uint8_t source,
+                             std::uint8_t destination, goby::time::SteadyClock::time_point now);
+    std::shared_ptr<protobuf::CanPGNMessage>
+    add_transport_data(const can_frame& frame, std::uint8_t source, std::uint8_t destination,
+                       goby::time::SteadyClock::time_point now);
+    std::shared_ptr<protobuf::CanPGNMessage>
+    add_fast_packet(const can_frame& frame, std::uint32_t pgn, std::uint8_t priority,
+                    std::uint8_t source, std::uint8_t destination,
+                    goby::time::SteadyClock::time_point now);
+
+    bool expired(const Transfer& transfer, goby::time::SteadyClock::time_point now) const
+    {
+        return now - transfer.last_frame > timeout_;
+    }
+
+    std::shared_ptr<protobuf::CanPGNMessage> complete(const Transfer& transfer,
+                                                       std::uint8_t source);
+
+  private:
+    bool j1939_transport_protocol_;
+    std::set<std::uint32_t> fast_packet_pgns_;
+    goby::time::SteadyClock::duration timeout_;
+
+    // J1939 TP, keyed on (source, destination): one transfer at a time per connection
+    std::map<std::pair<std::uint8_t, std::uint8_t>, Transfer> transport_;
+    // fast packet, keyed on (source, pgn)
+    std::map<std::pair<std::uint8_t, std::uint32_t>, Transfer> fast_packet_;
+
+    // no transfer expires before this, so the sweep is skipped until then
+    goby::time::SteadyClock::time_point next_expiry_{goby::time::SteadyClock::time_point::max()};
+};
+} // namespace io
+} // namespace middleware
+} // namespace goby
+
+#endif
@@ -24,15 +24,20 @@
 #ifndef GOBY_MIDDLEWARE_IO_COBS_COMMON_H
 #define GOBY_MIDDLEWARE_IO_COBS_COMMON_H
 
-#include <memory>
+#include <algorithm> // for min
+#include <cstddef>   // for size_t, ptrdiff_t
+#include <cstdint>   // for uint8_t
+#include <cstring>   // for memchr, memcpy, memmove
+#include <memory>    // for shared_ptr
+#include <string>    // for string
 
-#include <boost/asio/read.hpp>  // for async_read
-#include <boost/asio/write.hpp> // for async_write
+#include <boost/asio/buffer.hpp>           // for buffer
+#include <boost/asio/buffers_iterator.hpp> // for buffers_begin
+#include <boost/asio/write.hpp>            // for async_write
 
 #include "goby/middleware/protobuf/io.pb.h"
 #include "goby/util/binary.h"
 #include "goby/util/debug_logger.h" // for glog
-#include "goby/util/thirdparty/cobs/cobs.h"
 
 namespace goby
 {
@@ -40,99 +45,176 @@ namespace middleware
 {
 namespace io
 {
-template <class Thread>
-void cobs_async_write(Thread* this_thread,
-                      std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg)
+namespace detail
 {
-    constexpr static char cobs_eol{0};
+// COBS blocks are a code byte followed by up to 254 non-zero bytes
+constexpr std::size_t cobs_max_run{254};
 
-    // COBS worst case is 1 byte for every 254 bytes of input
-    auto input_size = io_msg->data().size();
-    auto output_size_max = input_size + (input_size / 254) + 1;
-    std::string cobs_encoded(output_size_max, '\0');
-
-    auto cobs_size = cobs_encode(reinterpret_cast<const uint8_t*>(io_msg->data().data()),
-                                 input_size, reinterpret_cast<uint8_t*>(&cobs_encoded[0]));
-
-    if (cobs_size)
+/// \brief COBS encodes length bytes of input (without adding the delimiter), copying each run of non-zero bytes with memcpy
+///
+/// Produces the same output as cobs_encode() (util/thirdparty/cobs/cobs.h). output must have room for length + length / 254 + 1 bytes. Returns the encoded size.
+inline std::size_t cobs_stuff(const char* input, std::size_t length, char* output)
+{
+    const char* end = input + length;
+    char* out = output;
+    while (true)
     {
-        cobs_encoded.resize(cobs_size);
-        cobs_encoded += cobs_eol;
-
-        goby::glog.is_debug2() && goby::glog << group(this_thread->glog_group()) << "COBS ("
-                                             << cobs_encoded.size() << "B) <"
-                                             << " " << goby::util::hex_encode(cobs_encoded)
-                                             << std::endl;
-
-        boost::asio::async_write(this_thread->mutable_socket(), boost::asio::buffer(cobs_encoded),
-                                 [this_thread, cobs_encoded](const boost::system::error_code& ec,
-                                                             std::size_t bytes_transferred) {
-                                     if (!ec && bytes_transferred > 0)
-                                     {
-                                         this_thread->handle_write_success(bytes_transferred);
-                                     }
-                                     else
-                                     {
-                                         this_thread->handle_write_error(ec);
-                                     }
-                                 });
+        std::size_t run = std::min<std::size_t>(end - input, cobs_max_run);
+        auto zero = static_cast<const char*>(std::memchr(input, 0, run));
+        if (zero)
+            run = zero - input;
+
+        *out++ = static_cast<char>(run + 1);
+        std::memcpy(out, input, run);
+        out += run;
+        input += run;
+
+        if (zero)
+            ++input; // replaced by the code byte
+        else if (run < cobs_max_run)
+            return out - output;
     }
-    else
+}
+
+/// \brief Decodes a COBS packet (without its delimiter), copying each block with memmove so that output may be the same as input (decoding in place)
+///
+/// output must have room for length bytes. Returns the decoded size, or -1 if input is not valid COBS.
+inline std::ptrdiff_t cobs_unstuff(const char* input, std::size_t length, char* output)
+{
+    std::size_t read = 0, write = 0;
+    while (read < length)
     {
-        goby::glog.is_warn() && goby::glog << group(this_thread->glog_group())
-                                           << "Failed to encode COBS message: "
-                                           << goby::util::hex_encode(io_msg->data()) << std::endl;
-        this_thread->handle_write_error(boost::system::error_code());
+        std::size_t code = static_cast<std::uint8_t>(input[read]);
+        if (code == 0 || read + code > length)
+            return -1;
+        ++read;
+
+        std::size_t run = code - 1;
+        std::memmove(output + write, input + read, run);
+        read += run;
+        write += run;
+
+        if (code != cobs_max_run + 1 && read < length)
+            output[write++] = 0;
     }
+    return write;
+}
+} // namespace detail
+
+/// \brief COBS encodes data and appends the packet delimiter
+inline std::shared_ptr<const std::string> cobs_encode_packet(const std::string& data,
+                                                             const std::string& glog_group)
+{
+    constexpr static char cobs_eol{0};
+
+    // COBS worst case is 1 byte for every 254 bytes of input
+    auto input_size = data.size();
+    auto output_size_max = input_size + (input_size / detail::cobs_max_run) + 1;
+    auto cobs_encoded = std::make_shared<std::string>(output_size_max + 1, '\0');
+
+    auto cobs_size = detail::cobs_stuff(data.data(), input_size, &(*cobs_encoded)[0]);
+    (*cobs_encoded)[cobs_size] = cobs_eol;
+    cobs_encoded->resize(cobs_size + 1);
+
+    goby::glog.is_debug2() && goby::glog << group(glog_group) << "COBS (" << cobs_encoded->size()
+                                         << "B) <"
+                                         << " " << goby::util::logger::hex_string(*cobs_encoded)
+                                         << std::endl;
+    return cobs_encoded;
 }
 
+template <class Thread>
+void cobs_async_write(Thread* this_thread,
+                      std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg)
+{
+    auto cobs_encoded = cobs_encode_packet(io_msg->data(), this_thread->glog_group());
+
+    // capture cobs_encoded in callback to ensure write buffer exists until async_write is done
+    boost::asio::async_write(this_thread->mutable_socket(), boost::asio::buffer(*cobs_encoded),
+                             [this_thread, cobs_encoded](const boost::system::error_code& ec,
+                                                         std::size_t bytes_transferred) {
+                                 if (!ec && bytes_transferred > 0)
+                                 {
+                                     this_thread->handle_write_success(bytes_transferred);
+                                 }
+                                 else
+                                 {
+                                     this_thread->handle_write_error(ec);
+                                 }
+                             });
+}
+
+/// \brief Reads from the socket into this_thread->buffer_ (a boost::asio::streambuf), then decodes and publishes every complete packet received
+///
+/// Packets may be split across reads (the remainder stays in buffer_) or several may arrive in one read. Delimiters are found with memchr (vectorized in common C libraries), scanning each byte once, and packets are decoded directly from buffer_ into the (recycled) IOData.
 template <class Thread, class ThreadBase = Thread>
 void cobs_async_read(Thread* this_thread,
                      std::shared_ptr<ThreadBase> self = std::shared_ptr<ThreadBase>())
 {
-    constexpr static char cobs_eol{0};
+    constexpr static std::size_t read_size{4096};
 
-    boost::asio::async_read_until(
-        this_thread->mutable_socket(), this_thread->buffer_, cobs_eol,
+    this_thread->mutable_socket().async_read_some(
+        this_thread->buffer_.prepare(read_size),
         [this_thread, self](const boost::system::error_code& ec, std::size_t bytes_transferred) {
-            if (!ec && bytes_transferred > 0)
+            if (ec || bytes_transferred == 0)
             {
-                std::string bytes(bytes_transferred, '\0');
-                std::istream is(&this_thread->buffer_);
-                is.read(&bytes[0], bytes_transferred);
-
-                goby::glog.is_debug2() && goby::glog << group(this_thread->glog_group()) << "COBS ("
-                                                     << bytes.size() << "B) >"
-                                                     << " " << goby::util::hex_encode(bytes)
-                                                     << std::endl;
-
-                auto io_msg = std::make_shared<goby::middleware::protobuf::IOData>();
-                auto& cobs_decoded = *io_msg->mutable_data();
-                cobs_decoded = std::string(bytes_transferred, '\0');
-
-                int decoded_size =
-                    cobs_decode(reinterpret_cast<const uint8_t*>(bytes.data()), bytes_transferred,
-                                reinterpret_cast<uint8_t*>(&cobs_decoded[0]));
-                if (decoded_size)
-                {
-                    // decoded size includes final 0 so remove last byte?
-                    cobs_decoded.resize(decoded_size - 1);
-                    this_thread->handle_read_success(bytes_transferred, io_msg);
-                    this_thread->async_read();
-                }
-                else
-                {
-                    goby::glog.is_warn() && goby::glog << group(this_thread->glog_group())
-                                                       << "Failed to decode COBS message: "
-                                                       << goby::util::hex_encode(bytes)
-                                                       << std::endl;
-                    this_thread->handle_read_error(ec);
-                }
+                this_thread->handle_read_error(ec);
+                return;
             }
-            else
+
+            constexpr static char cobs_eol{0};
+            auto& buffer = this_thread->buffer_;
+            // all packets were consumed before this read, so only new bytes can hold delimiters
+            auto scanned = buffer.size();
+            buffer.commit(bytes_transferred);
+
+            // streambuf data is contiguous
+            const char* begin = &*boost::asio::buffers_begin(buffer.data());
+            const char* end = begin + buffer.size();
+            const char* packet = begin;
+            const char* eol;
+            while ((eol = static_cast<const char*>(
+                        std::memchr(begin + scanned, cobs_eol, end - (begin + scanned)))))
             {
-                this_thread->handle_read_error(ec);
+                std::size_t encoded_size = eol - packet;
+                scanned = eol + 1 - begin;
+
+                goby::glog.is_debug2() &&
+                    goby::glog << group(this_thread->glog_group()) << "COBS ("
+                               << encoded_size + 1 << "B) >"
+                               << " "
+                               << goby::util::logger::hex_string(std::string(packet, eol + 1))
+                               << std::endl;
+
+                // an empty packet (e.g. a leading delimiter to resynchronize) carries no data
+                if (encoded_size > 0)
+                {
+                    auto io_msg = this_thread->make_io_data();
+                    auto& cobs_decoded = *io_msg->mutable_data();
+                    cobs_decoded.resize(encoded_size);
+
+                    auto decoded_size =
+                        detail::cobs_unstuff(packet, encoded_size, &cobs_decoded[0]);
+                    if (decoded_size < 0)
+                    {
+                        goby::glog.is_warn() &&
+                            goby::glog << group(this_thread->glog_group())
+                                       << "Failed to decode COBS message: "
+                                       << goby::util::hex_encode(std::string(packet, eol + 1))
+                                       << std::endl;
+                        buffer.consume(buffer.size());
+                        this_thread->handle_read_error(ec);
+                        return;
+                    }
+
+                    cobs_decoded.resize(decoded_size);
+                    this_thread->handle_read_success(encoded_size + 1, io_msg);
+                }
+                packet = eol + 1;
             }
+
+            buffer.consume(packet - begin);
+            this_thread->async_read();
         });
 }
 
@@ -63,10 +63,6 @@ class TCPSessionCOBS : public detail::TCPSession<TCPServerThreadType>
     {
     }
 
-    template <class Thread>
-    friend void cobs_async_write(Thread* this_thread,
-                                 std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg);
-
     template <class Thread, class ThreadBase>
     friend void cobs_async_read(Thread* this_thread, std::shared_ptr<ThreadBase> self);
 
@@ -77,11 +73,6 @@ class TCPSessionCOBS : public detail::TCPSession<TCPServerThreadType>
         cobs_async_read(this, self);
     }
 
-    void async_write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg) override
-    {
-        cobs_async_write(this, io_msg);
-    }
-
   private:
     boost::asio::streambuf buffer_;
 };
@@ -110,6 +101,13 @@ class TCPServerThreadCOBS
     {
         std::make_shared<TCPSessionCOBS<Base>>(std::move(tcp_socket), *this)->start();
     }
+
+    /// \brief Encodes once for all the destination clients
+    std::shared_ptr<const std::string>
+    encode_write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg) override
+    {
+        return cobs_encode_packet(io_msg->data(), this->glog_group());
+    }
 };
 
 } // namespace io
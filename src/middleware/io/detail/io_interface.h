@@ -24,15 +24,20 @@
 #ifndef GOBY_MIDDLEWARE_IO_DETAIL_IO_INTERFACE_H
 #define GOBY_MIDDLEWARE_IO_DETAIL_IO_INTERFACE_H
 
-#include <chrono>    // for seconds
-#include <exception> // for exception
-#include <memory>    // for shared_ptr
-#include <mutex>     // for mutex, lock_...
-#include <ostream>   // for endl, size_t
-#include <string>    // for string, oper...
-#include <thread>    // for thread
-#include <unistd.h>  // for usleep
-
+#include <atomic>     // for atomic
+#include <chrono>     // for seconds
+#include <cstdint>    // for uint64_t
+#include <exception>  // for exception
+#include <functional> // for function
+#include <future>     // for promise
+#include <memory>     // for shared_ptr
+#include <mutex>      // for mutex, lock_...
+#include <ostream>    // for endl, size_t
+#include <string>     // for string, oper...
+#include <thread>     // for thread
+#include <unistd.h>   // for usleep
+
+#include <boost/asio/steady_timer.hpp> // for steady_timer
 #include <boost/asio/write.hpp>        // for async_write
 #include <boost/system/error_code.hpp> // for error_code
 
@@ -40,12 +45,20 @@
 #include "goby/middleware/application/multi_thread.h" // for SimpleThread
 #include "goby/middleware/common.h"                   // for thread_id
 #include "goby/middleware/io/groups.h"                // for status
+#include "goby/middleware/io/io_context_pool.h"       // for IOContextPool
 #include "goby/middleware/protobuf/io.pb.h"           // for IOError, IOS...
+#include "goby/time/simulation.h"                     // for SimulatorSettings
 #include "goby/time/steady_clock.h"                   // for SteadyClock
 #include "goby/util/asio_compat.h"
 #include "goby/util/debug_logger.h" // for glog
 
+#ifndef USE_BOOST_IO_SERVICE
+#include <boost/asio/post.hpp>   // for post
+#include <boost/asio/strand.hpp> // for strand
+#endif
+
 #include "io_transporters.h"
+#include "message_pool.h"
 
 namespace goby
 {
@@ -72,6 +85,19 @@ ProtobufEndpoint endpoint_convert(const ASIOEndpoint& asio_ep)
     return pb_ep;
 }
 
+/// \brief IOConfig::batch() if the configuration has one, otherwise the defaults (no batching)
+template <typename IOConfig>
+auto batch_config(const IOConfig& cfg, int) -> decltype(cfg.batch())
+{
+    return cfg.batch();
+}
+
+template <typename IOConfig>
+const protobuf::IOBatchConfig& batch_config(const IOConfig&, long)
+{
+    return protobuf::IOBatchConfig::default_instance();
+}
+
 template <const goby::middleware::Group& line_in_group,
           const goby::middleware::Group& line_out_group, PubSubLayer publish_layer,
           PubSubLayer subscribe_layer, typename IOConfig, typename SocketType,
@@ -91,8 +117,13 @@ class IOThread : public ThreadType<IOConfig>,
     /// \param config A reference to the configuration read by the main application at launch
     /// \param index Thread index for multiple instances in a given application (-1 indicates a single instance)
     /// \param glog_group String name for group to use for glog
+    ///
+    /// If IOContextPool is enabled, the socket is serviced by a shared pool worker (serialized by a strand) and this thread only handles incoming mail (loop() is not called).
+    ///
+    /// If the configuration has a \c batch (IOBatchConfig) with max_messages > 1, reads are published as protobuf::IODataBatch rather than individual protobuf::IOData.
     IOThread(const IOConfig& config, int index, std::string glog_group = "i/o")
-        : ThreadType<IOConfig>(config, this->loop_max_frequency(), index),
+        : ThreadType<IOConfig>(config, IOContextPool::enabled() ? 0 : this->loop_max_frequency(),
+                               index),
           IOPublishTransporter<
               IOThread<line_in_group, line_out_group, publish_layer, subscribe_layer, IOConfig,
                        SocketType, ThreadType, use_indexed_groups>,
@@ -101,9 +132,32 @@ class IOThread : public ThreadType<IOConfig>,
               IOThread<line_in_group, line_out_group, publish_layer, subscribe_layer, IOConfig,
                        SocketType, ThreadType, use_indexed_groups>,
               line_out_group, subscribe_layer, use_indexed_groups>(index),
+          batch_cfg_(batch_config(config, 0)),
+          io_data_pool_(MessagePool<protobuf::IOData>::create(batch_cfg_.pool_size())),
+          batch_pool_(MessagePool<protobuf::IODataBatch>::create(batch_cfg_.max_messages() > 1 ? 2
+                                                                                             : 0)),
           glog_group_(glog_group + " / t" + std::to_string(goby::middleware::gettid())),
           thread_name_(glog_group)
     {
+#ifndef USE_BOOST_IO_SERVICE
+        if (IOContextPool::enabled())
+        {
+            pooled_io_ = &IOContextPool::next();
+            strand_.reset(new Strand(pooled_io_->get_executor()));
+            reopen_timer_.reset(new boost::asio::steady_timer(*strand_));
+        }
+#endif
+
+        if (batch_cfg_.max_messages() > 1)
+        {
+#ifndef USE_BOOST_IO_SERVICE
+            batch_timer_.reset(new boost::asio::steady_timer(
+                io_executor<boost::asio::steady_timer::executor_type>()));
+#else
+            batch_timer_.reset(new boost::asio::steady_timer(io_));
+#endif
+        }
+
         auto data_out_callback =
             [this](std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg) {
                 if (!io_msg->has_index() || io_msg->index() == this->index())
@@ -123,6 +177,14 @@ class IOThread : public ThreadType<IOConfig>,
 
     void initialize() override
     {
+        this->set_name(thread_name_);
+
+        if (pooled())
+        {
+            dispatch_io([this]() { open_pooled(); });
+            return;
+        }
+
         // thread to handle synchonization between boost::asio and goby condition_variable signaling
         incoming_mail_notify_thread_.reset(new std::thread([this]() {
             while (this->alive())
@@ -133,12 +195,18 @@ class IOThread : public ThreadType<IOConfig>,
                 io_.post([]() {});
             }
         }));
-
-        this->set_name(thread_name_);
     }
 
     void finalize() override
     {
+        if (pooled())
+        {
+            close_pooled_io();
+            return;
+        }
+
+        publish_batch();
+
         // join incoming mail thread
         {
             std::lock_guard<std::mutex> l(incoming_mail_notify_mutex_);
@@ -150,6 +218,16 @@ class IOThread : public ThreadType<IOConfig>,
 
     virtual ~IOThread()
     {
+        // pooled mode: finalize() closes the I/O objects while the derived class still exists.
+        // Without it, close the ones owned by this class (the derived close_io() cannot be
+        // called from here) so that no handlers still refer to this
+        if (pooled() && !pooled_io_closed_)
+        {
+            goby::glog.is_warn() && goby::glog << group(glog_group_)
+                                               << "I/O thread destroyed without finalize()"
+                                               << std::endl;
+            close_pooled_io([this]() { socket_.reset(); });
+        }
         socket_.reset();
 
         // for non clean shutdown, avoid abort
@@ -168,12 +246,43 @@ class IOThread : public ThreadType<IOConfig>,
                                   std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg);
 
   protected:
+    /// \brief Writes the data to the socket, from the device strand when pooled (so it may be called from any subscription callback)
     void write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg)
+    {
+        dispatch_io([this, io_msg]() { write_now(io_msg); });
+    }
+
+    /// \brief Runs the handler on the device strand if pooled, otherwise immediately (this thread already runs all socket handlers)
+    ///
+    /// Use for subscription callbacks that access the socket directly.
+    template <typename Handler> void dispatch_io(Handler&& handler)
+    {
+#ifndef USE_BOOST_IO_SERVICE
+        if (strand_)
+        {
+            boost::asio::post(*strand_, std::forward<Handler>(handler));
+            return;
+        }
+#endif
+        handler();
+    }
+
+    /// \brief Are the socket handlers run by the shared IOContextPool?
+    bool pooled() const
+    {
+#ifndef USE_BOOST_IO_SERVICE
+        return strand_ != nullptr;
+#else
+        return false;
+#endif
+    }
+
+    void write_now(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg)
     {
         goby::glog.is_debug2() &&
             goby::glog << group(glog_group_) << "(" << io_msg->data().size() << "B) <"
                        << ((this->index() == -1) ? std::string() : std::to_string(this->index()))
-                       << " " << io_msg->ShortDebugString() << std::endl;
+                       << " " << goby::util::logger::debug_string(io_msg) << std::endl;
         if (io_msg->data().empty())
             return;
         if (!socket_ || !socket_->is_open())
@@ -182,10 +291,16 @@ class IOThread : public ThreadType<IOConfig>,
         this->async_write(io_msg);
     }
 
+    /// \brief Returns an empty IOData for a read, recycled from earlier reads once all their subscribers have released them
+    std::shared_ptr<goby::middleware::protobuf::IOData> make_io_data()
+    {
+        return io_data_pool_->make();
+    }
+
     void handle_read_success(std::size_t bytes_transferred, const std::string& bytes)
     {
-        auto io_msg = std::make_shared<goby::middleware::protobuf::IOData>();
-        *io_msg->mutable_data() = bytes;
+        auto io_msg = make_io_data();
+        io_msg->mutable_data()->assign(bytes);
 
         handle_read_success(bytes_transferred, io_msg);
     }
@@ -199,9 +314,12 @@ class IOThread : public ThreadType<IOConfig>,
         goby::glog.is_debug2() &&
             goby::glog << group(glog_group_) << "(" << bytes_transferred << "B) >"
                        << ((this->index() == -1) ? std::string() : std::to_string(this->index()))
-                       << " " << io_msg->ShortDebugString() << std::endl;
+                       << " " << goby::util::logger::debug_string(io_msg) << std::endl;
 
-        this->publish_in(io_msg);
+        if (batch_timer_)
+            add_to_batch(io_msg);
+        else
+            this->publish_in(io_msg);
     }
 
     void handle_write_success(std::size_t bytes_transferred) {}
@@ -217,7 +335,18 @@ class IOThread : public ThreadType<IOConfig>,
             throw goby::Exception("Attempted to access null socket/serial_port");
     }
 
-    boost::asio::io_context& mutable_io() { return io_; }
+    boost::asio::io_context& mutable_io() { return pooled_io_ ? *pooled_io_ : io_; }
+
+#ifndef USE_BOOST_IO_SERVICE
+    /// \brief Executor for new I/O objects: the device strand if pooled, otherwise this thread's io_context
+    template <typename Executor = typename SocketType::executor_type> Executor io_executor()
+    {
+        if (strand_)
+            return Executor(*strand_);
+        else
+            return Executor(io_.get_executor());
+    }
+#endif
 
     /// \brief Does the socket exist and is it open?
     bool socket_is_open() { return socket_ && socket_->is_open(); }
@@ -231,6 +360,9 @@ class IOThread : public ThreadType<IOConfig>,
     /// \brief Starts an asynchronous write from data published
     virtual void async_write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg) = 0;
 
+    /// \brief Closes all I/O objects on shutdown (pooled mode, called from the device strand)
+    virtual void close_io() { socket_.reset(); }
+
     const std::string& glog_group() { return glog_group_; }
 
   private:
@@ -240,10 +372,42 @@ class IOThread : public ThreadType<IOConfig>,
     /// \brief If the socket is not open, try to open it. Otherwise, block until either 1) data is read or 2) we have incoming mail
     void loop() override;
 
+    /// \brief Pooled mode equivalents of loop(): open the socket, or retry after the backoff interval
+    void open_pooled();
+    void schedule_reopen();
+
+    /// \brief Pooled mode: closes the I/O objects (using close_io()) and blocks until all their handlers have run
+    void close_pooled_io() { close_pooled_io([this]() { close_io(); }); }
+    void close_pooled_io(const std::function<void()>& close);
+
+    /// \brief Moves the read into the pending batch, publishing it if full
+    void add_to_batch(const std::shared_ptr<goby::middleware::protobuf::IOData>& io_msg);
+
+    /// \brief Publishes the pending batch (if any)
+    void publish_batch();
+
   private:
     boost::asio::io_context io_;
     std::unique_ptr<SocketType> socket_;
 
+    // pooled mode (IOContextPool::enabled())
+    boost::asio::io_context* pooled_io_{nullptr};
+#ifndef USE_BOOST_IO_SERVICE
+    using Strand = boost::asio::strand<boost::asio::io_context::executor_type>;
+    std::unique_ptr<Strand> strand_;
+    std::unique_ptr<boost::asio::steady_timer> reopen_timer_;
+#endif
+    std::atomic<bool> pooled_io_closed_{false};
+
+    const protobuf::IOBatchConfig batch_cfg_;
+    std::shared_ptr<MessagePool<protobuf::IOData>> io_data_pool_;
+    std::shared_ptr<MessagePool<protobuf::IODataBatch>> batch_pool_;
+    std::shared_ptr<protobuf::IODataBatch> batch_;
+    // identifies batch_ to the latency timer handler
+    std::uint64_t batch_number_{0};
+    // non-null if batching is enabled
+    std::unique_ptr<boost::asio::steady_timer> batch_timer_;
+
     const goby::time::SteadyClock::duration min_backoff_interval_{std::chrono::seconds(1)};
     const goby::time::SteadyClock::duration max_backoff_interval_{std::chrono::seconds(128)};
     goby::time::SteadyClock::duration backoff_interval_{min_backoff_interval_};
@@ -292,14 +456,19 @@ void goby::middleware::io::detail::IOThread<line_in_group, line_out_group, publi
 {
     try
     {
+#ifndef USE_BOOST_IO_SERVICE
+        socket_.reset(new SocketType(io_executor()));
+#else
         socket_.reset(new SocketType(io_));
+#endif
         open_socket();
 
         // messages read from the socket
         this->async_read();
 
         // reset io_context, which ran out of work
-        io_.reset();
+        if (!pooled())
+            io_.reset();
 
         // successful, reset backoff
         backoff_interval_ = min_backoff_interval_;
@@ -347,6 +516,79 @@ void goby::middleware::io::detail::IOThread<line_in_group, line_out_group, publi
     }
 }
 
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, typename IOConfig, typename SocketType,
+          template <class> class ThreadType, bool use_indexed_groups>
+void goby::middleware::io::detail::IOThread<line_in_group, line_out_group, publish_layer,
+                                            subscribe_layer, IOConfig, SocketType, ThreadType,
+                                            use_indexed_groups>::open_pooled()
+{
+    if (pooled_io_closed_)
+        return;
+
+    try_open();
+    if (!socket_is_open())
+        schedule_reopen();
+}
+
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, typename IOConfig, typename SocketType,
+          template <class> class ThreadType, bool use_indexed_groups>
+void goby::middleware::io::detail::IOThread<line_in_group, line_out_group, publish_layer,
+                                            subscribe_layer, IOConfig, SocketType, ThreadType,
+                                            use_indexed_groups>::schedule_reopen()
+{
+#ifndef USE_BOOST_IO_SERVICE
+    if (!strand_ || pooled_io_closed_)
+        return;
+
+    // next_open_attempt_ is in (possibly warped) SteadyClock time
+    auto wait = (next_open_attempt_ - goby::time::SteadyClock::now()) /
+                goby::time::SimulatorSettings::warp_factor;
+    reopen_timer_->expires_after(wait);
+    reopen_timer_->async_wait([this](const boost::system::error_code& ec) {
+        if (!ec)
+            open_pooled();
+    });
+#endif
+}
+
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, typename IOConfig, typename SocketType,
+          template <class> class ThreadType, bool use_indexed_groups>
+void goby::middleware::io::detail::IOThread<line_in_group, line_out_group, publish_layer,
+                                            subscribe_layer, IOConfig, SocketType, ThreadType,
+                                            use_indexed_groups>::
+    close_pooled_io(const std::function<void()>& close)
+{
+#ifndef USE_BOOST_IO_SERVICE
+    if (!strand_ || pooled_io_closed_)
+        return;
+
+    auto closed = std::make_shared<std::promise<void>>();
+    auto closed_future = closed->get_future();
+    boost::asio::post(*strand_, [this, closed, &close]() {
+        pooled_io_closed_ = true;
+        reopen_timer_->cancel();
+        publish_batch();
+        close();
+
+        // the pool io_context is single threaded, so the aborted handlers are queued ahead of
+        // this, and any they pass to the strand are queued ahead of the final handler
+        boost::asio::post(*pooled_io_, [this, closed]() {
+            boost::asio::post(*strand_, [closed]() { closed->set_value(); });
+        });
+    });
+    closed_future.wait();
+#endif
+}
+
 template <const goby::middleware::Group& line_in_group,
           const goby::middleware::Group& line_out_group,
           goby::middleware::io::PubSubLayer publish_layer,
@@ -388,6 +630,10 @@ void goby::middleware::io::detail::IOThread<
     line_in_group, line_out_group, publish_layer, subscribe_layer, IOConfig, SocketType, ThreadType,
     use_indexed_groups>::handle_read_error(const boost::system::error_code& ec)
 {
+    // expected cancellation from close_io()
+    if (pooled_io_closed_)
+        return;
+
     auto status = std::make_shared<protobuf::IOStatus>();
     if (this->index() != -1)
         status->set_index(this->index());
@@ -402,7 +648,11 @@ void goby::middleware::io::detail::IOThread<
                                        << "Failed to read from the socket/serial_port: "
                                        << error.ShortDebugString() << std::endl;
 
+    // don't hold back reads from before the failure
+    publish_batch();
+
     socket_.reset();
+    schedule_reopen();
 }
 
 template <const goby::middleware::Group& line_in_group,
@@ -414,6 +664,10 @@ void goby::middleware::io::detail::IOThread<
     line_in_group, line_out_group, publish_layer, subscribe_layer, IOConfig, SocketType, ThreadType,
     use_indexed_groups>::handle_write_error(const boost::system::error_code& ec)
 {
+    // expected cancellation from close_io()
+    if (pooled_io_closed_)
+        return;
+
     auto status = std::make_shared<protobuf::IOStatus>();
     if (this->index() != -1)
         status->set_index(this->index());
@@ -428,6 +682,64 @@ void goby::middleware::io::detail::IOThread<
                                        << "Failed to write to the socket/serial_port: "
                                        << error.ShortDebugString() << std::endl;
     socket_.reset();
+    schedule_reopen();
+}
+
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, typename IOConfig, typename SocketType,
+          template <class> class ThreadType, bool use_indexed_groups>
+void goby::middleware::io::detail::IOThread<
+    line_in_group, line_out_group, publish_layer, subscribe_layer, IOConfig, SocketType, ThreadType,
+    use_indexed_groups>::add_to_batch(const std::shared_ptr<goby::middleware::protobuf::IOData>&
+                                          io_msg)
+{
+    if (!batch_)
+    {
+        batch_ = batch_pool_->make();
+        if (this->index() != -1)
+            batch_->set_index(this->index());
+
+        // max_latency is in (possibly warped) SteadyClock time
+        auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration<double>(batch_cfg_.max_latency()) /
+            goby::time::SimulatorSettings::warp_factor);
+        auto batch_number = ++batch_number_;
+        batch_timer_->expires_from_now(latency);
+        batch_timer_->async_wait([this, batch_number](const boost::system::error_code& ec) {
+            if (!ec && batch_number == batch_number_)
+                publish_batch();
+        });
+    }
+
+    // swap rather than copy: io_msg (returned to the pool) takes the cleared data element left
+    // by the previous use of this batch, so both keep their allocated capacity
+    batch_->add_data()->Swap(io_msg.get());
+
+    if (batch_->data_size() >= static_cast<int>(batch_cfg_.max_messages()))
+        publish_batch();
+}
+
+template <const goby::middleware::Group& line_in_group,
+          const goby::middleware::Group& line_out_group,
+          goby::middleware::io::PubSubLayer publish_layer,
+          goby::middleware::io::PubSubLayer subscribe_layer, typename IOConfig, typename SocketType,
+          template <class> class ThreadType, bool use_indexed_groups>
+void goby::middleware::io::detail::IOThread<line_in_group, line_out_group, publish_layer,
+                                            subscribe_layer, IOConfig, SocketType, ThreadType,
+                                            use_indexed_groups>::publish_batch()
+{
+    if (!batch_)
+        return;
+
+    batch_timer_->cancel();
+    // invalidate a timer handler that has already been queued
+    ++batch_number_;
+
+    std::shared_ptr<protobuf::IODataBatch> batch;
+    batch.swap(batch_);
+    this->publish_in(batch);
 }
 
 #endif
@@ -0,0 +1,100 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_IO_DETAIL_MESSAGE_POOL_H
+#define GOBY_MIDDLEWARE_IO_DETAIL_MESSAGE_POOL_H
+
+#include <cstddef> // for size_t
+#include <memory>  // for shared_ptr, unique_ptr
+#include <mutex>   // for mutex, lock_guard
+#include <vector>  // for vector
+
+namespace goby
+{
+namespace middleware
+{
+namespace io
+{
+namespace detail
+{
+/// \brief Recycles Protobuf messages (and the capacity of their string and repeated fields) once the last shared_ptr to them is released
+///
+/// Messages are returned by the shared_ptr deleter, so they may be released from any thread. If the pool has been destroyed, they are simply deleted.
+template <typename Message>
+class MessagePool : public std::enable_shared_from_this<MessagePool<Message>>
+{
+  public:
+    /// \param max_idle Maximum number of released messages kept for reuse
+    static std::shared_ptr<MessagePool> create(std::size_t max_idle)
+    {
+        return std::shared_ptr<MessagePool>(new MessagePool(max_idle));
+    }
+
+    /// \brief Returns an empty message, reusing a released one if available
+    std::shared_ptr<Message> make()
+    {
+        std::unique_ptr<Message> msg;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!idle_.empty())
+            {
+                msg = std::move(idle_.back());
+                idle_.pop_back();
+            }
+        }
+        if (!msg)
+            msg.reset(new Message);
+
+        std::weak_ptr<MessagePool> weak_pool = this->shared_from_this();
+        return std::shared_ptr<Message>(msg.release(), [weak_pool](Message* released) {
+            if (auto pool = weak_pool.lock())
+                pool->recycle(released);
+            else
+                delete released;
+        });
+    }
+
+  private:
+    MessagePool(std::size_t max_idle) : max_idle_(max_idle) {}
+
+    void recycle(Message* released)
+    {
+        // Clear() keeps allocated strings and repeated field elements
+        released->Clear();
+        std::unique_ptr<Message> msg(released);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (idle_.size() < max_idle_)
+            idle_.push_back(std::move(msg));
+    }
+
+  private:
+    const std::size_t max_idle_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Message>> idle_;
+};
+} // namespace detail
+} // namespace io
+} // namespace middleware
+} // namespace goby
+
+#endif
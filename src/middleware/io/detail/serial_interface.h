@@ -126,8 +126,12 @@ class SerialThread : public IOThread<line_in_group, line_out_group, publish_laye
                 }
             };
 
+        // commands access the serial port so must run alongside its handlers
         this->template subscribe_out<goby::middleware::protobuf::SerialCommand>(
-            command_out_callback);
+            [this, command_out_callback](
+                std::shared_ptr<const goby::middleware::protobuf::SerialCommand> cmd) {
+                this->dispatch_io([command_out_callback, cmd]() { command_out_callback(cmd); });
+            });
 
         auto ready = ThreadState::SUBSCRIPTIONS_COMPLETE;
         this->interthread().template publish<line_in_group>(ready);
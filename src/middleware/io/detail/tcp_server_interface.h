@@ -24,11 +24,13 @@
 #ifndef GOBY_MIDDLEWARE_IO_DETAIL_TCP_SERVER_INTERFACE_H
 #define GOBY_MIDDLEWARE_IO_DETAIL_TCP_SERVER_INTERFACE_H
 
+#include <deque>   // for deque
 #include <memory>  // for shared_ptr
 #include <ostream> // for endl, basic_...
 #include <set>     // for set
 #include <string>  // for operator<<
 #include <utility> // for move
+#include <vector>  // for vector
 
 #include <boost/asio/buffer.hpp>       // for buffer
 #include <boost/asio/error.hpp>        // for eof, make_er...
@@ -121,22 +123,40 @@ class TCPSession : public std::enable_shared_from_this<TCPSession<TCPServerThrea
 
     const std::string& glog_group() { return server_.glog_group(); }
 
+    /// \brief Closes the socket, cancelling any outstanding operations
+    void close()
+    {
+        boost::system::error_code ec;
+        socket_.close(ec);
+    }
+
     // public so TCPServer can call this
-    virtual void async_write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg)
+    /// \brief Queues an encoded buffer (shared by all the destination clients) for writing
+    ///
+    /// If the client has fallen more than TCPServerConfig::max_client_backlog bytes behind, it is disconnected instead.
+    void async_write(std::shared_ptr<const std::string> buffer)
     {
-        auto self(this->shared_from_this());
-        boost::asio::async_write(
-            socket_, boost::asio::buffer(io_msg->data()),
-            [this, self, io_msg](boost::system::error_code ec, std::size_t bytes_transferred) {
-                if (!ec)
-                {
-                    this->handle_write_success(bytes_transferred);
-                }
-                else
-                {
-                    this->handle_write_error(ec);
-                }
-            });
+        if (buffer->empty())
+            return;
+
+        auto max_backlog = cfg().max_client_backlog();
+        if (max_backlog > 0 && !write_queue_.empty() &&
+            backlog_bytes_ + buffer->size() > max_backlog)
+        {
+            goby::glog.is_warn() && goby::glog << group(server_.glog_group()) << "Client "
+                                               << remote_endpoint_ << " has more than "
+                                               << max_backlog
+                                               << " bytes waiting to be written, disconnecting"
+                                               << std::endl;
+            close();
+            server_.clients_.erase(this->shared_from_this());
+            return;
+        }
+
+        write_queue_.push_back(buffer);
+        backlog_bytes_ += buffer->size();
+        if (!writing_)
+            write_queued();
     }
 
   protected:
@@ -146,10 +166,16 @@ class TCPSession : public std::enable_shared_from_this<TCPSession<TCPServerThrea
     }
     void handle_write_error(const boost::system::error_code& ec)
     {
-        goby::glog.is_warn() && goby::glog << "Write error: " << ec.message() << std::endl;
+        if (ec != boost::asio::error::operation_aborted)
+            goby::glog.is_warn() && goby::glog << "Write error: " << ec.message() << std::endl;
         server_.clients_.erase(this->shared_from_this());
     }
 
+    std::shared_ptr<goby::middleware::protobuf::IOData> make_io_data()
+    {
+        return server_.make_io_data();
+    }
+
     void handle_read_success(std::size_t bytes_transferred,
                              std::shared_ptr<goby::middleware::protobuf::IOData> io_msg)
     {
@@ -161,7 +187,7 @@ class TCPSession : public std::enable_shared_from_this<TCPSession<TCPServerThrea
 
     void handle_read_error(const boost::system::error_code& ec)
     {
-        if (ec != boost::asio::error::eof)
+        if (ec != boost::asio::error::eof && ec != boost::asio::error::operation_aborted)
             goby::glog.is_warn() && goby::glog << "Read error: " << ec.message() << std::endl;
         // erase ourselves from the client list to ensure destruction
         server_.clients_.erase(this->shared_from_this());
@@ -174,11 +200,49 @@ class TCPSession : public std::enable_shared_from_this<TCPSession<TCPServerThrea
   private:
     virtual void async_read() = 0;
 
+    /// \brief Writes everything queued with one gathered write
+    void write_queued()
+    {
+        writing_ = true;
+
+        std::vector<boost::asio::const_buffer> buffers;
+        buffers.reserve(write_queue_.size());
+        for (const auto& buffer : write_queue_) buffers.push_back(boost::asio::buffer(*buffer));
+
+        auto self(this->shared_from_this());
+        auto count = write_queue_.size();
+        boost::asio::async_write(
+            socket_, buffers,
+            [this, self, count](boost::system::error_code ec, std::size_t bytes_transferred) {
+                if (!ec)
+                {
+                    for (decltype(count) i = 0; i < count; ++i)
+                    {
+                        backlog_bytes_ -= write_queue_.front()->size();
+                        write_queue_.pop_front();
+                    }
+                    writing_ = false;
+                    this->handle_write_success(bytes_transferred);
+                    if (!write_queue_.empty())
+                        write_queued();
+                }
+                else
+                {
+                    this->handle_write_error(ec);
+                }
+            });
+    }
+
   private:
     boost::asio::ip::tcp::socket socket_;
     TCPServerThreadType& server_;
     boost::asio::ip::tcp::endpoint remote_endpoint_;
     boost::asio::ip::tcp::endpoint local_endpoint_;
+
+    // buffers are shared with the other clients; the front of the queue may be in progress
+    std::deque<std::shared_ptr<const std::string>> write_queue_;
+    std::size_t backlog_bytes_{0};
+    bool writing_{false};
 };
 
 template <const goby::middleware::Group& line_in_group,
@@ -199,7 +263,11 @@ class TCPServerThread
     /// \param config A reference to the Protocol Buffers config read by the main application at launch
     TCPServerThread(const Config& config, int index = -1)
         : Base(config, index, std::string("tcp-l: ") + std::to_string(config.bind_port())),
+#ifndef USE_BOOST_IO_SERVICE
+          tcp_socket_(this->template io_executor<boost::asio::ip::tcp::socket::executor_type>())
+#else
           tcp_socket_(this->mutable_io())
+#endif
     {
         auto ready = ThreadState::SUBSCRIPTIONS_COMPLETE;
         this->interthread().template publish<line_in_group>(ready);
@@ -217,10 +285,27 @@ class TCPServerThread
     /// \brief Starts an asynchronous write from data published
     void async_write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg) override;
 
+    /// \brief Returns the bytes to write to the client(s) for io_msg, or nullptr if it cannot be encoded
+    ///
+    /// Called once per message, and the result is shared by all the destination clients. The default writes io_msg->data() as is (without copying).
+    virtual std::shared_ptr<const std::string>
+    encode_write(std::shared_ptr<const goby::middleware::protobuf::IOData> io_msg)
+    {
+        return std::shared_ptr<const std::string>(io_msg, &io_msg->data());
+    }
+
     /// \brief Tries to open the tcp server acceptor, and if fails publishes an error
     void open_socket() override { open_acceptor(); }
     void open_acceptor();
 
+    /// \brief Closes the acceptor and all the client sessions
+    void close_io() override
+    {
+        for (auto& client : clients_) client->close();
+        clients_.clear();
+        Base::close_io();
+    }
+
     virtual void start_session(boost::asio::ip::tcp::socket tcp_socket) = 0;
 
   private:
@@ -324,13 +409,23 @@ void goby::middleware::io::detail::TCPServerThread<
         throw(goby::Exception("TCPServerThread requires 'tcp_dest' field to have 'addr'/'port' set "
                               "or all_clients=true in IOData"));
 
-    for (auto& client : clients_)
+    std::shared_ptr<const std::string> buffer;
+    for (auto it = clients_.begin(); it != clients_.end();)
     {
+        // advance first: a client that has fallen too far behind erases itself in async_write
+        auto client = *it++;
         if (io_msg->tcp_dest().all_clients() ||
             (io_msg->tcp_dest() ==
              endpoint_convert<protobuf::TCPEndPoint>(client->remote_endpoint())))
         {
-            client->async_write(io_msg);
+            // encode only once, and only if there is someone to send it to
+            if (!buffer)
+            {
+                buffer = encode_write(io_msg);
+                if (!buffer)
+                    return;
+            }
+            client->async_write(buffer);
         }
     }
 }
@@ -0,0 +1,139 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <exception> // for exception
+#include <ostream>   // for endl
+#include <string>    // for to_string
+#include <thread>    // for thread
+
+#include <pthread.h> // for pthread_setname_np
+
+#include "goby/exception.h"         // for Exception
+#include "goby/util/debug_logger.h" // for glog
+
+#include "io_context_pool.h"
+
+#ifndef USE_BOOST_IO_SERVICE
+#include <boost/asio/executor_work_guard.hpp> // for executor_work_guard
+
+struct goby::middleware::io::IOContextPool::Worker
+{
+    Worker(int index)
+        : io(1),
+          work(boost::asio::make_work_guard(io)),
+          thread([this, index]() { run(index); })
+    {
+#ifndef __APPLE__
+        std::string name = "goby::io/" + std::to_string(index);
+        pthread_setname_np(thread.native_handle(), name.c_str());
+#endif
+    }
+
+    void run(int index)
+    {
+        // a handler that throws only affects its own I/O thread, so keep servicing the others
+        while (true)
+        {
+            try
+            {
+                io.run();
+                return;
+            }
+            catch (const std::exception& e)
+            {
+                goby::glog.is_warn() && goby::glog << "IOContextPool worker " << index
+                                                   << ": exception from handler: " << e.what()
+                                                   << std::endl;
+            }
+        }
+    }
+
+    boost::asio::io_context io;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work;
+    std::thread thread;
+};
+#else
+// pooled mode requires executor-aware sockets (Boost 1.70+)
+struct goby::middleware::io::IOContextPool::Worker
+{
+    boost::asio::io_context io;
+};
+#endif
+
+goby::middleware::io::IOContextPool& goby::middleware::io::IOContextPool::instance()
+{
+    static IOContextPool pool;
+    return pool;
+}
+
+goby::middleware::io::IOContextPool::~IOContextPool()
+{
+#ifndef USE_BOOST_IO_SERVICE
+    for (auto& worker : workers_)
+    {
+        worker->work.reset();
+        worker->io.stop();
+    }
+    for (auto& worker : workers_) worker->thread.join();
+#endif
+}
+
+void goby::middleware::io::IOContextPool::configure(int threads)
+{
+    auto& pool = instance();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    if (!pool.workers_.empty() && threads != pool.threads_)
+        throw(goby::Exception("IOContextPool::configure() must be called before the pool is used"));
+
+#ifdef USE_BOOST_IO_SERVICE
+    if (threads > 0)
+        goby::glog.is_warn() && goby::glog << "IOContextPool requires Boost 1.70 or newer, "
+                                              "ignoring io_pool configuration"
+                                           << std::endl;
+#else
+    pool.threads_ = threads;
+#endif
+}
+
+bool goby::middleware::io::IOContextPool::enabled()
+{
+    auto& pool = instance();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    return pool.threads_ > 0;
+}
+
+boost::asio::io_context& goby::middleware::io::IOContextPool::next()
+{
+    auto& pool = instance();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    if (pool.threads_ <= 0)
+        throw(goby::Exception("IOContextPool::next() called without configured worker threads"));
+
+    if (pool.workers_.empty())
+    {
+        for (int i = 0; i < pool.threads_; ++i)
+            pool.workers_.emplace_back(new Worker(i));
+    }
+
+    return pool.workers_[pool.next_++ % pool.workers_.size()]->io;
+}
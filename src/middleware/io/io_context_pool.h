@@ -0,0 +1,72 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_IO_IO_CONTEXT_POOL_H
+#define GOBY_MIDDLEWARE_IO_IO_CONTEXT_POOL_H
+
+#include <cstddef> // for size_t
+#include <memory>  // for unique_ptr
+#include <mutex>   // for mutex
+#include <vector>  // for vector
+
+#include "goby/util/asio_compat.h" // for io_context
+
+namespace goby
+{
+namespace middleware
+{
+namespace io
+{
+/// \brief Process-wide set of io_contexts, each run by a single worker thread, that I/O threads share when AppConfig::io_pool::threads > 0
+///
+/// Each I/O thread is assigned one io_context (round-robin) and serializes its handlers with a strand.
+class IOContextPool
+{
+  public:
+    /// \brief Sets the number of worker threads. Must be called before the first I/O thread is constructed. Zero (the default) gives each I/O thread its own io_context.
+    static void configure(int threads);
+
+    /// \brief Is the pool configured with at least one worker thread?
+    static bool enabled();
+
+    /// \brief Returns the next io_context (round-robin), starting the workers on first use
+    static boost::asio::io_context& next();
+
+  private:
+    struct Worker;
+
+    IOContextPool() = default;
+    ~IOContextPool();
+    static IOContextPool& instance();
+
+  private:
+    std::mutex mutex_;
+    int threads_{0};
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::size_t next_{0};
+};
+} // namespace io
+} // namespace middleware
+} // namespace goby
+
+#endif
@@ -24,15 +24,24 @@
 #ifndef GOBY_MIDDLEWARE_IO_LINE_BASED_COMMON_H
 #define GOBY_MIDDLEWARE_IO_LINE_BASED_COMMON_H
 
-#include <atomic>   // for atomic
-#include <locale>   // for ctype, use_facet, locale
-#include <map>      // for map
-#include <regex>    // for _NFA, match_results, regex, regex_search
-#include <sstream>  // for basic_stringbuf<>::int_type, basic_stringbuf<>::...
-#include <stddef.h> // for size_t
-#include <string>   // for string
-#include <utility>  // for make_pair, pair
-#include <vector>   // for vector
+#include <algorithm> // for find
+#include <atomic>    // for atomic
+#include <bitset>    // for bitset
+#include <cctype>    // for isalnum
+#include <cstring>   // for memchr
+#include <locale>    // for ctype, use_facet, locale
+#include <map>       // for map
+#include <memory>    // for shared_ptr
+#include <regex>     // for _NFA, match_results, regex, regex_search
+#include <sstream>   // for basic_stringbuf<>::int_type, basic_stringbuf<>::...
+#include <stddef.h>  // for size_t
+#include <string>    // for string
+#include <utility>   // for make_pair, pair
+#include <vector>    // for vector
+
+#include <boost/asio/buffers_iterator.hpp> // for buffers_iterator
+#include <boost/asio/streambuf.hpp>        // for streambuf
+#include <boost/type_traits/integral_constant.hpp> // for true_type
 
 namespace boost
 {
@@ -86,6 +95,258 @@ class match_regex
     std::regex eol_regex_;
 };
 
+/// \brief Provides a matching function object for boost::asio::async_read_until that finds the end of line without std::regex where possible
+///
+/// End-of-line strings that are literals (e.g. "\r\n" or "\n") or fixed-width patterns built from literals, escapes, '.', bracket expressions and {n} repeats (e.g. "\\*[0-9A-F]{2}\r\n" for NMEA-0183 checksums) are found by scanning for the final character (with memchr for boost::asio::streambuf), and each search resumes where the previous one stopped. Other regular expressions fall back to match_regex.
+class match_eol
+{
+  public:
+    explicit match_eol(const std::string& eol)
+    {
+        if (!parse_fixed_width(eol))
+            regex_ = std::make_shared<const match_regex>(eol);
+    }
+
+    /// \brief true if the end-of-line string is matched without std::regex
+    bool is_fixed_width() const { return regex_ == nullptr; }
+
+    template <typename Iterator>
+    std::pair<Iterator, bool> operator()(Iterator begin, Iterator end) const
+    {
+        if (regex_)
+            return (*regex_)(begin, end);
+
+        const auto width = classes_.size();
+        if (static_cast<std::size_t>(end - begin) < width)
+            return std::make_pair(begin, false);
+
+        // position of the last character of the first possible match
+        Iterator last = begin + (width - 1);
+        while (true)
+        {
+            if (anchor_ >= 0)
+                last = find_char(last, end, static_cast<char>(anchor_));
+            else
+                while (last != end && !in_class(width - 1, *last)) ++last;
+
+            if (last == end)
+                break;
+
+            std::size_t i = 0;
+            Iterator it = last - (width - 1);
+            while (i < width - 1 && in_class(i, *it))
+            {
+                ++i;
+                ++it;
+            }
+            if (i == width - 1)
+                return std::make_pair(last + 1, true);
+
+            ++last;
+        }
+
+        // the next search begins at the earliest position a match could still start
+        return std::make_pair(end - (width - 1), false);
+    }
+
+  private:
+    using class_type = std::bitset<256>;
+    using streambuf_iterator =
+        boost::asio::buffers_iterator<boost::asio::streambuf::const_buffers_type>;
+
+    bool in_class(std::size_t i, char c) const
+    {
+        return classes_[i][static_cast<unsigned char>(c)];
+    }
+
+    template <typename Iterator> static Iterator find_char(Iterator begin, Iterator end, char c)
+    {
+        return std::find(begin, end, c);
+    }
+
+    static streambuf_iterator find_char(streambuf_iterator begin, streambuf_iterator end, char c)
+    {
+        // the input sequence of a basic_streambuf is a single contiguous array
+        if (begin == end)
+            return end;
+        const char* data = &*begin;
+        const void* found = std::memchr(data, c, end - begin);
+        return found ? begin + (static_cast<const char*>(found) - data) : end;
+    }
+
+    static const char* find_char(const char* begin, const char* end, char c)
+    {
+        const void* found = std::memchr(begin, c, end - begin);
+        return found ? static_cast<const char*>(found) : end;
+    }
+
+    // parse the subset of ECMAScript regular expressions that always matches a fixed number of characters
+    bool parse_fixed_width(const std::string& eol)
+    {
+        for (std::string::size_type i = 0, n = eol.size(); i < n; ++i)
+        {
+            class_type c;
+            switch (eol[i])
+            {
+                case '\\':
+                    if (++i == n || !parse_escape(eol[i], &c))
+                        return false;
+                    break;
+
+                case '.':
+                    c.set();
+                    c.reset('\n');
+                    c.reset('\r');
+                    break;
+
+                case '[':
+                    if (!parse_bracket(eol, &i, &c))
+                        return false;
+                    break;
+
+                case '{':
+                {
+                    // exact repeat count of the previous atom only
+                    auto close = eol.find('}', i);
+                    if (classes_.empty() || close == std::string::npos || close == i + 1)
+                        return false;
+                    std::size_t count = 0;
+                    for (auto j = i + 1; j < close; ++j)
+                    {
+                        if (eol[j] < '0' || eol[j] > '9')
+                            return false;
+                        count = count * 10 + (eol[j] - '0');
+                    }
+                    if (count == 0 || count > 1024)
+                        return false;
+                    classes_.insert(classes_.end(), count - 1, classes_.back());
+                    i = close;
+                    continue;
+                }
+
+                case '*':
+                case '+':
+                case '?':
+                case '(':
+                case ')':
+                case '|':
+                case '^':
+                case '$':
+                case ']':
+                case '}': return false;
+
+                default: c.set(static_cast<unsigned char>(eol[i])); break;
+            }
+            classes_.push_back(c);
+        }
+
+        if (classes_.empty())
+            return false;
+
+        if (classes_.back().count() == 1)
+        {
+            for (int a = 0; a < 256; ++a)
+                if (classes_.back()[a])
+                    anchor_ = a;
+        }
+        return true;
+    }
+
+    // literal character for the escape sequence "\\e", or -1 if it is not a literal
+    static int escaped_char(char e)
+    {
+        switch (e)
+        {
+            case 'r': return '\r';
+            case 'n': return '\n';
+            case 't': return '\t';
+            case 'f': return '\f';
+            case 'v': return '\v';
+            default:
+                // other letters and digits are character classes, anchors or back-references
+                return std::isalnum(static_cast<unsigned char>(e)) ? -1
+                                                                   : static_cast<unsigned char>(e);
+        }
+    }
+
+    static bool parse_escape(char e, class_type* c)
+    {
+        if (e == 'd')
+        {
+            for (char d = '0'; d <= '9'; ++d) c->set(static_cast<unsigned char>(d));
+            return true;
+        }
+
+        int ch = escaped_char(e);
+        if (ch < 0)
+            return false;
+        c->set(ch);
+        return true;
+    }
+
+    static bool parse_bracket(const std::string& eol, std::string::size_type* i, class_type* c)
+    {
+        auto n = eol.size();
+        auto j = *i + 1;
+        bool negate = (j < n && eol[j] == '^');
+        if (negate)
+            ++j;
+
+        // empty ("[]") and unterminated expressions are left to std::regex
+        if (j == n || eol[j] == ']')
+            return false;
+
+        for (; j < n && eol[j] != ']'; ++j)
+        {
+            int lo = static_cast<unsigned char>(eol[j]);
+            if (eol[j] == '\\')
+            {
+                if (++j == n)
+                    return false;
+                if (eol[j] == 'd')
+                {
+                    parse_escape(eol[j], c);
+                    continue;
+                }
+                if ((lo = escaped_char(eol[j])) < 0)
+                    return false;
+            }
+            else if (eol[j] == '[')
+            {
+                // [:alpha:] and similar
+                return false;
+            }
+
+            if (j + 2 < n && eol[j + 1] == '-' && eol[j + 2] != ']')
+            {
+                int hi = static_cast<unsigned char>(eol[j + 2]);
+                if (hi == '\\' || hi == '[' || hi < lo)
+                    return false;
+                for (int ch = lo; ch <= hi; ++ch) c->set(ch);
+                j += 2;
+            }
+            else
+            {
+                c->set(lo);
+            }
+        }
+
+        if (j == n)
+            return false;
+
+        if (negate)
+            c->flip();
+        *i = j;
+        return true;
+    }
+
+  private:
+    std::vector<class_type> classes_;
+    // final character if the last class is a single character, otherwise -1
+    int anchor_{-1};
+    std::shared_ptr<const match_regex> regex_;
+};
+
 } // namespace io
 } // namespace middleware
 } // namespace goby
@@ -97,6 +358,9 @@ namespace asio
 template <> struct is_match_condition<goby::middleware::io::match_regex> : public boost::true_type
 {
 };
+template <> struct is_match_condition<goby::middleware::io::match_eol> : public boost::true_type
+{
+};
 } // namespace asio
 } // namespace boost
 
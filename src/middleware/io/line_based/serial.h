@@ -33,7 +33,7 @@
 
 #include "goby/middleware/io/detail/io_interface.h"     // for PubSubLayer
 #include "goby/middleware/io/detail/serial_interface.h" // for SerialThread
-#include "goby/middleware/io/line_based/common.h"       // for match_regex
+#include "goby/middleware/io/line_based/common.h"       // for match_eol
 
 namespace goby
 {
@@ -91,7 +91,7 @@ class SerialThreadLineBased
     void async_read() override;
 
   private:
-    match_regex eol_matcher_;
+    match_eol eol_matcher_;
     boost::asio::streambuf buffer_;
 };
 } // namespace io
@@ -146,9 +146,9 @@ void goby::middleware::io::UDPOneToManyThread<line_in_group, line_out_group, pub
         [this](const boost::system::error_code& ec, size_t bytes_transferred) {
             if (!ec && bytes_transferred > 0)
             {
-                auto io_msg = std::make_shared<goby::middleware::protobuf::IOData>();
-                *io_msg->mutable_data() =
-                    std::string(rx_message_.begin(), rx_message_.begin() + bytes_transferred);
+                auto io_msg = this->make_io_data();
+                io_msg->mutable_data()->assign(rx_message_.begin(),
+                                               rx_message_.begin() + bytes_transferred);
 
                 *io_msg->mutable_udp_src() =
                     detail::endpoint_convert<protobuf::UDPEndPoint>(sender_endpoint_);
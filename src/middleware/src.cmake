@@ -13,6 +13,8 @@ protobuf_generate_cpp(MIDDLEWARE_PROTO_SRCS MIDDLEWARE_PROTO_HDRS
   middleware/protobuf/can_config.proto
   middleware/protobuf/udp_config.proto
   middleware/protobuf/coroner.proto
+  middleware/protobuf/thread_scheduling.proto
+  middleware/protobuf/transport_metrics.proto
   middleware/protobuf/layer.proto
   middleware/protobuf/geographic.proto
   middleware/protobuf/frontseat.proto
@@ -29,11 +31,17 @@ set(MIDDLEWARE_SRC
   middleware/marshalling/interface.cpp
   middleware/marshalling/detail/dccl_serializer_parser.cpp 
   middleware/transport/interthread.cpp
+  middleware/transport/metrics.cpp
   middleware/transport/intervehicle/driver_thread.cpp
   middleware/application/configuration_reader.cpp
+  middleware/application/scheduling.cpp
   middleware/log/log_entry.cpp
   middleware/frontseat/interface.cpp
   middleware/coroner/coroner.cpp
+  middleware/coroner/profiler.cpp
+  middleware/coroner/resources.cpp
+  middleware/io/io_context_pool.cpp
+  middleware/io/can_reassembly.cpp
   ${MIDDLEWARE_PROTO_SRCS} ${MIDDLEWARE_PROTO_HDRS} 
   )
 
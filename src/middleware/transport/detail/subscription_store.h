@@ -35,7 +35,12 @@
 #include <unordered_map>
 #include <vector>
 
+#include <boost/core/demangle.hpp>
+
+#include "goby/middleware/coroner/profiler.h"
+#include "goby/middleware/transport/metrics.h"
 #include "goby/middleware/transport/publisher.h"
+#include "goby/time/discrete_event.h"
 
 namespace goby
 {
@@ -191,6 +196,13 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
     static void publish(std::shared_ptr<const Data> data, const Group& group,
                         const Publisher<Data>& publisher)
     {
+        const bool metrics = TransportMetrics::enabled();
+        if (metrics)
+            TransportMetrics::published(protobuf::LAYER_INTERTHREAD, group, type_name());
+        // only read the clock for the dispatch latency when profiling
+        auto publish_time = CallbackProfiler::enabled() ? CallbackProfiler::Clock::now()
+                                                        : CallbackProfiler::Clock::time_point();
+
         // push new data
         // build up local vector of relevant condition variables while locked
         std::vector<detail::DataProtection> cv_to_notify;
@@ -208,7 +220,10 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
                     // protect the DataQueue we are writing to
                     std::unique_lock<std::mutex> lock(*(data_protection_.at(thread_id).data_mutex));
                     auto queue_it = data_.find(thread_id);
-                    queue_it->second.insert(group, data);
+                    queue_it->second.insert(group, data, publish_time);
+                    if (metrics)
+                        TransportMetrics::queued(protobuf::LAYER_INTERTHREAD, group, type_name(),
+                                                 queue_it->second.size(group));
                     cv_to_notify.push_back(data_protection_.at(thread_id));
                 }
             }
@@ -224,6 +239,9 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
 
                 std::lock_guard<std::timed_mutex>(*data_protection.poller_mutex);
             }
+            // keep the simulation time from advancing before the subscriber has handled the data
+            if (time::DiscreteEventClock::enabled())
+                time::DiscreteEventClock::wake(data_protection.poller_cv.get());
             data_protection.poller_cv->notify_all();
         }
     }
@@ -232,9 +250,7 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
     int poll(std::thread::id thread_id,
              std::unique_ptr<std::unique_lock<std::timed_mutex>>& lock) override
     {
-        std::vector<std::pair<std::shared_ptr<typename Callback::CallbackType>,
-                              std::shared_ptr<const Data>>>
-            data_callbacks;
+        std::vector<PendingCallback> data_callbacks;
         int poll_items_count = 0;
 
         {
@@ -260,23 +276,46 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
                         continue;
 
                     // store the callback function and datum for all the elements queued
-                    for (auto& datum : data_it->second)
+                    for (auto& queued : data_it->second)
                     {
                         ++poll_items_count;
                         // we have data, no need to keep this lock any longer
                         if (lock)
                             lock.reset();
-                        data_callbacks.push_back(
-                            std::make_pair(group_it->second->second.callback, datum));
+                        data_callbacks.push_back({group_it->second->second.callback,
+                                                  queued.datum, group, queued.publish_time});
                     }
                 }
                 queue_it->second.clear(group);
             }
         }
 
+        if (TransportMetrics::enabled())
+        {
+            for (const auto& pending : data_callbacks)
+                TransportMetrics::received(protobuf::LAYER_INTERTHREAD, pending.group,
+                                           type_name());
+        }
+
         // now that we're no longer blocking the subscription or data mutex, actually run the callbacks
-        for (const auto& callback_datum_pair : data_callbacks)
-            (*callback_datum_pair.first)(std::move(callback_datum_pair.second));
+        if (CallbackProfiler::enabled())
+        {
+            auto& profiler = CallbackProfiler::this_thread();
+            for (const auto& pending : data_callbacks)
+            {
+                auto start = CallbackProfiler::Clock::now();
+                // zero if profiling was enabled after this was published
+                if (pending.publish_time != CallbackProfiler::Clock::time_point())
+                    profiler.dispatch(start - pending.publish_time);
+                (*pending.callback)(pending.datum);
+                profiler.handler(pending.group, type_name(),
+                                 CallbackProfiler::Clock::now() - start);
+            }
+        }
+        else
+        {
+            for (const auto& pending : data_callbacks) (*pending.callback)(pending.datum);
+        }
 
         return poll_items_count;
     }
@@ -307,6 +346,12 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
     }
 
   private:
+    static const std::string& type_name()
+    {
+        static const std::string name(boost::core::demangle(typeid(Data).name()));
+        return name;
+    }
+
     struct Callback
     {
         using CallbackType = std::function<void(std::shared_ptr<const Data>)>;
@@ -318,25 +363,42 @@ template <typename Data> class SubscriptionStore : public SubscriptionStoreBase
         std::shared_ptr<CallbackType> callback;
     };
 
+    struct QueuedDatum
+    {
+        std::shared_ptr<const Data> datum;
+        // only set when the CallbackProfiler is enabled
+        CallbackProfiler::Clock::time_point publish_time;
+    };
+
+    struct PendingCallback
+    {
+        std::shared_ptr<typename Callback::CallbackType> callback;
+        std::shared_ptr<const Data> datum;
+        Group group;
+        CallbackProfiler::Clock::time_point publish_time;
+    };
+
     class DataQueue
     {
       private:
-        std::unordered_map<Group, std::vector<std::shared_ptr<const Data>>> data_;
+        std::unordered_map<Group, std::vector<QueuedDatum>> data_;
 
       public:
         void create(const Group& g)
         {
             auto it = data_.find(g);
             if (it == data_.end())
-                data_.insert(std::make_pair(g, std::vector<std::shared_ptr<const Data>>()));
+                data_.insert(std::make_pair(g, std::vector<QueuedDatum>()));
         }
         void remove(const Group& g) { data_.erase(g); }
 
-        void insert(const Group& g, std::shared_ptr<const Data> datum)
+        void insert(const Group& g, std::shared_ptr<const Data> datum,
+                    CallbackProfiler::Clock::time_point publish_time)
         {
-            data_.find(g)->second.push_back(datum);
+            data_.find(g)->second.push_back({std::move(datum), publish_time});
         }
         void clear(const Group& g) { data_.find(g)->second.clear(); }
+        std::size_t size(const Group& g) { return data_.find(g)->second.size(); }
         bool empty() { return data_.empty(); }
         typename decltype(data_)::const_iterator cbegin() { return data_.begin(); }
         typename decltype(data_)::const_iterator cend() { return data_.end(); }
@@ -39,6 +39,9 @@
 #include "goby/middleware/transport/detail/type_helpers.h"
 #include "goby/middleware/transport/publisher.h"
 #include "goby/middleware/transport/subscriber.h"
+#include "goby/time/discrete_event.h"
+#include "goby/time/steady_clock.h"
+#include "goby/time/system_clock.h"
 #include "goby/util/debug_logger.h"
 
 namespace goby
@@ -182,6 +185,36 @@ class PollerInterface
     template <class Clock = std::chrono::system_clock, class Duration = typename Clock::duration>
     int _poll_all(const std::chrono::time_point<Clock, Duration>& timeout);
 
+    // time to wait until for a given timeout: the goby::time clocks may be warped, so these
+    // are converted to the equivalent (real) std::chrono::steady_clock time
+    template <class Clock, class Duration>
+    static std::chrono::time_point<Clock, Duration>
+    real_timeout(const std::chrono::time_point<Clock, Duration>& timeout)
+    {
+        return timeout;
+    }
+    template <class Duration>
+    static std::chrono::steady_clock::time_point
+    real_timeout(const std::chrono::time_point<time::SteadyClock, Duration>& timeout)
+    {
+        return unwarp_timeout(timeout);
+    }
+    template <class Duration>
+    static std::chrono::steady_clock::time_point
+    real_timeout(const std::chrono::time_point<time::SystemClock, Duration>& timeout)
+    {
+        return unwarp_timeout(timeout);
+    }
+    template <class Clock, class Duration>
+    static std::chrono::steady_clock::time_point
+    unwarp_timeout(const std::chrono::time_point<Clock, Duration>& timeout)
+    {
+        return std::chrono::steady_clock::now() +
+               std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout -
+                                                                               Clock::now()) /
+                   time::SimulatorSettings::warp_factor;
+    }
+
     std::shared_ptr<std::timed_mutex> poll_mutex_;
     // signaled when there's no data for this thread to read during _poll()
     std::shared_ptr<std::condition_variable_any> cv_;
@@ -365,6 +398,17 @@ int goby::middleware::PollerInterface::_poll_all(
         new std::unique_lock<std::timed_mutex>(*poll_mutex_));
     //    std::cout << std::this_thread::get_id() <<  " _poll_all locking: " << poll_mutex_.get() << std::endl;
 
+    // wait in simulation time, which jumps to the earliest deadline once all the participating
+    // threads are idle. The deadline is computed once: for a timeout on a real clock, recomputing
+    // it after a wakeup would add the real time remaining to the (advanced) simulation time
+    const bool discrete_event = time::DiscreteEventClock::enabled();
+    const auto discrete_event_deadline =
+        (!discrete_event || timeout == Clock::time_point::max())
+            ? time::DiscreteEventClock::time_point::max()
+            : time::DiscreteEventClock::now() +
+                  std::chrono::duration_cast<time::DiscreteEventClock::duration>(timeout -
+                                                                                 Clock::now());
+
     int poll_items = _transporter_poll(lock);
     while (poll_items == 0)
     {
@@ -372,7 +416,15 @@ int goby::middleware::PollerInterface::_poll_all(
             throw(goby::Exception(
                 "Poller lock was released by poll() but no poll items were returned"));
 
-        if (timeout == Clock::time_point::max())
+        if (discrete_event)
+        {
+            if (time::DiscreteEventClock::wait_until(*lock, poll_mutex_, cv_,
+                                                     discrete_event_deadline))
+                poll_items = _transporter_poll(lock);
+            else
+                return poll_items;
+        }
+        else if (timeout == Clock::time_point::max())
         {
             cv_->wait(*lock); // wait_until doesn't work well with time_point::max()
             poll_items = _transporter_poll(lock);
@@ -386,7 +438,7 @@ int goby::middleware::PollerInterface::_poll_all(
         }
         else
         {
-            if (cv_->wait_until(*lock, timeout) == std::cv_status::no_timeout)
+            if (cv_->wait_until(*lock, real_timeout(timeout)) == std::cv_status::no_timeout)
                 poll_items = _transporter_poll(lock);
             else
                 return poll_items;
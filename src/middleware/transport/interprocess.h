@@ -37,6 +37,7 @@
 #include "goby/middleware/marshalling/interface.h"
 #include "goby/middleware/transport/null.h"
 #include "goby/middleware/transport/poller.h"
+#include "goby/middleware/transport/rate_limit.h"
 #include "goby/middleware/transport/serialization_handlers.h"
 
 namespace goby
@@ -61,10 +62,15 @@ class InterProcessTransporterBase
 
   public:
     InterProcessTransporterBase(InnerTransporter& inner)
-        : InterfaceType(inner), PollerType(&this->inner())
+        : InterfaceType(inner),
+          PollerType(&this->inner()),
+          rate_limiter_(protobuf::LAYER_INTERPROCESS)
+    {
+    }
+    InterProcessTransporterBase()
+        : PollerType(&this->inner()), rate_limiter_(protobuf::LAYER_INTERPROCESS)
     {
     }
-    InterProcessTransporterBase() : PollerType(&this->inner()) {}
 
     virtual ~InterProcessTransporterBase() {}
 
@@ -80,7 +86,8 @@ class InterProcessTransporterBase
                          const Publisher<Data>& publisher = Publisher<Data>())
     {
         check_validity_runtime(group);
-        static_cast<Derived*>(this)->template _publish<Data, scheme>(data, group, publisher);
+        if (rate_limit_allow<Data, scheme>(data, group, publisher))
+            static_cast<Derived*>(this)->template _publish<Data, scheme>(data, group, publisher);
         this->inner().template publish_dynamic<Data, scheme>(data, group, publisher);
     }
 
@@ -98,7 +105,9 @@ class InterProcessTransporterBase
         if (data)
         {
             check_validity_runtime(group);
-            static_cast<Derived*>(this)->template _publish<Data, scheme>(*data, group, publisher);
+            if (rate_limit_allow<Data, scheme>(*data, group, publisher))
+                static_cast<Derived*>(this)->template _publish<Data, scheme>(*data, group,
+                                                                             publisher);
             this->inner().template publish_dynamic<Data, scheme>(data, group, publisher);
         }
     }
@@ -265,6 +274,9 @@ class InterProcessTransporterBase
             throw(goby::Exception("Group must have a non-empty string for use on InterProcess"));
     }
 
+    /// \brief Number of publications suppressed on this layer by TransporterConfig::rate_limit
+    std::uint64_t rate_limit_suppressed() const { return rate_limiter_.suppressed(); }
+
   protected:
     static constexpr Group to_portal_group_{"goby::middleware::interprocess::to_portal"};
     static constexpr Group regex_group_{"goby::middleware::interprocess::regex"};
@@ -276,6 +288,17 @@ class InterProcessTransporterBase
     {
         return static_cast<Derived*>(this)->_poll(lock);
     }
+
+    template <typename Data, int scheme>
+    bool rate_limit_allow(const Data& data, const Group& group, const Publisher<Data>& publisher)
+    {
+        return rate_limiter_.template allow<Data>(group, scheme, publisher.cfg(), [&]() {
+            return SerializerParserHelper<Data, scheme>::type_name(data);
+        });
+    }
+
+  private:
+    PublicationRateLimiter rate_limiter_;
 };
 
 template <typename Derived, typename InnerTransporter>
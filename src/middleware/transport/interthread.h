@@ -29,6 +29,8 @@
 #include <mutex>      // for mutex
 #include <thread>     // for get_id
 
+#include <boost/core/demangle.hpp> // for demangle
+
 #include "goby/exception.h"                                      // for Exc...
 #include "goby/middleware/group.h"                               // for Group
 #include "goby/middleware/marshalling/interface.h"               // for Mar...
@@ -37,6 +39,7 @@
 #include "goby/middleware/transport/null.h"                      // for Nul...
 #include "goby/middleware/transport/poller.h"                    // for Poller
 #include "goby/middleware/transport/publisher.h"                 // for Pub...
+#include "goby/middleware/transport/rate_limit.h"                // for Pub...
 #include "goby/middleware/transport/subscriber.h"                // for Sub...
 
 namespace goby
@@ -63,7 +66,10 @@ class InterThreadTransporter
     };
 
   public:
-    InterThreadTransporter() : data_mutex_(std::make_shared<std::mutex>()) {}
+    InterThreadTransporter()
+        : data_mutex_(std::make_shared<std::mutex>()), rate_limiter_(protobuf::LAYER_INTERTHREAD)
+    {
+    }
 
     virtual ~InterThreadTransporter()
     {
@@ -101,8 +107,11 @@ class InterThreadTransporter
                          const Publisher<Data>& publisher = Publisher<Data>())
     {
         check_validity_runtime(group);
+        // check before copying
+        if (!rate_limit_allow<Data>(group, publisher))
+            return;
         std::shared_ptr<Data> data_ptr(new Data(data));
-        publish_dynamic<Data>(data_ptr, group, publisher);
+        detail::SubscriptionStore<Data>::publish(data_ptr, group, publisher);
     }
 
     /// \brief Publish a message using a run-time defined DynamicGroup (shared pointer to const data variant). Where possible, prefer the static variant in StaticTransporterInterface::publish()
@@ -117,7 +126,8 @@ class InterThreadTransporter
                          const Publisher<Data>& publisher = Publisher<Data>())
     {
         check_validity_runtime(group);
-        detail::SubscriptionStore<Data>::publish(data, group, publisher);
+        if (rate_limit_allow<Data>(group, publisher))
+            detail::SubscriptionStore<Data>::publish(data, group, publisher);
     }
 
     /// \brief Publish a message using a run-time defined DynamicGroup (shared pointer to mutable data variant). Where possible, prefer the static variant in StaticTransporterInterface::publish()
@@ -200,6 +210,9 @@ class InterThreadTransporter
         detail::SubscriptionStoreBase::unsubscribe_all(std::this_thread::get_id());
     }
 
+    /// \brief Number of publications suppressed on this layer by TransporterConfig::rate_limit
+    std::uint64_t rate_limit_suppressed() const { return rate_limiter_.suppressed(); }
+
   private:
     friend Poller<InterThreadTransporter>;
     int _poll(std::unique_ptr<std::unique_lock<std::timed_mutex>>& lock)
@@ -207,9 +220,20 @@ class InterThreadTransporter
         return detail::SubscriptionStoreBase::poll_all(std::this_thread::get_id(), lock);
     }
 
+    template <typename Data>
+    bool rate_limit_allow(const Group& group, const Publisher<Data>& publisher)
+    {
+        return rate_limiter_.allow<Data>(group, MarshallingScheme::CXX_OBJECT, publisher.cfg(),
+                                         []() -> std::string {
+                                             return boost::core::demangle(typeid(Data).name());
+                                         });
+    }
+
   private:
     // protects this thread's DataQueue
     std::shared_ptr<std::mutex> data_mutex_;
+
+    PublicationRateLimiter rate_limiter_;
 };
 
 } // namespace middleware
@@ -38,6 +38,8 @@
 #include "goby/middleware/transport/interthread.h" // used for InterVehiclePortal implementation
 #include "goby/middleware/transport/intervehicle/driver_thread.h"
 #include "goby/middleware/transport/intervehicle/groups.h"
+#include "goby/middleware/transport/metrics.h"
+#include "goby/middleware/transport/rate_limit.h"
 #include "goby/middleware/transport/serialization_handlers.h"
 
 namespace goby
@@ -86,7 +88,9 @@ class InterVehicleTransporterBase
     };
 
     InterVehicleTransporterBase(InnerTransporter& inner)
-        : InterfaceType(inner), PollerType(&this->inner())
+        : InterfaceType(inner),
+          PollerType(&this->inner()),
+          rate_limiter_(protobuf::LAYER_INTERVEHICLE)
     {
         // handle request from Portal to omit or include metadata on future publications for a given data type
         this->inner()
@@ -107,7 +111,10 @@ class InterVehicleTransporterBase
                     }
                 });
     }
-    InterVehicleTransporterBase() : PollerType(&this->inner()) {}
+    InterVehicleTransporterBase()
+        : PollerType(&this->inner()), rate_limiter_(protobuf::LAYER_INTERVEHICLE)
+    {
+    }
 
     virtual ~InterVehicleTransporterBase() = default;
 
@@ -147,7 +154,9 @@ class InterVehicleTransporterBase
         Data data_with_group = data;
         publisher.set_group(data_with_group, group);
 
-        static_cast<Derived*>(this)->template _publish<Data>(data_with_group, group, publisher);
+        if (rate_limit_allow(data_with_group, group, publisher))
+            static_cast<Derived*>(this)->template _publish<Data>(data_with_group, group,
+                                                                 publisher);
         // publish to interprocess as both DCCL and Protobuf
         this->inner().template publish_dynamic<Data, MarshallingScheme::DCCL>(data_with_group,
                                                                               group, publisher);
@@ -176,8 +185,9 @@ class InterVehicleTransporterBase
 
             publisher.set_group(*data_with_group, group);
 
-            static_cast<Derived*>(this)->template _publish<Data>(*data_with_group, group,
-                                                                 publisher);
+            if (rate_limit_allow(*data_with_group, group, publisher))
+                static_cast<Derived*>(this)->template _publish<Data>(*data_with_group, group,
+                                                                     publisher);
 
             // publish to interprocess as both DCCL and Protobuf
             this->inner().template publish_dynamic<Data, MarshallingScheme::DCCL>(data_with_group,
@@ -254,6 +264,9 @@ class InterVehicleTransporterBase
             SubscriptionAction::UNSUBSCRIBE);
     }
 
+    /// \brief Number of publications suppressed on this layer by TransporterConfig::rate_limit
+    std::uint64_t rate_limit_suppressed() const { return rate_limiter_.suppressed(); }
+
   protected:
     template <typename Data>
     std::shared_ptr<goby::middleware::protobuf::SerializerTransporterMessage>
@@ -270,7 +283,17 @@ class InterVehicleTransporterBase
             throw(InvalidPublication(ss.str()));
         }
 
+        const bool metrics = TransportMetrics::enabled();
+        auto serialize_start =
+            metrics ? TransportMetrics::Clock::now() : TransportMetrics::Clock::time_point();
         auto data = intervehicle::serialize_publication(d, group, publisher);
+        if (metrics)
+        {
+            TransportMetrics::serialized(protobuf::LAYER_INTERVEHICLE, group, data->key().type(),
+                                         TransportMetrics::Clock::now() - serialize_start);
+            TransportMetrics::published(protobuf::LAYER_INTERVEHICLE, group, data->key().type(),
+                                        data->data().size());
+        }
 
         if (publisher.cfg().intervehicle().buffer().ack_required())
         {
@@ -493,6 +516,15 @@ class InterVehicleTransporterBase
         return static_cast<Derived*>(this)->_poll(lock);
     }
 
+    template <typename Data>
+    bool rate_limit_allow(const Data& data, const Group& group, const Publisher<Data>& publisher)
+    {
+        return rate_limiter_.template allow<Data>(
+            group, MarshallingScheme::DCCL, publisher.cfg(), [&]() {
+                return SerializerParserHelper<Data, MarshallingScheme::DCCL>::type_name(data);
+            });
+    }
+
     template <typename Data> void _set_protobuf_metadata(protobuf::SerializerProtobufMetadata* meta)
     {
         meta->set_protobuf_name(SerializerParserHelper<Data, MarshallingScheme::DCCL>::type_name());
@@ -564,6 +596,8 @@ class InterVehicleTransporterBase
 
     // map of Protobuf names where we can omit metadata on publication
     std::set<std::string> omit_publish_metadata_;
+
+    PublicationRateLimiter rate_limiter_;
 };
 
 /// \brief Implements the forwarder concept for the intervehicle layer
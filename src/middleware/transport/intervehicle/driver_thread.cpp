@@ -21,6 +21,7 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <algorithm>     // for min
 #include <deque>         // for deque
 #include <limits>        // for numeric_...
 #include <list>          // for operator!=
@@ -52,6 +53,7 @@
 #include "goby/exception.h"                                 // for Exception
 #include "goby/middleware/protobuf/transporter_config.pb.h" // for Transpor...
 #include "goby/middleware/transport/intervehicle/groups.h"  // for metadata...
+#include "goby/middleware/transport/metrics.h"              // for Transpor...
 #include "goby/middleware/transport/publisher.h"            // for Publisher
 #include "goby/util/debug_logger/flex_ostreambuf.h"         // for DEBUG1
 #include "goby/util/debug_logger/logger_manipulators.h"     // for operator<<
@@ -123,7 +125,11 @@ goby::middleware::intervehicle::ModemDriverThread::ModemDriverThread(
     const intervehicle::protobuf::PortalConfig::LinkConfig& config)
     : goby::middleware::Thread<intervehicle::protobuf::PortalConfig::LinkConfig,
                                InterProcessForwarder<InterThreadTransporter>>(
-          config, 10 * boost::units::si::hertz),
+          config,
+          // in event mode, loop() blocks in the driver's run_events() rather than at a fixed rate
+          config.driver().work_mode() == goby::acomms::protobuf::DriverConfig::WORK_MODE_EVENT
+              ? std::numeric_limits<double>::infinity() * boost::units::si::hertz
+              : 10 * boost::units::si::hertz),
       buffer_(cfg().modem_id()),
       mac_(cfg().modem_id()),
       glog_group_("goby::middleware::intervehicle::driver_thread::" +
@@ -282,6 +288,8 @@ goby::middleware::intervehicle::ModemDriverThread::ModemDriverThread(
     auto driver_cfg = cfg().driver();
     driver_cfg.set_modem_id(_id_within_subnet(cfg().driver().modem_id()));
     driver_->startup(driver_cfg);
+    // wake the driver for incoming mail (no-op in polling mode)
+    driver_->add_event_source(interprocess_->poll_mutex(), interprocess_->cv());
 
     subscription_key_.set_marshalling_scheme(MarshallingScheme::DCCL);
     subscription_key_.set_type(intervehicle::protobuf::Subscription::descriptor()->full_name());
@@ -303,7 +311,19 @@ void goby::middleware::intervehicle::ModemDriverThread::loop()
                           intervehicle::protobuf::ExpireData::EXPIRED_TIME_TO_LIVE_EXCEEDED);
     }
 
-    driver_->do_work();
+    if (driver_->event_mode())
+    {
+        // sleep until the driver has work, new mail, the next MAC slot or the next modem report
+        auto max_wait = std::chrono::duration_cast<goby::time::SystemClock::duration>(
+            next_modem_report_time_ + modem_report_interval_ - goby::time::SteadyClock::now());
+        if (mac_.running())
+            max_wait = std::min(max_wait, mac_.next_slot_time() - goby::time::SystemClock::now());
+        driver_->run_events(max_wait);
+    }
+    else
+    {
+        driver_->do_work();
+    }
     mac_.do_work();
 
     auto now = goby::time::SteadyClock::now();
@@ -331,6 +351,10 @@ void goby::middleware::intervehicle::ModemDriverThread::_expire_value(
         goby::time::convert_duration<goby::time::MicroTime>(now - value.push_time));
     expire_data.set_reason(reason);
 
+    if (TransportMetrics::enabled())
+        TransportMetrics::dropped(goby::middleware::protobuf::LAYER_INTERVEHICLE,
+                                  value.data.key().group(), value.data.key().type());
+
     *expire_pair.mutable_serializer() = value.data;
     interprocess_->publish<groups::modem_expire_in>(expire_pair);
 }
@@ -659,6 +683,10 @@ void goby::middleware::intervehicle::ModemDriverThread::_buffer_message(
 
             auto exceeded =
                 buffer_.push({dest_id, buffer_id, goby::time::SteadyClock::now(), *msg});
+            if (TransportMetrics::enabled())
+                TransportMetrics::queued(goby::middleware::protobuf::LAYER_INTERVEHICLE,
+                                         msg->key().group(), msg->key().type(),
+                                         buffer_.sub(dest_id, buffer_id).size());
             if (!exceeded.empty())
             {
                 auto now = goby::time::SteadyClock::now();
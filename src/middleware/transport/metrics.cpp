@@ -0,0 +1,169 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <unistd.h> // for getpid
+
+#include "goby/time/convert.h"      // for convert_duration
+#include "goby/time/system_clock.h" // for SystemClock
+#include "goby/time/types.h"        // for MicroTime
+
+#include "metrics.h"
+
+std::atomic<bool> goby::middleware::TransportMetrics::enabled_{false};
+std::mutex goby::middleware::TransportMetrics::mutex_;
+std::map<goby::middleware::TransportMetrics::Key,
+         goby::middleware::protobuf::TransportMetrics::Topic, std::less<>>
+    goby::middleware::TransportMetrics::topics_;
+std::map<goby::middleware::TransportMetrics::Key, goby::middleware::LatencyHistogram,
+         std::less<>>
+    goby::middleware::TransportMetrics::latency_;
+goby::middleware::TransportMetrics::Clock::time_point
+    goby::middleware::TransportMetrics::window_start_;
+
+namespace
+{
+std::uint64_t microseconds(goby::middleware::TransportMetrics::Clock::duration d)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+} // namespace
+
+void goby::middleware::TransportMetrics::set_enabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (enabled && !enabled_)
+    {
+        topics_.clear();
+        latency_.clear();
+        window_start_ = Clock::now();
+    }
+    enabled_ = enabled;
+}
+
+goby::middleware::protobuf::TransportMetrics::Topic&
+goby::middleware::TransportMetrics::topic(const KeyRef& key)
+{
+    auto it = topics_.lower_bound(key);
+    if (it == topics_.end() || topics_.key_comp()(key, it->first))
+    {
+        protobuf::TransportMetrics::Topic topic;
+        topic.set_layer(static_cast<protobuf::Layer>(std::get<0>(key)));
+        topic.set_group(std::get<1>(key));
+        topic.set_type(std::get<2>(key));
+        it = topics_.emplace_hint(it, Key(key), std::move(topic));
+    }
+    return it->second;
+}
+
+void goby::middleware::TransportMetrics::published(protobuf::Layer layer, const std::string& group,
+                                                   const std::string& type, std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    t.set_published_count(t.published_count() + 1);
+    t.set_published_bytes(t.published_bytes() + bytes);
+}
+
+void goby::middleware::TransportMetrics::received(protobuf::Layer layer, const std::string& group,
+                                                  const std::string& type, std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    t.set_received_count(t.received_count() + 1);
+    t.set_received_bytes(t.received_bytes() + bytes);
+}
+
+void goby::middleware::TransportMetrics::serialized(protobuf::Layer layer,
+                                                    const std::string& group,
+                                                    const std::string& type,
+                                                    Clock::duration serialize_time)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    t.set_serialize_time(t.serialize_time() + microseconds(serialize_time));
+}
+
+void goby::middleware::TransportMetrics::parsed(protobuf::Layer layer, const std::string& group,
+                                                const std::string& type,
+                                                Clock::duration parse_time)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    t.set_parse_time(t.parse_time() + microseconds(parse_time));
+}
+
+void goby::middleware::TransportMetrics::queued(protobuf::Layer layer, const std::string& group,
+                                                const std::string& type, std::size_t depth)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    if (depth > t.max_queue_depth())
+        t.set_max_queue_depth(depth);
+}
+
+void goby::middleware::TransportMetrics::dropped(protobuf::Layer layer, const std::string& group,
+                                                 const std::string& type, std::size_t count)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    t.set_dropped(t.dropped() + count);
+}
+
+void goby::middleware::TransportMetrics::suppressed(protobuf::Layer layer,
+                                                    const std::string& group,
+                                                    const std::string& type)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& t = topic(KeyRef(layer, group, type));
+    t.set_suppressed(t.suppressed() + 1);
+}
+
+void goby::middleware::TransportMetrics::latency(protobuf::Layer layer, const std::string& group,
+                                                 const std::string& type, Clock::duration latency)
+{
+    KeyRef key(layer, group, type);
+    std::lock_guard<std::mutex> lock(mutex_);
+    topic(key);
+    auto it = latency_.lower_bound(key);
+    if (it == latency_.end() || latency_.key_comp()(key, it->first))
+        it = latency_.emplace_hint(it, Key(key), LatencyHistogram());
+    it->second.record(latency);
+}
+
+goby::middleware::protobuf::TransportMetrics goby::middleware::TransportMetrics::summary()
+{
+    protobuf::TransportMetrics metrics;
+    metrics.set_time_with_units(goby::time::SystemClock::now<goby::time::MicroTime>());
+    metrics.set_pid(getpid());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    metrics.set_interval(std::chrono::duration<double>(now - window_start_).count());
+    for (const auto& latency_p : latency_)
+        latency_p.second.summarize(*topics_.at(latency_p.first).mutable_latency());
+    for (const auto& p : topics_) *metrics.add_topic() = p.second;
+    topics_.clear();
+    latency_.clear();
+    window_start_ = now;
+    return metrics;
+}
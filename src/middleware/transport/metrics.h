@@ -0,0 +1,103 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_TRANSPORT_METRICS_H
+#define GOBY_MIDDLEWARE_TRANSPORT_METRICS_H
+
+#include <atomic>     // for atomic
+#include <chrono>     // for steady_clock
+#include <cstddef>    // for size_t
+#include <functional> // for less
+#include <map>        // for map
+#include <mutex>      // for mutex
+#include <string>     // for string
+#include <tuple>      // for tuple
+
+#include "goby/middleware/coroner/profiler.h"              // for LatencyHistogram
+#include "goby/middleware/group.h"                         // for Group
+#include "goby/middleware/protobuf/layer.pb.h"             // for Layer
+#include "goby/middleware/protobuf/transport_metrics.pb.h" // for TransportMetrics
+
+namespace goby
+{
+namespace middleware
+{
+namespace groups
+{
+constexpr goby::middleware::Group transport_metrics{"goby::transport::metrics"};
+} // namespace groups
+
+/// \brief Process-wide counters of the data handled by the transporters, for each (layer, group, type)
+///
+/// Disabled by default, in which case each transporter checks only enabled() (a relaxed atomic load). Goby applications enable it with AppConfig::transport_metrics, and publish summary() on groups::transport_metrics at the configured interval.
+class TransportMetrics
+{
+  public:
+    /// \brief Real (not simulation) clock used to time serialization and parsing
+    using Clock = std::chrono::steady_clock;
+
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+    static void set_enabled(bool enabled);
+
+    static void published(protobuf::Layer layer, const std::string& group, const std::string& type,
+                          std::size_t bytes = 0);
+    static void received(protobuf::Layer layer, const std::string& group, const std::string& type,
+                         std::size_t bytes = 0);
+    static void serialized(protobuf::Layer layer, const std::string& group,
+                           const std::string& type, Clock::duration serialize_time);
+    static void parsed(protobuf::Layer layer, const std::string& group, const std::string& type,
+                       Clock::duration parse_time);
+    /// \brief Current number of messages waiting (the maximum is reported)
+    static void queued(protobuf::Layer layer, const std::string& group, const std::string& type,
+                       std::size_t depth);
+    static void dropped(protobuf::Layer layer, const std::string& group, const std::string& type,
+                        std::size_t count = 1);
+    /// \brief Publication skipped by a TransporterConfig::rate_limit
+    static void suppressed(protobuf::Layer layer, const std::string& group,
+                           const std::string& type);
+    /// \brief Time from publish to receipt (for traced publications)
+    static void latency(protobuf::Layer layer, const std::string& group, const std::string& type,
+                        Clock::duration latency);
+
+    /// \brief Returns the counters accumulated since the previous call (or since enabled), and resets them
+    static protobuf::TransportMetrics summary();
+
+  private:
+    using Key = std::tuple<int, std::string, std::string>; // layer, group, type
+    // compares with Key (std::less<>), so that existing entries are found without copying strings
+    using KeyRef = std::tuple<int, const std::string&, const std::string&>;
+    static protobuf::TransportMetrics::Topic& topic(const KeyRef& key);
+
+  private:
+    static std::atomic<bool> enabled_;
+    // protects topics_ and window_start_
+    static std::mutex mutex_;
+    static std::map<Key, protobuf::TransportMetrics::Topic, std::less<>> topics_;
+    static std::map<Key, LatencyHistogram, std::less<>> latency_;
+    static Clock::time_point window_start_;
+};
+
+} // namespace middleware
+} // namespace goby
+
+#endif
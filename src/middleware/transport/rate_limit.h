@@ -0,0 +1,136 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_MIDDLEWARE_TRANSPORT_RATE_LIMIT_H
+#define GOBY_MIDDLEWARE_TRANSPORT_RATE_LIMIT_H
+
+#include <algorithm> // for max
+#include <chrono>    // for duration
+#include <cstdint>   // for uint64_t
+#include <map>       // for map
+#include <string>    // for string
+#include <tuple>     // for tuple
+#include <typeindex> // for type_index
+
+#include "goby/middleware/group.h"                          // for Group
+#include "goby/middleware/protobuf/layer.pb.h"              // for Layer
+#include "goby/middleware/protobuf/transporter_config.pb.h" // for TransporterConfig
+#include "goby/middleware/transport/metrics.h"              // for TransportMetrics
+#include "goby/time/steady_clock.h"                         // for SteadyClock
+#include "goby/util/debug_logger.h"                         // for glog
+
+namespace goby
+{
+namespace middleware
+{
+/// \brief Applies the TransporterConfig::rate_limit for one layer, keeping the state for each group, type and scheme. Each transporter owns one.
+class PublicationRateLimiter
+{
+  public:
+    PublicationRateLimiter(protobuf::Layer layer) : layer_(layer) {}
+
+    /// \brief Returns false if this publication should be suppressed on this layer
+    ///
+    /// \param type_name Called (only when a publication is suppressed) to name the type for TransportMetrics and logging
+    template <typename Data, typename TypeNameFunc>
+    bool allow(const Group& group, int scheme, const protobuf::TransporterConfig& cfg,
+               TypeNameFunc type_name)
+    {
+        // fast path: no limits
+        if (cfg.rate_limit_size() == 0)
+            return true;
+
+        // the most restrictive of the limits given for this layer
+        bool limited = false;
+        std::uint32_t decimation = 1;
+        double max_frequency = 0;
+        for (const auto& limit : cfg.rate_limit())
+        {
+            if (limit.layer() != layer_)
+                continue;
+
+            limited = true;
+            decimation = std::max(decimation, limit.decimation());
+            if (limit.max_frequency() > 0 &&
+                (max_frequency == 0 || limit.max_frequency() < max_frequency))
+                max_frequency = limit.max_frequency();
+        }
+
+        if (!limited ||
+            allow(Key(group, std::type_index(typeid(Data)), scheme), decimation, max_frequency))
+            return true;
+
+        if (TransportMetrics::enabled())
+            TransportMetrics::suppressed(layer_, group, type_name());
+        goby::glog.is_debug3() && goby::glog << "Rate limit suppressed publication to " << group
+                                             << " on " << protobuf::Layer_Name(layer_)
+                                             << std::endl;
+        return false;
+    }
+
+    /// \brief Total number of publications suppressed
+    std::uint64_t suppressed() const { return suppressed_; }
+
+  private:
+    using Key = std::tuple<std::string, std::type_index, int>;
+
+    bool allow(const Key& key, std::uint32_t decimation, double max_frequency)
+    {
+        auto& state = state_[key];
+        bool allowed = (state.count++ % decimation) == 0;
+
+        if (allowed && max_frequency > 0)
+        {
+            auto now = time::SteadyClock::now();
+            auto min_interval = std::chrono::duration_cast<time::SteadyClock::duration>(
+                std::chrono::duration<double>(1.0 / max_frequency));
+            if (state.published && now < state.last_publish + min_interval)
+                allowed = false;
+            else
+                state.last_publish = now;
+        }
+
+        if (allowed)
+            state.published = true;
+        else
+            ++suppressed_;
+        return allowed;
+    }
+
+  private:
+    struct State
+    {
+        std::uint64_t count{0};
+        bool published{false};
+        time::SteadyClock::time_point last_publish;
+    };
+
+    protobuf::Layer layer_;
+    std::map<Key, State> state_;
+    std::uint64_t suppressed_{0};
+};
+
+} // namespace middleware
+} // namespace goby
+
+#endif
@@ -40,6 +40,7 @@
 #include "goby/middleware/protobuf/serializer_transporter.pb.h"
 
 #include "interface.h"
+#include "metrics.h"
 #include "null.h"
 
 namespace goby
@@ -179,9 +180,15 @@ class SerializationSubscription : public SerializationHandlerBase<>
     template <typename CharIterator>
     CharIterator _post(CharIterator bytes_begin, CharIterator bytes_end) const
     {
+        const bool metrics = TransportMetrics::enabled();
+        auto parse_start =
+            metrics ? TransportMetrics::Clock::now() : TransportMetrics::Clock::time_point();
         CharIterator actual_end;
         auto msg = SerializerParserHelper<Data, scheme_id>::parse(bytes_begin, bytes_end,
                                                                   actual_end, type_name_);
+        if (metrics)
+            TransportMetrics::parsed(protobuf::LAYER_INTERPROCESS, group_, type_name_,
+                                     TransportMetrics::Clock::now() - parse_start);
 
         if (subscribed_group() == subscriber_.group(*msg) && handler_)
             handler_(msg);
@@ -256,14 +263,25 @@ class IntervehicleSerializationSubscription
     CharIterator _post(CharIterator bytes_begin, CharIterator bytes_end,
                        const intervehicle::protobuf::Header& header) const
     {
+        const bool metrics = TransportMetrics::enabled();
+        auto parse_start =
+            metrics ? TransportMetrics::Clock::now() : TransportMetrics::Clock::time_point();
         CharIterator actual_end;
         auto msg = SerializerParserHelper<Data, scheme_id>::parse(bytes_begin, bytes_end,
                                                                   actual_end, type_name_);
+        if (metrics)
+            TransportMetrics::parsed(protobuf::LAYER_INTERVEHICLE, group_, type_name_,
+                                     TransportMetrics::Clock::now() - parse_start);
 
         subscriber_.set_link_data(*msg, header);
 
         if (subscribed_group() == subscriber_.group(*msg) && handler_)
+        {
+            if (metrics)
+                TransportMetrics::received(protobuf::LAYER_INTERVEHICLE, group_, type_name_,
+                                           actual_end - bytes_begin);
             handler_(msg);
+        }
 
         return actual_end;
     }
@@ -400,12 +418,27 @@ class SerializationSubscriptionRegex
     SerializationSubscriptionRegex(HandlerType handler, const std::set<int>& schemes,
                                    const std::string& type_regex = ".*",
                                    const std::string& group_regex = ".*")
-        : handler_(handler), schemes_(schemes), type_regex_(type_regex), group_regex_(group_regex)
+        : handler_(handler),
+          schemes_(schemes),
+          type_regex_str_(type_regex),
+          group_regex_str_(group_regex),
+          type_regex_(type_regex),
+          group_regex_(group_regex)
     {
     }
 
-    void update_type_regex(const std::string& type_regex) { type_regex_.assign(type_regex); }
-    void update_group_regex(const std::string& group_regex) { group_regex_.assign(group_regex); }
+    void update_type_regex(const std::string& type_regex)
+    {
+        type_regex_str_ = type_regex;
+        type_regex_.assign(type_regex);
+        ++regex_version_;
+    }
+    void update_group_regex(const std::string& group_regex)
+    {
+        group_regex_str_ = group_regex;
+        group_regex_.assign(group_regex);
+        ++regex_version_;
+    }
 
     // handle an incoming message
     // return true if posted
@@ -430,11 +463,20 @@ class SerializationSubscriptionRegex
     std::thread::id thread_id() const { return thread_id_; }
     std::string subscriber_id() const { return subscriber_id_; }
 
+    const std::set<int>& schemes() const { return schemes_; }
+    const std::string& type_regex() const { return type_regex_str_; }
+    const std::string& group_regex() const { return group_regex_str_; }
+    /// \brief Incremented by each call to update_type_regex() or update_group_regex(), so that transporters can update any filtering derived from the regexes
+    int regex_version() const { return regex_version_; }
+
   private:
     HandlerType handler_;
     const std::set<int> schemes_;
+    std::string type_regex_str_;
+    std::string group_regex_str_;
     std::regex type_regex_;
     std::regex group_regex_;
+    int regex_version_{0};
     const std::thread::id thread_id_{std::this_thread::get_id()};
     const std::string subscriber_id_{goby::middleware::thread_id(thread_id_)};
 };
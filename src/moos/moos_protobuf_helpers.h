@@ -831,147 +831,143 @@ class MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_COMMA_SEPARATED_KEY_E
 template <> class MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>
 {
   public:
+    using Algorithms =
+        google::protobuf::RepeatedPtrField<protobuf::TranslatorEntry::PublishSerializer::Algorithm>;
+
     struct RepeatedFieldKey
     {
         int field;
         int index;
     };
 
-    static void serialize(std::string* out, const google::protobuf::Message& in,
-                          const google::protobuf::RepeatedPtrField<
-                              protobuf::TranslatorEntry::PublishSerializer::Algorithm>& algorithms,
-                          const std::string& format, const std::string& repeated_delimiter,
-                          bool use_short_enum = false)
+    /// \brief Format string for serialize() with its field references resolved for a given Descriptor, so that it can be used for many messages without being parsed again
+    class CompiledFormat
     {
-        std::string mutable_format = format;
+      public:
+        CompiledFormat(const google::protobuf::Descriptor* desc, const Algorithms& algorithms,
+                       const std::string& format);
 
-        const google::protobuf::Descriptor* desc = in.GetDescriptor();
-        const google::protobuf::Reflection* refl = in.GetReflection();
+        const google::protobuf::Descriptor* descriptor() const { return desc_; }
 
-        int max_field_number = 1;
-        for (int i = 1, n = desc->field_count(); i < n; ++i)
-        {
-            const google::protobuf::FieldDescriptor* field_desc = desc->field(i);
-            if (field_desc->number() > max_field_number)
-                max_field_number = field_desc->number();
-        }
+      private:
+        friend class MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>;
 
-        // run algorithms
-        std::map<int, std::string> modified_values = run_serialize_algorithms(in, algorithms);
-
-        for (const auto& modified_value : modified_values)
-        {
-            if (modified_value.first > max_field_number)
-                max_field_number = modified_value.first;
-        }
-
-        std::string mutable_format_temp = mutable_format;
-
-        std::regex moos_index_regex("%([0-9\\.]+:)+[0-9\\.]+%");
-        for (std::sregex_iterator
-                 it(mutable_format.begin(), mutable_format.end(), moos_index_regex),
-             end;
-             it != end; ++it)
+        // one per boost::format argument (%1%, %2%, ...)
+        struct Argument
         {
-            std::string match = (*it)[0];
-
-            boost::trim_if(match, boost::is_any_of("%"));
-            std::vector<std::string> subfields;
-            boost::split(subfields, match, boost::is_any_of(":"));
-
-            ++max_field_number;
-
-            const google::protobuf::FieldDescriptor* field_desc = nullptr;
-            const google::protobuf::Reflection* sub_refl = refl;
-            const google::protobuf::Message* sub_message = &in;
-
-            for (int i = 0, n = subfields.size() - 1; i < n; ++i)
+            enum Type
             {
-                std::vector<std::string> field_and_index;
-                boost::split(field_and_index, subfields[i], boost::is_any_of("."));
-
-                field_desc = sub_message->GetDescriptor()->FindFieldByNumber(
-                    goby::util::as<int>(field_and_index[0]));
-                if (!field_desc ||
-                    field_desc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
-                {
-                    throw(std::runtime_error(
-                        "Invalid ':' syntax given for format: " + match +
-                        ". All field indices except the last must be embedded messages"));
-                }
-                if (field_desc->is_repeated() && field_and_index.size() != 2)
-                {
-                    throw(std::runtime_error("Invalid '.' syntax given for format: " + match +
-                                             ". Repeated message, but no valid index given. E.g., "
-                                             "use '3.4' for index 4 of field 3."));
-                }
-
-                sub_message =
-                    (field_desc->is_repeated())
-                        ? &sub_refl->GetRepeatedMessage(*sub_message, field_desc,
-                                                        goby::util::as<int>(field_and_index[1]))
-                        : &sub_refl->GetMessage(*sub_message, field_desc);
-                sub_refl = sub_message->GetReflection();
-            }
+                FIELD,    // field of the message (or an index of a repeated field: %N.M%)
+                SUBFIELD, // field of an embedded message (%N:M%)
+                VALUE     // output of an algorithm (or "unknown")
+            };
+            Type type{VALUE};
+
+            const google::protobuf::FieldDescriptor* field_desc{nullptr};
+            bool is_indexed_repeated_field{false};
+            int index{0};
+
+            // SUBFIELD: embedded messages (and index if repeated) leading to the last field
+            std::vector<std::pair<const google::protobuf::FieldDescriptor*, int>> path;
+            std::shared_ptr<const CompiledFormat> subformat;
+        };
+
+        const google::protobuf::Descriptor* desc_;
+        boost::format format_;
+        std::vector<Argument> arguments_;
+    };
 
-            serialize(&modified_values[max_field_number], *sub_message, algorithms,
-                      "%" + subfields[subfields.size() - 1] + "%", repeated_delimiter,
-                      use_short_enum);
+    using CreateAlgorithms =
+        google::protobuf::RepeatedPtrField<protobuf::TranslatorEntry::CreateParser::Algorithm>;
 
-            boost::replace_all(
-                mutable_format_temp, std::string("%" + match + "%"),
-                std::string("%" + goby::util::as<std::string>(max_field_number) + "%"));
-        }
+    /// \brief Format string for parse() with its conversion specifiers resolved for a given Descriptor, so that it can be used for many messages without being parsed again
+    class CompiledParseFormat
+    {
+      public:
+        CompiledParseFormat(const google::protobuf::Descriptor* desc, std::string format);
 
-        mutable_format = mutable_format_temp;
+        const google::protobuf::Descriptor* descriptor() const { return desc_; }
 
-        std::map<int, RepeatedFieldKey> indexed_repeated_fields;
+      private:
+        friend class MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>;
 
-        std::regex repeated_field_regex("%[0-9]+\\.[0-9]+%");
-        for (std::sregex_iterator
-                 it(mutable_format.begin(), mutable_format.end(), repeated_field_regex),
-             end;
-             it != end; ++it)
+        // literal characters of the format and the conversion specifier (if any) following them
+        struct Specifier
         {
-            std::string match = (*it)[0];
-            boost::trim_if(match, boost::is_any_of("%"));
-
-            ++max_field_number;
-
-            boost::replace_all(
-                mutable_format_temp, std::string("%" + match + "%"),
-                std::string("%" + goby::util::as<std::string>(max_field_number) + "%"));
-
-            RepeatedFieldKey key;
-
-            std::vector<std::string> field_and_index;
-            boost::split(field_and_index, match, boost::is_any_of("."));
+            enum Type
+            {
+                NONE,    // literal characters at the end of the format
+                FIELD,   // field of the message (or an index of a repeated field: %N.M%)
+                SUBFIELD // field of an embedded message (%N:M%)
+            };
+            Type type{NONE};
+
+            // each is consumed from the input up to and including its first occurrence
+            std::string separators;
+            // ends the value of this specifier in the input ('\0' at the end of the format)
+            char terminator{'\0'};
+
+            const google::protobuf::FieldDescriptor* field_desc{nullptr};
+            bool is_indexed_repeated_field{false};
+            int index{0};
+
+            // SUBFIELD: embedded messages (and index if repeated) leading to the last field
+            std::vector<std::pair<const google::protobuf::FieldDescriptor*, int>> path;
+            std::shared_ptr<const CompiledParseFormat> subformat;
+        };
+
+        const google::protobuf::Descriptor* desc_;
+        std::vector<Specifier> specifiers_;
+    };
 
-            key.field = goby::util::as<int>(field_and_index[0]);
-            key.index = goby::util::as<int>(field_and_index[1]);
+    static void serialize(std::string* out, const google::protobuf::Message& in,
+                          const Algorithms& algorithms, const std::string& format,
+                          const std::string& repeated_delimiter, bool use_short_enum = false)
+    {
+        serialize(out, in, CompiledFormat(in.GetDescriptor(), algorithms, format), algorithms,
+                  repeated_delimiter, use_short_enum);
+    }
 
-            indexed_repeated_fields[max_field_number] = key;
-        }
+    static void serialize(std::string* out, const google::protobuf::Message& in,
+                          const CompiledFormat& format, const Algorithms& algorithms,
+                          const std::string& repeated_delimiter, bool use_short_enum = false)
+    {
+        const google::protobuf::Reflection* refl = in.GetReflection();
 
-        mutable_format = mutable_format_temp;
+        // run algorithms
+        std::map<int, std::string> modified_values = run_serialize_algorithms(in, algorithms);
 
-        boost::format out_format(mutable_format);
-        out_format.exceptions(boost::io::all_error_bits ^
-                              (boost::io::too_many_args_bit | boost::io::too_few_args_bit));
+        // copying the parsed format is much cheaper than parsing it again
+        boost::format out_format(format.format_);
 
-        for (int i = 1; i <= max_field_number; ++i)
+        for (int i = 1, n = format.arguments_.size(); i <= n; ++i)
         {
-            bool is_indexed_repeated_field = indexed_repeated_fields.count(i);
+            const CompiledFormat::Argument& argument = format.arguments_[i - 1];
+            if (argument.type == CompiledFormat::Argument::SUBFIELD)
+            {
+                const google::protobuf::Message* sub_message = &in;
+                for (const auto& field_and_index : argument.path)
+                {
+                    const google::protobuf::Reflection* sub_refl = sub_message->GetReflection();
+                    sub_message = (field_and_index.first->is_repeated())
+                                      ? &sub_refl->GetRepeatedMessage(*sub_message,
+                                                                      field_and_index.first,
+                                                                      field_and_index.second)
+                                      : &sub_refl->GetMessage(*sub_message, field_and_index.first);
+                }
+                serialize(&modified_values[i], *sub_message, *argument.subformat, algorithms,
+                          repeated_delimiter, use_short_enum);
+            }
 
-            const google::protobuf::FieldDescriptor* field_desc = desc->FindFieldByNumber(
-                is_indexed_repeated_field ? indexed_repeated_fields[i].field : i);
+            bool is_indexed_repeated_field = argument.is_indexed_repeated_field;
+            const google::protobuf::FieldDescriptor* field_desc = argument.field_desc;
             std::map<int, std::string>::const_iterator mod_it = modified_values.find(i);
             if (field_desc)
             {
                 if (field_desc->is_repeated())
                 {
-                    int start = (is_indexed_repeated_field) ? indexed_repeated_fields[i].index : 0;
-                    int end = (is_indexed_repeated_field) ? indexed_repeated_fields[i].index + 1
+                    int start = (is_indexed_repeated_field) ? argument.index : 0;
+                    int end = (is_indexed_repeated_field) ? argument.index + 1
                                                           : refl->FieldSize(in, field_desc);
 
                     std::stringstream out_repeated;
@@ -1144,360 +1140,517 @@ template <> class MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>
 
     static void parse(const std::string& in, google::protobuf::Message* out, std::string format,
                       const std::string& repeated_delimiter,
-                      const google::protobuf::RepeatedPtrField<
-                          protobuf::TranslatorEntry::CreateParser::Algorithm>& algorithms =
-                          google::protobuf::RepeatedPtrField<
-                              protobuf::TranslatorEntry::CreateParser::Algorithm>(),
+                      const CreateAlgorithms& algorithms = CreateAlgorithms(),
                       bool use_short_enum = false)
     {
-        const google::protobuf::Descriptor* desc = out->GetDescriptor();
+        parse(in, out, CompiledParseFormat(out->GetDescriptor(), format), repeated_delimiter,
+              algorithms, use_short_enum);
+    }
+
+    static void parse(const std::string& in, google::protobuf::Message* out,
+                      const CompiledParseFormat& format, const std::string& repeated_delimiter,
+                      const CreateAlgorithms& algorithms = CreateAlgorithms(),
+                      bool use_short_enum = false)
+    {
+        // the format is lower case, so match its separators against a lower case copy
+        std::string lower_in = boost::to_lower_copy(in);
+        // start of the part of the input not yet consumed
+        std::string::size_type pos = 0;
+
+        for (const CompiledParseFormat::Specifier& specifier : format.specifiers_)
+        {
+            // eat!
+            for (char separator : specifier.separators)
+            {
+                std::string::size_type separator_pos = lower_in.find(separator, pos);
+                if (separator_pos != std::string::npos)
+                    pos = separator_pos + 1;
+            }
+
+            if (specifier.type == CompiledParseFormat::Specifier::NONE)
+                continue;
+
+            std::string::size_type end = lower_in.find(specifier.terminator, pos);
+            std::string extract =
+                in.substr(pos, (end == std::string::npos) ? std::string::npos : end - pos);
+
+            if (specifier.type == CompiledParseFormat::Specifier::SUBFIELD)
+            {
+                google::protobuf::Message* sub_message = out;
+                for (const auto& field_and_index : specifier.path)
+                {
+                    const google::protobuf::FieldDescriptor* field_desc = field_and_index.first;
+                    const google::protobuf::Reflection* sub_refl = sub_message->GetReflection();
+                    if (field_desc->is_repeated())
+                    {
+                        while (sub_refl->FieldSize(*sub_message, field_desc) <=
+                               field_and_index.second)
+                            sub_refl->AddMessage(sub_message, field_desc);
+                        sub_message = sub_refl->MutableRepeatedMessage(sub_message, field_desc,
+                                                                       field_and_index.second);
+                    }
+                    else
+                    {
+                        sub_message = sub_refl->MutableMessage(sub_message, field_desc);
+                    }
+                }
+                parse(extract, sub_message, *specifier.subformat, repeated_delimiter, algorithms,
+                      use_short_enum);
+            }
+            else
+            {
+                parse_field(extract, out, specifier, repeated_delimiter, algorithms,
+                            use_short_enum);
+            }
+        }
+    }
+
+  private:
+    // sets the field of a FIELD specifier from its part of the input
+    static void parse_field(std::string extract, google::protobuf::Message* out,
+                            const CompiledParseFormat::Specifier& specifier,
+                            const std::string& repeated_delimiter,
+                            const CreateAlgorithms& algorithms, bool use_short_enum)
+    {
         const google::protobuf::Reflection* refl = out->GetReflection();
-        boost::to_lower(format);
-        std::string str = in;
-        std::string lower_str = boost::to_lower_copy(in);
+        const google::protobuf::FieldDescriptor* field_desc = specifier.field_desc;
+        bool is_indexed_repeated_field = specifier.is_indexed_repeated_field;
+        int value_index = specifier.index;
+
+        // run algorithms
+        for (const auto& algorithm : algorithms)
+        {
+            goby::moos::transitional::DCCLMessageVal extract_val(extract);
 
-        //    goby::glog.is(DEBUG1) && goby::glog << "Format: " << format << std::endl;
-        //   goby::glog.is(DEBUG1) && goby::glog << "String: " << str << std::endl;
-        //    goby::glog.is(DEBUG1) && goby::glog << "Lower String: " << lower_str << std::endl;
+            if (algorithm.primary_field() == field_desc->number())
+                moos::transitional::DCCLAlgorithmPerformer::getInstance()->run_algorithm(
+                    algorithm.name(), extract_val,
+                    std::vector<goby::moos::transitional::DCCLMessageVal>());
 
-        std::string::const_iterator i = format.begin();
+            extract = std::string(extract_val);
+        }
+
+        std::vector<std::string> parts;
+        if (is_indexed_repeated_field || !field_desc->is_repeated())
+            parts.push_back(extract);
+        else
+            boost::split(parts, extract, boost::is_any_of(repeated_delimiter));
 
-        while (i != format.end())
+        for (auto& part : parts)
         {
-            if (*i == '%')
+            switch (field_desc->cpp_type())
             {
-                ++i; // now *i is the conversion specifier
-                std::string specifier;
-                while (*i != '%') specifier += *i++;
+                case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddMessage(out, field_desc);
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->MutableRepeatedMessage(out, field_desc, value_index)
+                                     ->ParseFromString(goby::util::hex_decode(part))
+                               : refl->AddMessage(out, field_desc)
+                                     ->ParseFromString(goby::util::hex_decode(part)))
+                        : refl->MutableMessage(out, field_desc)
+                              ->ParseFromString(goby::util::hex_decode(part));
+                    break;
 
-                ++i; // now *i is the next separator
-                std::string extract = str.substr(0, lower_str.find(*i));
+                case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddInt32(out, field_desc, field_desc->default_value_int32());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedInt32(
+                                     out, field_desc, value_index,
+                                     goby::util::as<google::protobuf::int32>(part))
+                               : refl->AddInt32(out, field_desc,
+                                                goby::util::as<google::protobuf::int32>(part)))
+                        : refl->SetInt32(out, field_desc,
+                                         goby::util::as<google::protobuf::int32>(part));
+                    break;
 
-                if (specifier.find(':') != std::string::npos)
-                {
-                    std::vector<std::string> subfields;
-                    boost::split(subfields, specifier, boost::is_any_of(":"));
-                    const google::protobuf::FieldDescriptor* field_desc = nullptr;
-                    const google::protobuf::Reflection* sub_refl = refl;
-                    google::protobuf::Message* sub_message = out;
+                case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddInt64(out, field_desc, field_desc->default_value_int64());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedInt64(
+                                     out, field_desc, value_index,
+                                     goby::util::as<google::protobuf::int64>(part))
+                               : refl->AddInt64(out, field_desc,
+                                                goby::util::as<google::protobuf::int64>(part)))
+                        : refl->SetInt64(out, field_desc,
+                                         goby::util::as<google::protobuf::int64>(part));
+                    break;
 
-                    for (int i = 0, n = subfields.size() - 1; i < n; ++i)
+                case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
+                    if (is_indexed_repeated_field)
                     {
-                        std::vector<std::string> field_and_index;
-                        boost::split(field_and_index, subfields[i], boost::is_any_of("."));
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddUInt32(out, field_desc, field_desc->default_value_uint32());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedUInt32(
+                                     out, field_desc, value_index,
+                                     goby::util::as<google::protobuf::uint32>(part))
+                               : refl->AddUInt32(out, field_desc,
+                                                 goby::util::as<google::protobuf::uint32>(part)))
+                        : refl->SetUInt32(out, field_desc,
+                                          goby::util::as<google::protobuf::uint32>(part));
+                    break;
 
-                        field_desc = sub_message->GetDescriptor()->FindFieldByNumber(
-                            goby::util::as<int>(field_and_index[0]));
-                        if (!field_desc || field_desc->cpp_type() !=
-                                               google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
-                        {
-                            throw(std::runtime_error(
-                                "Invalid ':' syntax given for format: " + specifier +
-                                ". All field indices except the last must be singular embedded "
-                                "messages"));
-                        }
+                case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddUInt64(out, field_desc, field_desc->default_value_uint64());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedUInt64(
+                                     out, field_desc, value_index,
+                                     goby::util::as<google::protobuf::uint64>(part))
+                               : refl->AddUInt64(out, field_desc,
+                                                 goby::util::as<google::protobuf::uint64>(part)))
+                        : refl->SetUInt64(out, field_desc,
+                                          goby::util::as<google::protobuf::uint64>(part));
+                    break;
 
-                        int index = -1;
-                        if (field_desc->is_repeated())
-                        {
-                            if (field_and_index.size() != 2)
-                                throw(std::runtime_error(
-                                    "Invalid '.' syntax given for format: " + specifier +
-                                    ". Repeated message, but no valid index given. E.g., use '3.4' "
-                                    "for index 4 of field 3."));
-                            index = goby::util::as<int>(field_and_index.at(1));
-                            while (sub_refl->FieldSize(*sub_message, field_desc) <= index)
-                                sub_refl->AddMessage(sub_message, field_desc);
-                        }
+                case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddBool(out, field_desc, field_desc->default_value_bool());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedBool(out, field_desc, value_index,
+                                                       goby::util::as<bool>(part))
+                               : refl->AddBool(out, field_desc, goby::util::as<bool>(part)))
+                        : refl->SetBool(out, field_desc, goby::util::as<bool>(part));
+                    break;
 
-                        sub_message =
-                            (field_desc->is_repeated())
-                                ? sub_refl->MutableRepeatedMessage(sub_message, field_desc, index)
-                                : sub_refl->MutableMessage(sub_message, field_desc);
-                        sub_refl = sub_message->GetReflection();
+                case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddString(out, field_desc, field_desc->default_value_string());
                     }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedString(out, field_desc, value_index, part)
+                               : refl->AddString(out, field_desc, part))
+                        : refl->SetString(out, field_desc, part);
+                    break;
 
-                    parse(extract, sub_message, "%" + subfields[subfields.size() - 1] + "%",
-                          repeated_delimiter, algorithms, use_short_enum);
-                }
-                else
+                case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddFloat(out, field_desc, field_desc->default_value_float());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedFloat(out, field_desc, value_index,
+                                                        goby::util::as<float>(part))
+                               : refl->AddFloat(out, field_desc, goby::util::as<float>(part)))
+                        : refl->SetFloat(out, field_desc, goby::util::as<float>(part));
+                    break;
+
+                case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
+                    if (is_indexed_repeated_field)
+                    {
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddDouble(out, field_desc, field_desc->default_value_double());
+                    }
+                    field_desc->is_repeated()
+                        ? (is_indexed_repeated_field
+                               ? refl->SetRepeatedDouble(out, field_desc, value_index,
+                                                         goby::util::as<double>(part))
+                               : refl->AddDouble(out, field_desc, goby::util::as<double>(part)))
+                        : refl->SetDouble(out, field_desc, goby::util::as<double>(part));
+                    break;
+
+                case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
                 {
-                    try
+                    if (is_indexed_repeated_field)
                     {
-                        std::vector<std::string> field_and_index;
-                        boost::split(field_and_index, specifier, boost::is_any_of("."));
+                        while (refl->FieldSize(*out, field_desc) <= value_index)
+                            refl->AddEnum(out, field_desc, field_desc->default_value_enum());
+                    }
+                    std::string enum_value =
+                        ((use_short_enum) ? add_name_to_enum(part, field_desc->name()) : part);
 
-                        int field_index = boost::lexical_cast<int>(field_and_index[0]);
-                        bool is_indexed_repeated_field = field_and_index.size() == 2;
+                    const google::protobuf::EnumValueDescriptor* enum_desc =
+                        refl->GetEnum(*out, field_desc)->type()->FindValueByName(enum_value);
 
-                        int value_index = 0;
-                        if (is_indexed_repeated_field)
-                            value_index = boost::lexical_cast<int>(field_and_index[1]);
+                    // try upper case
+                    if (!enum_desc)
+                        enum_desc = refl->GetEnum(*out, field_desc)
+                                        ->type()
+                                        ->FindValueByName(boost::to_upper_copy(enum_value));
+                    // try lower case
+                    if (!enum_desc)
+                        enum_desc = refl->GetEnum(*out, field_desc)
+                                        ->type()
+                                        ->FindValueByName(boost::to_lower_copy(enum_value));
+                    if (enum_desc)
+                    {
+                        field_desc->is_repeated()
+                            ? (is_indexed_repeated_field
+                                   ? refl->SetRepeatedEnum(out, field_desc, value_index, enum_desc)
+                                   : refl->AddEnum(out, field_desc, enum_desc))
+                            : refl->SetEnum(out, field_desc, enum_desc);
+                    }
+                }
+                break;
+            }
+        }
+    }
+};
 
-                        const google::protobuf::FieldDescriptor* field_desc =
-                            desc->FindFieldByNumber(field_index);
+inline MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::CompiledFormat::CompiledFormat(
+    const google::protobuf::Descriptor* desc, const Algorithms& algorithms,
+    const std::string& format)
+    : desc_(desc)
+{
+    std::string mutable_format = format;
 
-                        if (!field_desc)
-                            throw(std::runtime_error("Bad field: " + specifier +
-                                                     " not in message " + desc->full_name()));
+    int max_field_number = 1;
+    for (int i = 1, n = desc->field_count(); i < n; ++i)
+    {
+        const google::protobuf::FieldDescriptor* field_desc = desc->field(i);
+        if (field_desc->number() > max_field_number)
+            max_field_number = field_desc->number();
+    }
 
-                        // run algorithms
-                        for (const auto& algorithm : algorithms)
-                        {
-                            goby::moos::transitional::DCCLMessageVal extract_val(extract);
+    // fields written by run_serialize_algorithms()
+    for (const auto& algorithm : algorithms)
+    {
+        const google::protobuf::FieldDescriptor* primary_field_desc =
+            desc->FindFieldByNumber(algorithm.primary_field());
+        if (primary_field_desc && !primary_field_desc->is_repeated() &&
+            algorithm.output_virtual_field() > max_field_number)
+            max_field_number = algorithm.output_virtual_field();
+    }
 
-                            if (algorithm.primary_field() == field_index)
-                                moos::transitional::DCCLAlgorithmPerformer::getInstance()
-                                    ->run_algorithm(
-                                        algorithm.name(), extract_val,
-                                        std::vector<goby::moos::transitional::DCCLMessageVal>());
+    std::string mutable_format_temp = mutable_format;
 
-                            extract = std::string(extract_val);
-                        }
+    std::map<int, Argument> subfields;
 
-                        std::vector<std::string> parts;
-                        if (is_indexed_repeated_field || !field_desc->is_repeated())
-                            parts.push_back(extract);
-                        else
-                            boost::split(parts, extract, boost::is_any_of(repeated_delimiter));
+    std::regex moos_index_regex("%([0-9\\.]+:)+[0-9\\.]+%");
+    for (std::sregex_iterator it(mutable_format.begin(), mutable_format.end(), moos_index_regex),
+         end;
+         it != end; ++it)
+    {
+        std::string match = (*it)[0];
 
-                        for (auto& part : parts)
-                        {
-                            switch (field_desc->cpp_type())
-                            {
-                                case google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddMessage(out, field_desc);
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->MutableRepeatedMessage(out, field_desc,
-                                                                              value_index)
-                                                     ->ParseFromString(goby::util::hex_decode(part))
-                                               : refl->AddMessage(out, field_desc)
-                                                     ->ParseFromString(
-                                                         goby::util::hex_decode(part)))
-                                        : refl->MutableMessage(out, field_desc)
-                                              ->ParseFromString(goby::util::hex_decode(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_INT32:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddInt32(out, field_desc,
-                                                           field_desc->default_value_int32());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedInt32(
-                                                     out, field_desc, value_index,
-                                                     goby::util::as<google::protobuf::int32>(part))
-                                               : refl->AddInt32(
-                                                     out, field_desc,
-                                                     goby::util::as<google::protobuf::int32>(part)))
-                                        : refl->SetInt32(
-                                              out, field_desc,
-                                              goby::util::as<google::protobuf::int32>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_INT64:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddInt64(out, field_desc,
-                                                           field_desc->default_value_int64());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedInt64(
-                                                     out, field_desc, value_index,
-                                                     goby::util::as<google::protobuf::int64>(part))
-                                               : refl->AddInt64(
-                                                     out, field_desc,
-                                                     goby::util::as<google::protobuf::int64>(part)))
-                                        : refl->SetInt64(
-                                              out, field_desc,
-                                              goby::util::as<google::protobuf::int64>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_UINT32:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddUInt32(out, field_desc,
-                                                            field_desc->default_value_uint32());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedUInt32(
-                                                     out, field_desc, value_index,
-                                                     goby::util::as<google::protobuf::uint32>(part))
-                                               : refl->AddUInt32(
-                                                     out, field_desc,
-                                                     goby::util::as<google::protobuf::uint32>(
-                                                         part)))
-                                        : refl->SetUInt32(
-                                              out, field_desc,
-                                              goby::util::as<google::protobuf::uint32>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_UINT64:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddUInt64(out, field_desc,
-                                                            field_desc->default_value_uint64());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedUInt64(
-                                                     out, field_desc, value_index,
-                                                     goby::util::as<google::protobuf::uint64>(part))
-                                               : refl->AddUInt64(
-                                                     out, field_desc,
-                                                     goby::util::as<google::protobuf::uint64>(
-                                                         part)))
-                                        : refl->SetUInt64(
-                                              out, field_desc,
-                                              goby::util::as<google::protobuf::uint64>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_BOOL:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddBool(out, field_desc,
-                                                          field_desc->default_value_bool());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedBool(out, field_desc, value_index,
-                                                                       goby::util::as<bool>(part))
-                                               : refl->AddBool(out, field_desc,
-                                                               goby::util::as<bool>(part)))
-                                        : refl->SetBool(out, field_desc,
-                                                        goby::util::as<bool>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_STRING:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddString(out, field_desc,
-                                                            field_desc->default_value_string());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedString(out, field_desc,
-                                                                         value_index, part)
-                                               : refl->AddString(out, field_desc, part))
-                                        : refl->SetString(out, field_desc, part);
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_FLOAT:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddFloat(out, field_desc,
-                                                           field_desc->default_value_float());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedFloat(out, field_desc,
-                                                                        value_index,
-                                                                        goby::util::as<float>(part))
-                                               : refl->AddFloat(out, field_desc,
-                                                                goby::util::as<float>(part)))
-                                        : refl->SetFloat(out, field_desc,
-                                                         goby::util::as<float>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_DOUBLE:
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddDouble(out, field_desc,
-                                                            field_desc->default_value_double());
-                                    }
-                                    field_desc->is_repeated()
-                                        ? (is_indexed_repeated_field
-                                               ? refl->SetRepeatedDouble(
-                                                     out, field_desc, value_index,
-                                                     goby::util::as<double>(part))
-                                               : refl->AddDouble(out, field_desc,
-                                                                 goby::util::as<double>(part)))
-                                        : refl->SetDouble(out, field_desc,
-                                                          goby::util::as<double>(part));
-                                    break;
-
-                                case google::protobuf::FieldDescriptor::CPPTYPE_ENUM:
-                                {
-                                    if (is_indexed_repeated_field)
-                                    {
-                                        while (refl->FieldSize(*out, field_desc) <= value_index)
-                                            refl->AddEnum(out, field_desc,
-                                                          field_desc->default_value_enum());
-                                    }
-                                    std::string enum_value =
-                                        ((use_short_enum)
-                                             ? add_name_to_enum(part, field_desc->name())
-                                             : part);
-
-                                    const google::protobuf::EnumValueDescriptor* enum_desc =
-                                        refl->GetEnum(*out, field_desc)
-                                            ->type()
-                                            ->FindValueByName(enum_value);
-
-                                    // try upper case
-                                    if (!enum_desc)
-                                        enum_desc =
-                                            refl->GetEnum(*out, field_desc)
-                                                ->type()
-                                                ->FindValueByName(boost::to_upper_copy(enum_value));
-                                    // try lower case
-                                    if (!enum_desc)
-                                        enum_desc =
-                                            refl->GetEnum(*out, field_desc)
-                                                ->type()
-                                                ->FindValueByName(boost::to_lower_copy(enum_value));
-                                    if (enum_desc)
-                                    {
-                                        field_desc->is_repeated()
-                                            ? (is_indexed_repeated_field
-                                                   ? refl->SetRepeatedEnum(out, field_desc,
-                                                                           value_index, enum_desc)
-                                                   : refl->AddEnum(out, field_desc, enum_desc))
-                                            : refl->SetEnum(out, field_desc, enum_desc);
-                                    }
-                                }
-                                break;
-                            }
-                        }
-                    }
-                    catch (boost::bad_lexical_cast&)
-                    {
+        boost::trim_if(match, boost::is_any_of("%"));
+        std::vector<std::string> subfield_strs;
+        boost::split(subfield_strs, match, boost::is_any_of(":"));
+
+        ++max_field_number;
+
+        Argument& subfield = subfields[max_field_number];
+        subfield.type = Argument::SUBFIELD;
+
+        const google::protobuf::Descriptor* sub_desc = desc;
+        for (int i = 0, n = subfield_strs.size() - 1; i < n; ++i)
+        {
+            std::vector<std::string> field_and_index;
+            boost::split(field_and_index, subfield_strs[i], boost::is_any_of("."));
+
+            const google::protobuf::FieldDescriptor* field_desc =
+                sub_desc->FindFieldByNumber(goby::util::as<int>(field_and_index[0]));
+            if (!field_desc ||
+                field_desc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+            {
+                throw(std::runtime_error(
+                    "Invalid ':' syntax given for format: " + match +
+                    ". All field indices except the last must be embedded messages"));
+            }
+            if (field_desc->is_repeated() && field_and_index.size() != 2)
+            {
+                throw(std::runtime_error("Invalid '.' syntax given for format: " + match +
+                                         ". Repeated message, but no valid index given. E.g., "
+                                         "use '3.4' for index 4 of field 3."));
+            }
+
+            subfield.path.emplace_back(field_desc, field_desc->is_repeated()
+                                                       ? goby::util::as<int>(field_and_index[1])
+                                                       : 0);
+            sub_desc = field_desc->message_type();
+        }
+
+        subfield.subformat = std::make_shared<const CompiledFormat>(
+            sub_desc, algorithms, "%" + subfield_strs[subfield_strs.size() - 1] + "%");
+
+        boost::replace_all(mutable_format_temp, std::string("%" + match + "%"),
+                           std::string("%" + goby::util::as<std::string>(max_field_number) + "%"));
+    }
+
+    mutable_format = mutable_format_temp;
+
+    std::map<int, RepeatedFieldKey> indexed_repeated_fields;
+
+    std::regex repeated_field_regex("%[0-9]+\\.[0-9]+%");
+    for (std::sregex_iterator
+             it(mutable_format.begin(), mutable_format.end(), repeated_field_regex),
+         end;
+         it != end; ++it)
+    {
+        std::string match = (*it)[0];
+        boost::trim_if(match, boost::is_any_of("%"));
+
+        ++max_field_number;
+
+        boost::replace_all(mutable_format_temp, std::string("%" + match + "%"),
+                           std::string("%" + goby::util::as<std::string>(max_field_number) + "%"));
+
+        RepeatedFieldKey key;
+
+        std::vector<std::string> field_and_index;
+        boost::split(field_and_index, match, boost::is_any_of("."));
+
+        key.field = goby::util::as<int>(field_and_index[0]);
+        key.index = goby::util::as<int>(field_and_index[1]);
+
+        indexed_repeated_fields[max_field_number] = key;
+    }
+
+    mutable_format = mutable_format_temp;
+
+    format_.parse(mutable_format);
+    format_.exceptions(boost::io::all_error_bits ^
+                       (boost::io::too_many_args_bit | boost::io::too_few_args_bit));
+
+    arguments_.resize(max_field_number);
+    for (int i = 1; i <= max_field_number; ++i)
+    {
+        Argument& argument = arguments_[i - 1];
+        argument.is_indexed_repeated_field = indexed_repeated_fields.count(i);
+        argument.field_desc = desc->FindFieldByNumber(
+            argument.is_indexed_repeated_field ? indexed_repeated_fields[i].field : i);
+
+        if (argument.field_desc)
+        {
+            argument.type = Argument::FIELD;
+            if (argument.is_indexed_repeated_field)
+                argument.index = indexed_repeated_fields[i].index;
+        }
+        else if (subfields.count(i))
+        {
+            argument = subfields[i];
+        }
+    }
+}
+
+inline MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::CompiledParseFormat::
+    CompiledParseFormat(const google::protobuf::Descriptor* desc, std::string format)
+    : desc_(desc)
+{
+    boost::to_lower(format);
+
+    Specifier specifier;
+    std::string::const_iterator i = format.begin();
+    while (i != format.end())
+    {
+        if (*i != '%')
+        {
+            specifier.separators += *i++;
+            continue;
+        }
+
+        ++i; // now *i is the conversion specifier
+        std::string conversion;
+        while (i != format.end() && *i != '%') conversion += *i++;
+
+        if (i != format.end())
+            ++i; // now *i is the next separator
+        specifier.terminator = (i != format.end()) ? *i : '\0';
+
+        if (conversion.find(':') != std::string::npos)
+        {
+            std::vector<std::string> subfields;
+            boost::split(subfields, conversion, boost::is_any_of(":"));
+
+            specifier.type = Specifier::SUBFIELD;
+            const google::protobuf::Descriptor* sub_desc = desc;
+            for (int j = 0, n = subfields.size() - 1; j < n; ++j)
+            {
+                std::vector<std::string> field_and_index;
+                boost::split(field_and_index, subfields[j], boost::is_any_of("."));
+
+                const google::protobuf::FieldDescriptor* field_desc =
+                    sub_desc->FindFieldByNumber(goby::util::as<int>(field_and_index[0]));
+                if (!field_desc ||
+                    field_desc->cpp_type() != google::protobuf::FieldDescriptor::CPPTYPE_MESSAGE)
+                {
+                    throw(std::runtime_error(
+                        "Invalid ':' syntax given for format: " + conversion +
+                        ". All field indices except the last must be singular embedded "
+                        "messages"));
+                }
+
+                int index = -1;
+                if (field_desc->is_repeated())
+                {
+                    if (field_and_index.size() != 2)
                         throw(std::runtime_error(
-                            "Bad specifier: " + specifier +
-                            ", must be an integer. For message: " + desc->full_name()));
-                    }
+                            "Invalid '.' syntax given for format: " + conversion +
+                            ". Repeated message, but no valid index given. E.g., use '3.4' "
+                            "for index 4 of field 3."));
+                    index = goby::util::as<int>(field_and_index.at(1));
                 }
 
-                // goby::glog.is(DEBUG1) && goby::glog << "field: [" << field_index << "], parts[j]: [" << parts[j] << "]" << std::endl;
+                specifier.path.emplace_back(field_desc, index);
+                sub_desc = field_desc->message_type();
             }
-            else
+
+            specifier.subformat = std::make_shared<const CompiledParseFormat>(
+                sub_desc, "%" + subfields[subfields.size() - 1] + "%");
+        }
+        else
+        {
+            try
+            {
+                std::vector<std::string> field_and_index;
+                boost::split(field_and_index, conversion, boost::is_any_of("."));
+
+                int field_index = boost::lexical_cast<int>(field_and_index[0]);
+                specifier.is_indexed_repeated_field = field_and_index.size() == 2;
+                if (specifier.is_indexed_repeated_field)
+                    specifier.index = boost::lexical_cast<int>(field_and_index[1]);
+
+                specifier.field_desc = desc->FindFieldByNumber(field_index);
+                if (!specifier.field_desc)
+                    throw(std::runtime_error("Bad field: " + conversion + " not in message " +
+                                             desc->full_name()));
+                specifier.type = Specifier::FIELD;
+            }
+            catch (boost::bad_lexical_cast&)
             {
-                // if it's not a %, eat!
-                std::string::size_type pos_to_remove = lower_str.find(*i) + 1;
-                lower_str.erase(0, pos_to_remove);
-                str.erase(0, pos_to_remove);
-                ++i;
+                throw(std::runtime_error("Bad specifier: " + conversion +
+                                         ", must be an integer. For message: " +
+                                         desc->full_name()));
             }
         }
+
+        specifiers_.push_back(std::move(specifier));
+        specifier = Specifier();
     }
-};
+
+    if (!specifier.separators.empty())
+        specifiers_.push_back(std::move(specifier));
+}
 } // namespace moos
 } // namespace goby
 
@@ -27,6 +27,7 @@
 
 #include <limits>    // for numeric_limits
 #include <map>       // for map, multimap
+#include <memory>    // for shared_ptr
 #include <mutex>     // for lock_guard, mutex
 #include <ostream>   // for operator<<, bas...
 #include <set>       // for set
@@ -112,7 +113,11 @@ class MOOSTranslator
         add_entry(entries);
     }
 
-    void clear_entry(const std::string& protobuf_name) { dictionary_.erase(protobuf_name); }
+    void clear_entry(const std::string& protobuf_name)
+    {
+        dictionary_.erase(protobuf_name);
+        compiled_formats_.erase(protobuf_name);
+    }
 
     void add_entry(const goby::moos::protobuf::TranslatorEntry& entry)
     {
@@ -183,6 +188,45 @@ class MOOSTranslator
 
     void update_utm_datum(double lat_origin, double lon_origin);
 
+    using CompiledFormat =
+        MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::CompiledFormat;
+    using CompiledParseFormat =
+        MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::CompiledParseFormat;
+    enum class FormatUse
+    {
+        PUBLISH_MOOS_VAR,
+        PUBLISH_FORMAT,
+        CREATE_FORMAT,      // serialized by protobuf_to_inverse_moos()
+        CREATE_PARSE_FORMAT // parsed by moos_to_protobuf()
+    };
+
+    // compiles the format on first use for each entry, (re)compiling if the Descriptor changed
+    const CompiledFormat&
+    compiled_format(const std::string& protobuf_name, FormatUse use, int index,
+                    const google::protobuf::Descriptor* desc,
+                    const MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::Algorithms&
+                        algorithms,
+                    const std::string& format)
+    {
+        auto& compiled = compiled_formats_[protobuf_name][std::make_pair(use, index)].serialize;
+        if (!compiled || compiled->descriptor() != desc)
+            compiled = std::make_shared<const CompiledFormat>(desc, algorithms, format);
+        return *compiled;
+    }
+
+    // as compiled_format(), for parsing the create format into a message
+    const CompiledParseFormat& compiled_parse_format(const std::string& protobuf_name, int index,
+                                                     const google::protobuf::Descriptor* desc,
+                                                     const std::string& format)
+    {
+        auto& compiled =
+            compiled_formats_[protobuf_name][std::make_pair(FormatUse::CREATE_PARSE_FORMAT, index)]
+                .parse;
+        if (!compiled || compiled->descriptor() != desc)
+            compiled = std::make_shared<const CompiledParseFormat>(desc, format);
+        return *compiled;
+    }
+
   private:
     void initialize(double lat_origin = std::numeric_limits<double>::quiet_NaN(),
                     double lon_origin = std::numeric_limits<double>::quiet_NaN(),
@@ -205,7 +249,16 @@ class MOOSTranslator
     void alg_name2modem_id(moos::transitional::DCCLMessageVal& in);
 
   private:
+    // one of these is set, depending on the FormatUse
+    struct CachedFormat
+    {
+        std::shared_ptr<const CompiledFormat> serialize;
+        std::shared_ptr<const CompiledParseFormat> parse;
+    };
+
     std::map<std::string, goby::moos::protobuf::TranslatorEntry> dictionary_;
+    // TECHNIQUE_FORMAT formats of the dictionary_ entries, so they are only parsed once
+    std::map<std::string, std::map<std::pair<FormatUse, int>, CachedFormat>> compiled_formats_;
     CMOOSGeodesy geodesy_;
     goby::moos::ModemIdConvert modem_lookup_;
 };
@@ -310,13 +363,19 @@ goby::moos::MOOSTranslator::protobuf_to_moos(const google::protobuf::Message& pr
             case protobuf::TranslatorEntry::TECHNIQUE_FORMAT:
                 // process moos_variable too (can be a format string itself!)
                 goby::moos::MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::serialize(
-                    &moos_var, protobuf_msg, entry.publish(i).algorithm(),
-                    entry.publish(i).moos_var(), entry.publish(i).repeated_delimiter(),
+                    &moos_var, protobuf_msg,
+                    compiled_format(pb_name, FormatUse::PUBLISH_MOOS_VAR, i,
+                                    protobuf_msg.GetDescriptor(), entry.publish(i).algorithm(),
+                                    entry.publish(i).moos_var()),
+                    entry.publish(i).algorithm(), entry.publish(i).repeated_delimiter(),
                     entry.use_short_enum());
                 // now do the format values
                 goby::moos::MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::serialize(
-                    &return_string, protobuf_msg, entry.publish(i).algorithm(),
-                    entry.publish(i).format(), entry.publish(i).repeated_delimiter(),
+                    &return_string, protobuf_msg,
+                    compiled_format(pb_name, FormatUse::PUBLISH_FORMAT, i,
+                                    protobuf_msg.GetDescriptor(), entry.publish(i).algorithm(),
+                                    entry.publish(i).format()),
+                    entry.publish(i).algorithm(), entry.publish(i).repeated_delimiter(),
                     entry.use_short_enum());
                 break;
         }
@@ -414,8 +473,12 @@ goby::moos::MOOSTranslator::protobuf_to_inverse_moos(const google::protobuf::Mes
                     empty_algorithms;
 
                 goby::moos::MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::serialize(
-                    &return_string, protobuf_msg, empty_algorithms, entry.create(i).format(),
-                    entry.create(i).repeated_delimiter(), entry.use_short_enum());
+                    &return_string, protobuf_msg,
+                    compiled_format(pb_name, FormatUse::CREATE_FORMAT, i,
+                                    protobuf_msg.GetDescriptor(), empty_algorithms,
+                                    entry.create(i).format()),
+                    empty_algorithms, entry.create(i).repeated_delimiter(),
+                    entry.use_short_enum());
             }
             break;
         }
@@ -528,7 +591,9 @@ goby::moos::MOOSTranslator::moos_to_protobuf(const StringCMOOSMsgMap& moos_varia
 
             case protobuf::TranslatorEntry::TECHNIQUE_FORMAT:
                 goby::moos::MOOSTranslation<protobuf::TranslatorEntry::TECHNIQUE_FORMAT>::parse(
-                    source_string, &*msg, entry.create(i).format(),
+                    source_string, &*msg,
+                    compiled_parse_format(protobuf_name, i, msg->GetDescriptor(),
+                                          entry.create(i).format()),
                     entry.create(i).repeated_delimiter(), entry.create(i).algorithm(),
                     entry.use_short_enum());
                 break;
@@ -0,0 +1,127 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests the UDPDriver in event mode: run_events() returns as soon as a datagram arrives
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+#include "goby/acomms/connect.h"
+#include "goby/acomms/modemdriver/udp_driver.h"
+#include "goby/acomms/protobuf/modem_message.pb.h"
+#include "goby/acomms/protobuf/udp_driver.pb.h"
+#include "goby/util/debug_logger.h"
+
+using goby::acomms::udp::protobuf::config;
+
+int receive_count = 0;
+
+void handle_receive(const goby::acomms::protobuf::ModemTransmission& msg)
+{
+    std::cout << "Received: " << msg.ShortDebugString() << std::endl;
+    if (msg.type() == goby::acomms::protobuf::ModemTransmission::DATA)
+        ++receive_count;
+}
+
+int main(int argc, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::DEBUG3, &std::clog);
+    goby::glog.set_name(argv[0]);
+
+    srand(time(nullptr));
+    int port1 = rand() % 1000 + 50000;
+    int port2 = port1 + 1;
+
+    goby::acomms::protobuf::DriverConfig cfg1, cfg2;
+    cfg1.set_modem_id(1);
+    cfg1.MutableExtension(config)->mutable_local()->set_port(port1);
+    auto* remote1 = cfg1.MutableExtension(config)->add_remote();
+    remote1->set_ip("127.0.0.1");
+    remote1->set_port(port2);
+
+    cfg2.set_modem_id(2);
+    cfg2.MutableExtension(config)->mutable_local()->set_port(port2);
+    auto* remote2 = cfg2.MutableExtension(config)->add_remote();
+    remote2->set_ip("127.0.0.1");
+    remote2->set_port(port1);
+    cfg2.set_work_mode(goby::acomms::protobuf::DriverConfig::WORK_MODE_EVENT);
+    cfg2.set_event_max_work_interval(10);
+
+    goby::acomms::UDPDriver driver1, driver2;
+    goby::acomms::connect(&driver2.signal_receive, &handle_receive);
+
+    driver1.startup(cfg1);
+    driver2.startup(cfg2);
+    assert(!driver1.event_mode());
+    assert(driver2.event_mode());
+
+    // nothing to do: returns after max_wait
+    auto start = std::chrono::steady_clock::now();
+    driver2.run_events(std::chrono::milliseconds(100));
+    assert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(100));
+
+    // polling mode: does not block
+    start = std::chrono::steady_clock::now();
+    driver1.run_events(std::chrono::seconds(10));
+    assert(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+
+    std::atomic<bool> sender_done{false};
+    std::thread sender([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        goby::acomms::protobuf::ModemTransmission transmit;
+        transmit.set_type(goby::acomms::protobuf::ModemTransmission::DATA);
+        transmit.set_src(1);
+        transmit.set_dest(2);
+        transmit.set_ack_requested(false);
+        transmit.add_frame("event mode");
+        driver1.handle_initiate_transmission(transmit);
+        while (!sender_done)
+        {
+            driver1.do_work();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    });
+
+    // wakes on the incoming datagram, well before event_max_work_interval
+    start = std::chrono::steady_clock::now();
+    while (receive_count == 0 && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        driver2.run_events(std::chrono::seconds(10));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    sender_done = true;
+    sender.join();
+
+    assert(receive_count == 1);
+    assert(elapsed < std::chrono::seconds(5));
+
+    driver1.shutdown();
+    driver2.shutdown();
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
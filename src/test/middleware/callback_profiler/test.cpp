@@ -0,0 +1,177 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "goby/middleware/coroner/profiler.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/util/debug_logger.h"
+
+// tests LatencyHistogram and CallbackProfiler, and the interthread handler hooks
+
+using goby::middleware::CallbackProfiler;
+using goby::middleware::LatencyHistogram;
+
+constexpr goby::middleware::Group fast{"Fast"};
+constexpr goby::middleware::Group slow{"Slow"};
+
+struct Sample
+{
+    int a;
+};
+
+const int max_publish = 20;
+std::atomic<bool> subscriber_ready(false);
+goby::middleware::protobuf::ThreadHealth subscriber_health;
+
+void test_histogram()
+{
+    LatencyHistogram hist;
+    assert(hist.count() == 0 && hist.percentile(50) == 0);
+
+    // exact below 16 us
+    for (std::uint64_t v = 0; v < 16; ++v) hist.record(v);
+    assert(hist.count() == 16);
+    assert(hist.percentile(50) == 7);
+    assert(hist.percentile(100) == 15);
+    hist.reset();
+    assert(hist.count() == 0 && hist.max() == 0);
+
+    // within 12.5% above
+    std::mt19937_64 gen(1);
+    std::uniform_int_distribution<std::uint64_t> dist(0, 10000000);
+    std::vector<std::uint64_t> values;
+    for (int i = 0; i < 10000; ++i)
+    {
+        values.push_back(dist(gen));
+        hist.record(values.back());
+    }
+    std::sort(values.begin(), values.end());
+    for (double p : {50.0, 90.0, 99.0})
+    {
+        auto exact = values[static_cast<std::size_t>(p / 100 * values.size()) - 1];
+        auto approx = hist.percentile(p);
+        std::cout << "p" << p << ": exact: " << exact << ", histogram: " << approx << std::endl;
+        assert(approx >= exact && approx <= exact * 1.125 + 1);
+    }
+    assert(hist.max() == values.back());
+    assert(hist.percentile(100) == values.back());
+
+    // out of range values go in the last bucket
+    hist.record(std::uint64_t(1) << 62);
+    assert(hist.max() == std::uint64_t(1) << 62);
+
+    hist.reset();
+    hist.record(std::chrono::milliseconds(2));
+    goby::middleware::protobuf::LatencySummary summary;
+    hist.summarize(summary);
+    assert(summary.count() == 1 && summary.max() == 2000 && summary.mean() == 2000);
+}
+
+void subscriber()
+{
+    goby::middleware::InterThreadTransporter interthread;
+    int received = 0;
+    interthread.subscribe<fast, Sample>([&](std::shared_ptr<const Sample> s) { ++received; });
+    interthread.subscribe<slow, Sample>([&](std::shared_ptr<const Sample> s) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ++received;
+    });
+    subscriber_ready = true;
+    while (received < max_publish + 1) interthread.poll(std::chrono::milliseconds(100));
+
+    subscriber_health.set_name("subscriber");
+    subscriber_health.set_state(goby::middleware::protobuf::HEALTH__OK);
+    CallbackProfiler::this_thread().report(subscriber_health);
+}
+
+int main(int argc, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::DEBUG1, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    test_histogram();
+
+    goby::middleware::protobuf::AppConfig::CallbackProfiling cfg;
+    cfg.set_enable(true);
+    cfg.set_slow_handler_threshold(0.01);
+    cfg.set_max_loop_overrun_fraction(0.1);
+    CallbackProfiler::configure(cfg);
+    assert(CallbackProfiler::enabled());
+
+    // loop overruns
+    {
+        auto& profiler = CallbackProfiler::this_thread();
+        for (int i = 0; i < 10; ++i) profiler.loop(std::chrono::microseconds(100), i == 0);
+        goby::middleware::protobuf::ThreadHealth health;
+        health.set_name("main");
+        health.set_state(goby::middleware::protobuf::HEALTH__OK);
+        profiler.report(health);
+        std::cout << health.DebugString() << std::endl;
+        assert(health.state() == goby::middleware::protobuf::HEALTH__OK);
+        assert(health.profile().loop().count() == 10);
+        assert(health.profile().loop_overruns() == 1);
+
+        for (int i = 0; i < 10; ++i) profiler.loop(std::chrono::microseconds(100), i < 2);
+        health.set_state(goby::middleware::protobuf::HEALTH__OK);
+        health.clear_profile();
+        profiler.report(health);
+        assert(health.state() == goby::middleware::protobuf::HEALTH__DEGRADED);
+        assert(health.profile().loop_overruns() == 2);
+
+        // reset by report()
+        health.clear_profile();
+        profiler.report(health);
+        assert(!health.profile().has_loop());
+    }
+
+    // interthread handlers
+    std::thread t1(subscriber);
+    while (!subscriber_ready) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        goby::middleware::InterThreadTransporter interthread;
+        for (int i = 0; i < max_publish; ++i) interthread.publish<fast>(Sample{i});
+        interthread.publish<slow>(Sample{0});
+    }
+    t1.join();
+
+    std::cout << subscriber_health.DebugString() << std::endl;
+    const auto& profile = subscriber_health.profile();
+    assert(profile.handler().count() == max_publish + 1);
+    assert(profile.dispatch_latency().count() == max_publish + 1);
+    assert(profile.handler().max() >= 20000);
+    assert(profile.slow_handler_size() == 1);
+    assert(profile.slow_handler(0).group() == "Slow");
+    assert(profile.slow_handler(0).type() == "Sample");
+    assert(profile.slow_handler(0).count() == 1);
+    assert(subscriber_health.state() == goby::middleware::protobuf::HEALTH__DEGRADED);
+
+    std::cout << "all tests passed" << std::endl;
+}
@@ -0,0 +1,106 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+#include "goby/middleware/common.h"
+#include "goby/middleware/coroner/resources.h"
+
+// tests ResourceSampler
+
+using goby::middleware::ResourceSampler;
+
+std::atomic<bool> spin(true);
+std::atomic<int> spin_tid(0);
+
+void spinner()
+{
+    spin_tid = goby::middleware::gettid();
+    volatile unsigned long long x = 0;
+    while (spin) ++x;
+}
+
+int main(int argc, char* argv[])
+{
+    // parsing: the command name may contain spaces and parentheses
+    const std::string stat_contents =
+        "1234 (my (odd) app) S 1 1234 1234 0 -1 4194560 1500 0 3 0 250 50 0 0 20 0 7 0 "
+        "100 123456789 2048 18446744073709551615 1 1 0 0 0 0 0 4096 0 0 0 0 17 2 0 0 0 0 0";
+    ResourceSampler::Stat stat;
+    assert(ResourceSampler::parse_stat(stat_contents, stat));
+    assert(stat.minor_faults == 1500);
+    assert(stat.major_faults == 3);
+    assert(stat.cpu_ticks == 300);
+    assert(stat.num_threads == 7);
+    assert(stat.rss_pages == 2048);
+    assert(!ResourceSampler::parse_stat("1234 (truncated) S 1 2 3", stat));
+    assert(!ResourceSampler::parse_stat("garbage", stat));
+
+    const std::string status_contents = "Name:\tapp\nVmRSS:\t  8192 kB\n"
+                                        "voluntary_ctxt_switches:\t42\n"
+                                        "nonvoluntary_ctxt_switches:\t7\n";
+    goby::middleware::protobuf::ResourceUsage usage;
+    ResourceSampler::parse_status(status_contents, usage);
+    assert(usage.voluntary_context_switches() == 42);
+    assert(usage.involuntary_context_switches() == 7);
+
+    // sample this process, with a thread using all of one CPU
+    std::thread t(spinner);
+    while (spin_tid == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    goby::middleware::protobuf::ProcessHealth health;
+    health.set_name("test");
+    auto& main = *health.mutable_main();
+    main.set_name("main");
+    main.set_thread_id(goby::middleware::gettid());
+    main.set_state(goby::middleware::protobuf::HEALTH__OK);
+    auto& child = *main.add_child();
+    child.set_name("spinner");
+    child.set_thread_id(spin_tid);
+    child.set_state(goby::middleware::protobuf::HEALTH__OK);
+
+    ResourceSampler sampler;
+    sampler.sample(health);
+    std::cout << health.DebugString() << std::endl;
+    assert(health.resources().rss() > 0);
+    assert(health.resources().num_threads() >= 2);
+    assert(!health.resources().has_cpu_percent());
+    assert(child.resources().has_voluntary_context_switches());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    sampler.sample(health);
+    std::cout << health.DebugString() << std::endl;
+    // generous bounds for loaded machines
+    assert(child.resources().cpu_percent() > 20);
+    assert(main.resources().cpu_percent() < 20);
+    assert(health.resources().cpu_percent() >= child.resources().cpu_percent() - 10);
+
+    spin = false;
+    t.join();
+
+    std::cout << "all tests passed" << std::endl;
+}
@@ -0,0 +1,166 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests goby::middleware::Thread loop() timing and interthread comms using discrete event
+// simulation time
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include "goby/middleware/application/thread.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/time/discrete_event.h"
+#include "goby/time/steady_clock.h"
+#include "goby/time/system_clock.h"
+
+using goby::middleware::InterThreadTransporter;
+using goby::time::SystemClock;
+
+constexpr goby::middleware::Group tick_group{"tick"};
+
+struct Tick
+{
+    int count;
+    SystemClock::time_point time;
+};
+
+SystemClock::time_point start;
+std::atomic<int> ready(0);
+std::atomic<int> fast_count(0);
+std::atomic<int> slow_count(0);
+std::atomic<int> received_count(0);
+
+class FastThread : public goby::middleware::Thread<int, InterThreadTransporter>
+{
+  public:
+    FastThread() : goby::middleware::Thread<int, InterThreadTransporter>(0, &interthread_, 100.0)
+    {
+    }
+
+  private:
+    void initialize() override { ++ready; }
+
+    void loop() override
+    {
+        int count = ++fast_count;
+        auto now = SystemClock::now();
+        // called exactly on each tick
+        assert(now == start + count * std::chrono::milliseconds(10));
+        interthread_.publish<tick_group>(std::make_shared<const Tick>(Tick{count, now}));
+    }
+
+    InterThreadTransporter interthread_;
+};
+
+class SlowThread : public goby::middleware::Thread<int, InterThreadTransporter>
+{
+  public:
+    SlowThread() : goby::middleware::Thread<int, InterThreadTransporter>(0, &interthread_, 1.0) {}
+
+  private:
+    void initialize() override
+    {
+        interthread_.subscribe<tick_group>([](std::shared_ptr<const Tick> tick) {
+            ++received_count;
+            // time does not advance until the data are handled
+            assert(SystemClock::now() == tick->time);
+        });
+        ++ready;
+    }
+
+    void loop() override
+    {
+        int count = ++slow_count;
+        assert(SystemClock::now() == start + count * std::chrono::seconds(1));
+    }
+
+    InterThreadTransporter interthread_;
+};
+
+int main()
+{
+    goby::time::SimulatorSettings::using_sim_time = true;
+    goby::time::SimulatorSettings::discrete_event = true;
+    // no margin for messages in flight
+    goby::time::SimulatorSettings::discrete_event_settle_time = std::chrono::microseconds(0);
+    assert(goby::time::DiscreteEventClock::enabled());
+
+    // starts at the reference time
+    start = SystemClock::now();
+    assert(start.time_since_epoch() ==
+           std::chrono::duration_cast<SystemClock::duration>(
+               goby::time::SimulatorSettings::reference_time.time_since_epoch()));
+    assert(goby::time::SteadyClock::now().time_since_epoch() == start.time_since_epoch());
+
+    // hold the time while the threads start up
+    goby::time::DiscreteEventClock::add_participant();
+
+    auto real_start = std::chrono::steady_clock::now();
+
+    std::atomic<bool> alive(true);
+    std::atomic<int> done(0);
+    FastThread fast;
+    SlowThread slow;
+    std::thread fast_thread([&]() {
+        fast.run(alive);
+        ++done;
+    });
+    std::thread slow_thread([&]() {
+        slow.run(alive);
+        ++done;
+    });
+    while (ready < 2) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    assert(SystemClock::now() == start);
+
+    // wait in simulation time
+    InterThreadTransporter interthread;
+    const auto end = start + std::chrono::seconds(10);
+    while (SystemClock::now() < end) interthread.poll(end);
+    assert(SystemClock::now() == end);
+
+    alive = false;
+    // keep participating until the threads exit (as a duration, converted to simulation time)
+    while (done < 2) interthread.poll(std::chrono::seconds(1));
+    fast_thread.join();
+    slow_thread.join();
+
+    double real_elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - real_start).count();
+
+    std::cout << "fast loops: " << fast_count << ", slow loops: " << slow_count
+              << ", received: " << received_count << " in " << real_elapsed << " s (real)"
+              << std::endl;
+
+    assert(fast_count >= 1000);
+    assert(slow_count >= 10);
+    assert(received_count >= 999);
+    // CPU-light, so much faster than real time
+    assert(real_elapsed < 10);
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,198 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests batched publication of reads (IODataBatch) and recycling of IOData by MessagePool
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "goby/middleware/io/detail/message_pool.h"
+#include "goby/middleware/io/udp_point_to_point.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/util/debug_logger.h"
+
+using goby::middleware::io::PubSubLayer;
+using goby::middleware::io::detail::MessagePool;
+using goby::middleware::protobuf::IOData;
+using goby::middleware::protobuf::IODataBatch;
+using goby::middleware::protobuf::IOStatus;
+
+constexpr goby::middleware::Group a_in{"a_in"};
+constexpr goby::middleware::Group a_out{"a_out"};
+constexpr goby::middleware::Group b_in{"b_in"};
+constexpr goby::middleware::Group b_out{"b_out"};
+
+template <const goby::middleware::Group& in, const goby::middleware::Group& out>
+using UDPThread = goby::middleware::io::UDPPointToPointThread<in, out, PubSubLayer::INTERTHREAD,
+                                                               PubSubLayer::INTERTHREAD>;
+
+constexpr int messages = 23;
+constexpr int max_batch = 5;
+constexpr int base_port = 54331;
+
+std::atomic<bool> alive{true};
+
+void test_pool()
+{
+    auto pool = MessagePool<IOData>::create(1);
+    const IOData* first_ptr;
+    {
+        auto first = pool->make();
+        first_ptr = first.get();
+        first->set_index(2);
+        first->set_data(std::string(1000, 'x'));
+    }
+    // released message is cleared and reused, keeping its capacity
+    auto second = pool->make();
+    assert(second.get() == first_ptr);
+    assert(!second->has_index() && !second->has_data());
+    assert(second->data().capacity() >= 1000);
+
+    // beyond max_idle, released messages are deleted
+    auto third = pool->make();
+    assert(third.get() != first_ptr);
+    second.reset();
+    third.reset();
+    assert(pool->make().get() == first_ptr);
+
+    // messages may outlive the pool
+    auto orphan = pool->make();
+    pool.reset();
+    orphan.reset();
+    std::cout << "MessagePool ok" << std::endl;
+}
+
+template <typename ThreadType>
+std::thread launch(int bind_port, int remote_port, int max_messages)
+{
+    goby::middleware::protobuf::UDPPointToPointConfig cfg;
+    cfg.set_bind_port(bind_port);
+    cfg.set_remote_address("127.0.0.1");
+    cfg.set_remote_port(remote_port);
+    cfg.mutable_batch()->set_max_messages(max_messages);
+    cfg.mutable_batch()->set_max_latency(0.1);
+
+    return std::thread([cfg]() {
+        ThreadType thread(cfg);
+        thread.run(alive);
+    });
+}
+
+template <typename Predicate>
+void poll_until(goby::middleware::InterThreadTransporter& main, Predicate done)
+{
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!done())
+    {
+        main.poll(std::chrono::milliseconds(10));
+        assert(std::chrono::steady_clock::now() < timeout);
+    }
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::DEBUG1, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    test_pool();
+
+    goby::middleware::InterThreadTransporter main;
+
+    int links_open = 0;
+    auto status_callback = [&](const IOStatus& status) {
+        if (status.state() == goby::middleware::protobuf::IO__LINK_OPEN)
+            ++links_open;
+    };
+    main.subscribe<a_in, IOStatus>(status_callback);
+    main.subscribe<b_in, IOStatus>(status_callback);
+
+    // a batches, b (default configuration) does not
+    std::vector<std::string> a_received, b_received;
+    std::vector<int> batch_sizes;
+    main.subscribe<a_in, IOData>([&](const IOData& d) { assert(false); });
+    main.subscribe<a_in, IODataBatch>([&](const IODataBatch& batch) {
+        batch_sizes.push_back(batch.data_size());
+        for (const auto& d : batch.data())
+        {
+            assert(d.has_udp_src());
+            a_received.push_back(d.data());
+        }
+    });
+    main.subscribe<b_in, IOData>([&](const IOData& d) { b_received.push_back(d.data()); });
+    main.subscribe<b_in, IODataBatch>([&](const IODataBatch& batch) { assert(false); });
+
+    std::vector<std::thread> threads;
+    threads.push_back(launch<UDPThread<a_in, a_out>>(base_port, base_port + 1, max_batch));
+    threads.push_back(launch<UDPThread<b_in, b_out>>(base_port + 1, base_port, 1));
+
+    poll_until(main, [&]() { return links_open == 2; });
+    std::cout << "All links open" << std::endl;
+
+    for (int i = 0; i < messages; ++i)
+    {
+        auto make_data = [i](const std::string& from) {
+            auto io_data = std::make_shared<IOData>();
+            io_data->set_data(from + std::to_string(i));
+            return io_data;
+        };
+        main.publish<a_out>(make_data("a"));
+        main.publish<b_out>(make_data("b"));
+    }
+
+    // the final partial batch is published after max_latency
+    poll_until(main, [&]() {
+        return a_received.size() == messages && b_received.size() == messages;
+    });
+
+    for (int i = 0; i < messages; ++i)
+    {
+        assert(a_received[i] == "b" + std::to_string(i));
+        assert(b_received[i] == "a" + std::to_string(i));
+    }
+    int full_batches = 0;
+    for (int size : batch_sizes)
+    {
+        assert(size > 0 && size <= max_batch);
+        if (size == max_batch)
+            ++full_batches;
+    }
+    std::cout << "Received " << messages << " reads in " << batch_sizes.size() << " batches"
+              << std::endl;
+    assert(full_batches > 0);
+
+    alive = false;
+    goby::middleware::ThreadIdentifier all;
+    all.all_threads = true;
+    main.publish<goby::middleware::SimpleThread<
+        goby::middleware::protobuf::UDPPointToPointConfig>::shutdown_group_>(all);
+    for (auto& thread : threads) thread.join();
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
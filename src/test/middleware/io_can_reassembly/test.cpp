@@ -0,0 +1,252 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests CanReassembler: single frame PGNs, J1939 transport protocol (BAM and RTS/CTS) and NMEA
+// 2000 fast packets
+
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "goby/middleware/io/can.h"
+#include "goby/middleware/io/can_reassembly.h"
+
+using goby::middleware::io::CanReassembler;
+using goby::middleware::io::make_extended_format_can_id;
+using goby::middleware::protobuf::CanConfig;
+using goby::time::SteadyClock;
+
+constexpr std::uint32_t tp_cm{0xEC00};
+constexpr std::uint32_t tp_dt{0xEB00};
+constexpr std::uint8_t global{0xFF};
+
+// pdu_specific is the destination for PDU1 PGNs
+can_frame make_frame(std::uint32_t pgn, std::uint8_t source, const std::string& data,
+                     std::uint8_t pdu_specific = 0, std::uint8_t priority = 6)
+{
+    can_frame frame{};
+    frame.can_id = make_extended_format_can_id(pgn | pdu_specific, priority, source);
+    frame.can_dlc = data.size();
+    std::memcpy(frame.data, data.data(), data.size());
+    return frame;
+}
+
+std::string bytes(std::initializer_list<int> values)
+{
+    std::string s;
+    for (int v : values) s += static_cast<char>(v);
+    return s;
+}
+
+std::string payload(int size)
+{
+    std::string s;
+    for (int i = 0; i < size; ++i) s += static_cast<char>('a' + i % 26);
+    return s;
+}
+
+// TP.CM RTS (16) or BAM (32) announcing pgn
+can_frame make_tp_cm(std::uint8_t control, std::uint8_t source, std::uint8_t destination,
+                     std::uint32_t pgn, int size)
+{
+    int packets = (size + 6) / 7;
+    return make_frame(tp_cm, source,
+                      bytes({control, size & 0xFF, size >> 8, packets, 0xFF, int(pgn & 0xFF),
+                             int((pgn >> 8) & 0xFF), int(pgn >> 16)}),
+                      destination, 7);
+}
+
+// TP.DT packet sequence (from 1) of data, padded with 0xFF
+can_frame make_tp_dt(std::uint8_t source, std::uint8_t destination, int sequence,
+                     const std::string& data)
+{
+    std::string packet = data.substr((sequence - 1) * 7, 7);
+    packet.resize(7, '\xFF');
+    return make_frame(tp_dt, source, static_cast<char>(sequence) + packet, destination, 7);
+}
+
+void test_single_frame(CanReassembler& reassembler)
+{
+    // PDU2 (vessel heading)
+    auto msg = reassembler.add_frame(make_frame(127250, 0x12, payload(8), 0, 2));
+    assert(msg);
+    assert(msg->pgn() == 127250 && msg->source() == 0x12 && msg->priority() == 2);
+    assert(msg->destination() == global && msg->data() == payload(8));
+
+    // PDU1 (request) to 0x23
+    msg = reassembler.add_frame(make_frame(0xEA00, 0x12, payload(3), 0x23));
+    assert(msg && msg->pgn() == 0xEA00 && msg->destination() == 0x23);
+    assert(msg->data() == payload(3));
+
+    // standard frames are not J1939
+    can_frame standard{};
+    standard.can_id = 0x123;
+    standard.can_dlc = 2;
+    assert(!reassembler.add_frame(standard));
+    std::cout << "single frame ok" << std::endl;
+}
+
+void test_bam(CanReassembler& reassembler)
+{
+    // vehicle identification (PDU2), 20 bytes in 3 packets
+    const std::uint32_t pgn = 65260;
+    const std::string data = payload(20);
+    assert(!reassembler.add_frame(make_tp_cm(32, 0x10, global, pgn, data.size())));
+    assert(reassembler.pending() == 1);
+    assert(!reassembler.add_frame(make_tp_dt(0x10, global, 1, data)));
+    assert(!reassembler.add_frame(make_tp_dt(0x10, global, 2, data)));
+    auto msg = reassembler.add_frame(make_tp_dt(0x10, global, 3, data));
+    assert(msg);
+    assert(msg->pgn() == pgn && msg->source() == 0x10 && msg->destination() == global);
+    assert(msg->priority() == 7 && msg->data() == data);
+    assert(reassembler.pending() == 0);
+    std::cout << "BAM ok" << std::endl;
+}
+
+void test_rts_cts(CanReassembler& reassembler)
+{
+    // proprietary A (PDU1) from 0x10 to 0x20, with the first packet resent out of order
+    const std::uint32_t pgn = 0xEF00;
+    const std::string data = payload(10);
+    assert(!reassembler.add_frame(make_tp_cm(16, 0x10, 0x20, pgn, data.size())));
+    // CTS from the receiver
+    assert(!reassembler.add_frame(
+        make_frame(tp_cm, 0x20, bytes({17, 2, 1, 0xFF, 0xFF, 0x00, 0xEF, 0x00}), 0x10, 7)));
+    assert(!reassembler.add_frame(make_tp_dt(0x10, 0x20, 2, data)));
+    auto msg = reassembler.add_frame(make_tp_dt(0x10, 0x20, 1, data));
+    assert(msg);
+    assert(msg->pgn() == pgn && msg->source() == 0x10 && msg->destination() == 0x20);
+    assert(msg->data() == data);
+
+    // aborted by the receiver
+    assert(!reassembler.add_frame(make_tp_cm(16, 0x10, 0x20, pgn, data.size())));
+    assert(reassembler.pending() == 1);
+    assert(!reassembler.add_frame(
+        make_frame(tp_cm, 0x20, bytes({255, 1, 0xFF, 0xFF, 0xFF, 0x00, 0xEF, 0x00}), 0x10, 7)));
+    assert(reassembler.pending() == 0);
+    assert(!reassembler.add_frame(make_tp_dt(0x10, 0x20, 1, data)));
+    assert(!reassembler.add_frame(make_tp_dt(0x10, 0x20, 2, data)));
+
+    // announced packet count inconsistent with the size
+    assert(!reassembler.add_frame(
+        make_frame(tp_cm, 0x10, bytes({16, 10, 0, 5, 0xFF, 0x00, 0xEF, 0x00}), 0x20, 7)));
+    assert(reassembler.pending() == 0);
+    std::cout << "RTS/CTS ok" << std::endl;
+}
+
+void test_timeout(CanReassembler& reassembler)
+{
+    const std::string data = payload(14);
+    auto start = SteadyClock::now();
+    assert(!reassembler.add_frame(make_tp_cm(32, 0x11, global, 65260, data.size()), start));
+    assert(!reassembler.add_frame(make_tp_dt(0x11, global, 1, data), start));
+    // after the (default 0.75 s) timeout
+    assert(!reassembler.add_frame(make_tp_dt(0x11, global, 2, data),
+                                  start + std::chrono::seconds(1)));
+    assert(reassembler.pending() == 0);
+
+    // transfers from nodes that went silent are discarded on the next frame from any node
+    start = SteadyClock::now();
+    assert(!reassembler.add_frame(make_tp_cm(32, 0x11, global, 65260, data.size()), start));
+    assert(!reassembler.add_frame(make_tp_cm(16, 0x12, 0x20, 0xEF00, data.size()), start));
+    assert(reassembler.pending() == 2);
+    assert(reassembler.add_frame(make_frame(127250, 0x13, payload(8)),
+                                 start + std::chrono::milliseconds(500)));
+    assert(reassembler.pending() == 2);
+    assert(!reassembler.add_frame(make_tp_cm(32, 0x14, global, 65260, data.size()),
+                                  start + std::chrono::milliseconds(500)));
+    assert(reassembler.pending() == 3);
+    assert(reassembler.add_frame(make_frame(127250, 0x13, payload(8)),
+                                 start + std::chrono::seconds(1)));
+    assert(reassembler.pending() == 1);
+
+    // or explicitly
+    reassembler.remove_expired(start + std::chrono::seconds(2));
+    assert(reassembler.pending() == 0);
+    std::cout << "timeout ok" << std::endl;
+}
+
+void test_fast_packet(CanReassembler& reassembler)
+{
+    // GNSS position data, 43 bytes in 7 frames (6 + 6 * 7)
+    const std::uint32_t pgn = 129029;
+    const std::string data = payload(43);
+    auto frame = [&](int sequence, int index) {
+        std::string bytes(1, static_cast<char>(sequence << 5 | index));
+        if (index == 0)
+            bytes += static_cast<char>(data.size()) + data.substr(0, 6);
+        else
+            bytes += data.substr(6 + (index - 1) * 7, 7);
+        bytes.resize(8, '\xFF');
+        return make_frame(pgn, 0x30, bytes, 0, 3);
+    };
+
+    for (int i = 0; i < 6; ++i) assert(!reassembler.add_frame(frame(3, i)));
+    auto msg = reassembler.add_frame(frame(3, 6));
+    assert(msg);
+    assert(msg->pgn() == pgn && msg->source() == 0x30 && msg->priority() == 3);
+    assert(msg->data() == data);
+    assert(reassembler.pending() == 0);
+
+    // lost frame: the rest of the packet is discarded
+    assert(!reassembler.add_frame(frame(4, 0)));
+    assert(!reassembler.add_frame(frame(4, 1)));
+    assert(!reassembler.add_frame(frame(4, 3)));
+    assert(reassembler.pending() == 0);
+    for (int i = 4; i <= 6; ++i) assert(!reassembler.add_frame(frame(4, i)));
+
+    // new sequence counter restarts
+    for (int i = 0; i < 6; ++i) assert(!reassembler.add_frame(frame(5, i)));
+    assert(!reassembler.add_frame(frame(6, 0)));
+    assert(!reassembler.add_frame(frame(5, 1)));
+    assert(reassembler.pending() == 0);
+
+    // fits in the first frame
+    msg = reassembler.add_frame(make_frame(pgn, 0x31, bytes({0, 4, 1, 2, 3, 4, 0xFF, 0xFF})));
+    assert(msg && msg->data() == bytes({1, 2, 3, 4}));
+    std::cout << "fast packet ok" << std::endl;
+}
+
+int main()
+{
+    CanConfig::Reassembly cfg;
+    cfg.add_fast_packet_pgn(129029);
+    CanReassembler reassembler(cfg);
+
+    test_single_frame(reassembler);
+    test_bam(reassembler);
+    test_rts_cts(reassembler);
+    test_timeout(reassembler);
+    test_fast_packet(reassembler);
+
+    // without transport protocol reassembly, TP frames are passed through as is
+    cfg.set_j1939_transport_protocol(false);
+    CanReassembler passthrough(cfg);
+    auto msg = passthrough.add_frame(make_tp_cm(32, 0x10, global, 65260, 20));
+    assert(msg && msg->pgn() == tp_cm && msg->destination() == global);
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
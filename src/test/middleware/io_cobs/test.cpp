@@ -0,0 +1,196 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests the memchr based COBS encoder/decoder against util/thirdparty/cobs, and cobs_async_read
+// on packets split and joined arbitrarily across reads
+
+#include <cassert>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+
+#include "goby/middleware/io/cobs/common.h"
+#include "goby/util/thirdparty/cobs/cobs.h"
+
+using goby::middleware::io::detail::cobs_stuff;
+using goby::middleware::io::detail::cobs_unstuff;
+using goby::middleware::protobuf::IOData;
+
+std::mt19937 rng(1);
+
+// random data with zeros at the given probability
+std::string random_data(std::size_t size, double zero_probability)
+{
+    std::bernoulli_distribution zero(zero_probability);
+    std::uniform_int_distribution<int> byte(1, 255);
+    std::string data(size, '\0');
+    for (auto& c : data) c = zero(rng) ? 0 : static_cast<char>(byte(rng));
+    return data;
+}
+
+std::string reference_encode(const std::string& data)
+{
+    std::string encoded(data.size() + data.size() / 254 + 1, '\0');
+    encoded.resize(cobs_encode(reinterpret_cast<const std::uint8_t*>(data.data()), data.size(),
+                               reinterpret_cast<std::uint8_t*>(&encoded[0])));
+    return encoded;
+}
+
+void test_codec()
+{
+    std::vector<std::size_t> sizes{0, 1, 2, 253, 254, 255, 256, 507, 508, 509, 1000, 4096};
+    for (double zero_probability : {0.0, 0.01, 0.5, 1.0})
+    {
+        for (auto size : sizes)
+        {
+            auto data = random_data(size, zero_probability);
+            auto expected = reference_encode(data);
+
+            std::string encoded(size + size / 254 + 1, '\0');
+            encoded.resize(cobs_stuff(data.data(), data.size(), &encoded[0]));
+            assert(encoded == expected);
+            assert(encoded.find('\0') == std::string::npos);
+
+            std::string decoded(encoded.size(), '\0');
+            auto decoded_size = cobs_unstuff(encoded.data(), encoded.size(), &decoded[0]);
+            assert(decoded_size == static_cast<std::ptrdiff_t>(size));
+            decoded.resize(decoded_size);
+            assert(decoded == data);
+
+            // in place
+            auto in_place_size = cobs_unstuff(encoded.data(), encoded.size(), &encoded[0]);
+            encoded.resize(in_place_size);
+            assert(encoded == data);
+        }
+    }
+
+    // code byte points past the end
+    std::string decoded(8, '\0');
+    assert(cobs_unstuff("\x05\x01\x02", 3, &decoded[0]) == -1);
+    std::cout << "codec ok" << std::endl;
+}
+
+// minimal stand-in for a COBS IOThread
+struct Reader
+{
+    Reader(boost::asio::io_context& io) : socket(io) {}
+
+    void async_read() { goby::middleware::io::cobs_async_read(this); }
+    boost::asio::local::stream_protocol::socket& mutable_socket() { return socket; }
+    std::shared_ptr<IOData> make_io_data() { return std::make_shared<IOData>(); }
+    void handle_read_success(std::size_t, std::shared_ptr<IOData> io_msg)
+    {
+        packets.push_back(io_msg->data());
+    }
+    void handle_read_error(const boost::system::error_code& ec) { ++errors; }
+    std::string glog_group() { return "cobs"; }
+
+    boost::asio::local::stream_protocol::socket socket;
+    boost::asio::streambuf buffer_;
+    std::vector<std::string> packets;
+    int errors{0};
+};
+
+void test_stream()
+{
+    boost::asio::io_context io;
+    Reader reader(io);
+    boost::asio::local::stream_protocol::socket writer(io);
+    boost::asio::local::connect_pair(reader.socket, writer);
+
+    // leading delimiter, then packets of assorted sizes (up to several reads long)
+    std::vector<std::string> sent;
+    std::string stream(1, '\0');
+    for (int i = 0; i < 200; ++i)
+    {
+        std::uniform_int_distribution<int> size(0, i % 10 == 0 ? 10000 : 100);
+        sent.push_back(random_data(size(rng), 0.05));
+        stream += *goby::middleware::io::cobs_encode_packet(sent.back(), "cobs");
+    }
+
+    reader.async_read();
+
+    // write in random sized pieces, handling the reads in between
+    std::uniform_int_distribution<std::size_t> piece(1, 3000);
+    for (std::size_t offset = 0; offset < stream.size();)
+    {
+        auto n = std::min(piece(rng), stream.size() - offset);
+        boost::asio::write(writer, boost::asio::buffer(stream.data() + offset, n));
+        offset += n;
+        while (io.poll() > 0) {}
+    }
+    while (reader.packets.size() < sent.size()) io.run_one();
+
+    assert(reader.errors == 0);
+    assert(reader.packets == sent);
+    assert(reader.buffer_.size() == 0);
+
+    // invalid packet
+    boost::asio::write(writer, boost::asio::buffer(std::string("\x05\x01\x02\0", 4)));
+    while (reader.errors == 0) io.run_one();
+    assert(reader.packets.size() == sent.size());
+    std::cout << "stream ok" << std::endl;
+}
+
+int main()
+{
+    test_codec();
+    test_stream();
+
+    // throughput of the byte-wise reference and memchr/memcpy implementations
+    auto data = random_data(1 << 20, 0.001);
+    auto time = [](const std::function<void()>& f) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < 20; ++i) f();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    std::string encoded(data.size() + data.size() / 254 + 1, '\0'), decoded(encoded.size(), '\0');
+    auto encoded_size = cobs_stuff(data.data(), data.size(), &encoded[0]);
+    double reference_encode_time = time([&]() {
+        cobs_encode(reinterpret_cast<const std::uint8_t*>(data.data()), data.size(),
+                    reinterpret_cast<std::uint8_t*>(&encoded[0]));
+    });
+    double encode_time = time([&]() { cobs_stuff(data.data(), data.size(), &encoded[0]); });
+    double reference_decode_time = time([&]() {
+        cobs_decode(reinterpret_cast<const std::uint8_t*>(encoded.data()), encoded_size,
+                    reinterpret_cast<std::uint8_t*>(&decoded[0]));
+    });
+    double decode_time =
+        time([&]() { cobs_unstuff(encoded.data(), encoded_size, &decoded[0]); });
+    std::cout << "20 MiB: encode " << reference_encode_time << " s (reference), " << encode_time
+              << " s; decode " << reference_decode_time << " s (reference), " << decode_time
+              << " s" << std::endl;
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,204 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests I/O threads sharing an IOContextPool: two UDP loopback pairs exchange data while the
+// process runs one thread per device plus the pool workers (no per-device helper threads)
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <deque>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "goby/middleware/io/io_context_pool.h"
+#include "goby/middleware/io/udp_point_to_point.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/util/debug_logger.h"
+
+using goby::middleware::io::PubSubLayer;
+using goby::middleware::protobuf::IOData;
+using goby::middleware::protobuf::IOStatus;
+
+constexpr goby::middleware::Group a_in{"a_in"};
+constexpr goby::middleware::Group a_out{"a_out"};
+constexpr goby::middleware::Group b_in{"b_in"};
+constexpr goby::middleware::Group b_out{"b_out"};
+constexpr goby::middleware::Group c_in{"c_in"};
+constexpr goby::middleware::Group c_out{"c_out"};
+constexpr goby::middleware::Group d_in{"d_in"};
+constexpr goby::middleware::Group d_out{"d_out"};
+
+template <const goby::middleware::Group& in, const goby::middleware::Group& out>
+using UDPThread = goby::middleware::io::UDPPointToPointThread<in, out, PubSubLayer::INTERTHREAD,
+                                                               PubSubLayer::INTERTHREAD>;
+
+constexpr int pool_threads = 2;
+constexpr int device_threads = 4;
+constexpr int messages = 50;
+constexpr int base_port = 54321;
+
+std::atomic<bool> alive{true};
+
+template <typename ThreadType> std::thread launch(int bind_port, int remote_port)
+{
+    goby::middleware::protobuf::UDPPointToPointConfig cfg;
+    cfg.set_bind_port(bind_port);
+    cfg.set_remote_address("127.0.0.1");
+    cfg.set_remote_port(remote_port);
+
+    // like MultiThreadApplication, construct in the thread that runs it
+    return std::thread([cfg]() {
+        ThreadType thread(cfg);
+        thread.run(alive);
+    });
+}
+
+// returns the number of threads in this process, and how many of those have names starting with
+// prefix
+std::pair<int, int> task_count(const std::string& prefix)
+{
+    int count = 0, prefix_count = 0;
+    DIR* dir = opendir("/proc/self/task");
+    assert(dir);
+    while (dirent* entry = readdir(dir))
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+        ++count;
+        std::ifstream comm(std::string("/proc/self/task/") + entry->d_name + "/comm");
+        std::string name;
+        std::getline(comm, name);
+        if (name.compare(0, prefix.size(), prefix) == 0)
+            ++prefix_count;
+    }
+    closedir(dir);
+    return std::make_pair(count, prefix_count);
+}
+
+template <typename Predicate>
+void poll_until(goby::middleware::InterThreadTransporter& main, Predicate done)
+{
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!done())
+    {
+        main.poll(std::chrono::milliseconds(100));
+        assert(std::chrono::steady_clock::now() < timeout);
+    }
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::DEBUG1, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    goby::middleware::io::IOContextPool::configure(pool_threads);
+    assert(goby::middleware::io::IOContextPool::enabled());
+
+    goby::middleware::InterThreadTransporter main;
+
+    int links_open = 0;
+    std::vector<std::deque<std::string>> received(device_threads);
+    auto status_callback = [&](const IOStatus& status) {
+        if (status.state() == goby::middleware::protobuf::IO__LINK_OPEN)
+            ++links_open;
+    };
+    main.subscribe<a_in, IOStatus>(status_callback);
+    main.subscribe<b_in, IOStatus>(status_callback);
+    main.subscribe<c_in, IOStatus>(status_callback);
+    main.subscribe<d_in, IOStatus>(status_callback);
+    main.subscribe<a_in, IOData>([&](const IOData& d) { received[0].push_back(d.data()); });
+    main.subscribe<b_in, IOData>([&](const IOData& d) { received[1].push_back(d.data()); });
+    main.subscribe<c_in, IOData>([&](const IOData& d) { received[2].push_back(d.data()); });
+    main.subscribe<d_in, IOData>([&](const IOData& d) { received[3].push_back(d.data()); });
+
+    int initial_tasks = task_count("").first;
+
+    // a <-> b, c <-> d
+    std::vector<std::thread> threads;
+    threads.push_back(launch<UDPThread<a_in, a_out>>(base_port, base_port + 1));
+    threads.push_back(launch<UDPThread<b_in, b_out>>(base_port + 1, base_port));
+    threads.push_back(launch<UDPThread<c_in, c_out>>(base_port + 2, base_port + 3));
+    threads.push_back(launch<UDPThread<d_in, d_out>>(base_port + 3, base_port + 2));
+
+    poll_until(main, [&]() { return links_open == device_threads; });
+    std::cout << "All links open" << std::endl;
+
+    auto tasks = task_count("goby::io/");
+    int started = tasks.first - initial_tasks;
+    std::cout << "Threads started: " << started << " (" << device_threads << " devices, "
+              << tasks.second << " pool workers)" << std::endl;
+    assert(tasks.second == pool_threads);
+    // one thread per device plus the pool workers (without the pool each device also runs a
+    // helper thread)
+    assert(started == device_threads + pool_threads);
+
+    for (int i = 0; i < messages; ++i)
+    {
+        auto make_data = [i](const std::string& from) {
+            auto io_data = std::make_shared<IOData>();
+            io_data->set_data(from + std::to_string(i));
+            return io_data;
+        };
+        main.publish<a_out>(make_data("a"));
+        main.publish<b_out>(make_data("b"));
+        main.publish<c_out>(make_data("c"));
+        main.publish<d_out>(make_data("d"));
+        // stay well below the loopback socket buffer size
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    poll_until(main, [&]() {
+        for (const auto& r : received)
+        {
+            if (r.size() < messages)
+                return false;
+        }
+        return true;
+    });
+
+    const std::vector<std::string> senders{"b", "a", "d", "c"};
+    for (int device = 0; device < device_threads; ++device)
+    {
+        assert(received[device].size() == messages);
+        for (int i = 0; i < messages; ++i)
+            assert(received[device][i] == senders[device] + std::to_string(i));
+    }
+    std::cout << "All data received in order" << std::endl;
+
+    alive = false;
+    goby::middleware::ThreadIdentifier all;
+    all.all_threads = true;
+    main.publish<goby::middleware::SimpleThread<
+        goby::middleware::protobuf::UDPPointToPointConfig>::shutdown_group_>(all);
+    for (auto& thread : threads) thread.join();
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,179 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests match_eol against match_regex and benchmarks both on an NMEA-0183 stream
+
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/buffers_iterator.hpp>
+#include <boost/asio/streambuf.hpp>
+
+#include "goby/middleware/io/line_based/common.h"
+
+using goby::middleware::io::match_eol;
+using goby::middleware::io::match_regex;
+
+// emulates boost::asio::async_read_until on a stream arriving chunk_size bytes at a time
+template <typename Matcher>
+std::vector<std::string> read_lines(const std::string& stream, std::size_t chunk_size,
+                                    const Matcher& matcher)
+{
+    std::vector<std::string> lines;
+    boost::asio::streambuf buffer;
+    std::size_t search_position = 0;
+    for (std::size_t offset = 0; offset < stream.size(); offset += chunk_size)
+    {
+        auto chunk = stream.substr(offset, chunk_size);
+        auto mutable_buf = buffer.prepare(chunk.size());
+        std::copy(chunk.begin(), chunk.end(), boost::asio::buffers_begin(mutable_buf));
+        buffer.commit(chunk.size());
+
+        while (true)
+        {
+            // iterators refer to this buffer sequence, as in boost::asio::read_until
+            auto data = buffer.data();
+            auto begin = boost::asio::buffers_begin(data);
+            auto end = boost::asio::buffers_end(data);
+            auto result = matcher(begin + search_position, end);
+            if (result.second)
+            {
+                std::string line(begin, result.first);
+                buffer.consume(line.size());
+                lines.push_back(line);
+                search_position = 0;
+            }
+            else
+            {
+                search_position = result.first - begin;
+                break;
+            }
+        }
+    }
+    return lines;
+}
+
+void check_equivalent(const std::string& eol, const std::string& stream, bool fixed_width)
+{
+    match_eol eol_matcher(eol);
+    match_regex regex_matcher(eol);
+    assert(eol_matcher.is_fixed_width() == fixed_width);
+
+    for (std::size_t chunk_size : {1, 2, 3, 7, 64, 4096})
+    {
+        auto expected = read_lines(stream, chunk_size, regex_matcher);
+        auto lines = read_lines(stream, chunk_size, eol_matcher);
+        assert(lines == expected);
+
+        // also for a plain contiguous iterator (std::find rather than memchr)
+        const std::string& s = stream;
+        auto result = eol_matcher(s.begin(), s.end());
+        auto expected_result = regex_matcher(s.begin(), s.end());
+        assert(result.second == expected_result.second);
+        if (result.second)
+            assert(result.first == expected_result.first);
+    }
+}
+
+std::string nmea_stream(int sentences)
+{
+    const std::vector<std::string> nmea = {
+        "$GPGGA,123519,4807.038,N,01131.000,E,1,08,0.9,545.4,M,46.9,M,,*47\r\n",
+        "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W*6A\r\n",
+        "$GPVTG,054.7,T,034.4,M,005.5,N,010.2,K*48\r\n",
+        "$HEHDT,274.07,T*03\r\n",
+        "$SDDBT,8.1,f,2.4,M,1.3,F*0B\r\n"};
+    std::string stream;
+    for (int i = 0; i < sentences; ++i) stream += nmea[i % nmea.size()];
+    return stream;
+}
+
+template <typename Matcher>
+double benchmark(const std::string& stream, std::size_t chunk_size, const Matcher& matcher,
+                 std::size_t* line_count)
+{
+    auto start = std::chrono::steady_clock::now();
+    *line_count = read_lines(stream, chunk_size, matcher).size();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    // parsing
+    assert(match_eol("\n").is_fixed_width());
+    assert(match_eol("\r\n").is_fixed_width());
+    assert(match_eol("\\*[0-9A-F]{2}\r\n").is_fixed_width());
+    assert(match_eol("\\*..\\r\\n").is_fixed_width());
+    assert(match_eol("[^a-z]\\d\\.").is_fixed_width());
+    assert(!match_eol("\r\n|\n").is_fixed_width());
+    assert(!match_eol("\r?\n").is_fixed_width());
+    assert(!match_eol("a{1,2}").is_fixed_width());
+    assert(!match_eol("\\s").is_fixed_width());
+    assert(!match_eol("[[:alpha:]]").is_fixed_width());
+
+    const std::string nmea = nmea_stream(50);
+    check_equivalent("\n", nmea, true);
+    check_equivalent("\r\n", nmea, true);
+    check_equivalent("\\*[0-9A-F]{2}\r\n", nmea, true);
+    check_equivalent("\\*..\\r\\n", nmea, true);
+    check_equivalent(",", nmea, true);
+    check_equivalent("[,*]", nmea, true);
+    check_equivalent("[^$A-Z0-9.,*\r]", nmea, true);
+    check_equivalent("\r?\n", nmea, false);
+    check_equivalent("\r\n|,", nmea, false);
+    // partial matches of the delimiter
+    check_equivalent("\r\n", "ab\r\rc\r\nd\n\r\n\r", true);
+    check_equivalent("aab", "aaaab aab ab aaab", true);
+    check_equivalent("a{3}b", "aaaab aab ab aaab", true);
+
+    // benchmark: typical serial reads (32 bytes) and a single long partial line
+    const std::string bench_stream = nmea_stream(argc > 1 ? std::stoi(argv[1]) : 20000);
+    const std::string long_line = std::string(1 << 14, 'x') + "\r\n";
+    const std::vector<std::pair<std::string, std::string>> eols = {
+        {"\\r\\n", "\r\n"}, {"\\*[0-9A-F]{2}\\r\\n", "\\*[0-9A-F]{2}\r\n"}};
+    for (const auto& name_eol : eols)
+    {
+        const std::string& eol = name_eol.second;
+        std::size_t eol_lines, regex_lines;
+        double eol_time = benchmark(bench_stream, 32, match_eol(eol), &eol_lines);
+        double regex_time = benchmark(bench_stream, 32, match_regex(eol), &regex_lines);
+        assert(eol_lines == regex_lines);
+
+        std::size_t long_eol_lines, long_regex_lines;
+        double long_eol_time = benchmark(long_line, 32, match_eol(eol), &long_eol_lines);
+        double long_regex_time = benchmark(long_line, 32, match_regex(eol), &long_regex_lines);
+        assert(long_eol_lines == long_regex_lines);
+
+        std::cout << "end_of_line \"" << name_eol.first << "\": " << eol_lines
+                  << " NMEA lines: match_eol " << eol_time << " s, match_regex " << regex_time
+                  << " s; " << long_line.size() << " byte line: match_eol " << long_eol_time
+                  << " s, match_regex " << long_regex_time << " s" << std::endl;
+    }
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,262 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests TCP server fan-out: each message is encoded once and written to every client, and a
+// client that stops reading is disconnected once its backlog exceeds max_client_backlog
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+
+#include "goby/middleware/io/cobs/tcp_server.h"
+#include "goby/middleware/io/line_based/tcp_server.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/util/debug_logger.h"
+#include "goby/util/thirdparty/cobs/cobs.h"
+
+using goby::middleware::io::PubSubLayer;
+using goby::middleware::protobuf::IOData;
+using goby::middleware::protobuf::TCPServerEvent;
+using boost::asio::ip::tcp;
+
+constexpr goby::middleware::Group cobs_in{"cobs_in"};
+constexpr goby::middleware::Group cobs_out{"cobs_out"};
+constexpr goby::middleware::Group line_in{"line_in"};
+constexpr goby::middleware::Group line_out{"line_out"};
+
+using COBSServer = goby::middleware::io::TCPServerThreadCOBS<
+    cobs_in, cobs_out, PubSubLayer::INTERTHREAD, PubSubLayer::INTERTHREAD>;
+using LineServer =
+    goby::middleware::io::TCPServerThreadLineBased<line_in, line_out, PubSubLayer::INTERTHREAD,
+                                                   PubSubLayer::INTERTHREAD>;
+
+constexpr int cobs_port = 54341;
+constexpr int line_port = 54342;
+constexpr int cobs_clients = 3;
+constexpr int cobs_messages = 100;
+constexpr int line_messages = 1000;
+constexpr int line_size = 32768;
+constexpr int max_backlog = 262144;
+
+std::atomic<bool> alive{true};
+
+template <typename ThreadType> std::thread launch(int port)
+{
+    goby::middleware::protobuf::TCPServerConfig cfg;
+    cfg.set_bind_port(port);
+    cfg.set_set_reuseaddr(true);
+    cfg.set_max_client_backlog(max_backlog);
+
+    return std::thread([cfg]() {
+        ThreadType thread(cfg);
+        thread.run(alive);
+    });
+}
+
+void connect(tcp::socket& socket, int port)
+{
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (true)
+    {
+        boost::system::error_code ec;
+        socket.connect(tcp::endpoint(boost::asio::ip::address_v4::loopback(), port), ec);
+        if (!ec)
+            return;
+        socket.close();
+        assert(std::chrono::steady_clock::now() < timeout);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+template <typename Predicate>
+void poll_until(goby::middleware::InterThreadTransporter& main, Predicate done)
+{
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    while (!done())
+    {
+        main.poll(std::chrono::milliseconds(10));
+        assert(std::chrono::steady_clock::now() < timeout);
+    }
+}
+
+std::shared_ptr<IOData> all_clients(const std::string& data)
+{
+    auto io_data = std::make_shared<IOData>();
+    io_data->mutable_tcp_dest()->set_all_clients(true);
+    io_data->set_data(data);
+    return io_data;
+}
+
+void test_cobs_fanout(goby::middleware::InterThreadTransporter& main)
+{
+    int connected = 0;
+    main.subscribe<cobs_in, TCPServerEvent>([&](const TCPServerEvent& event) {
+        if (event.event() == TCPServerEvent::EVENT_CONNECT)
+            ++connected;
+    });
+
+    std::vector<std::vector<std::string>> received(cobs_clients);
+    std::vector<std::thread> clients;
+    for (int c = 0; c < cobs_clients; ++c)
+    {
+        clients.emplace_back([c, &received]() {
+            boost::asio::io_context io;
+            tcp::socket socket(io);
+            connect(socket, cobs_port);
+            boost::asio::streambuf buffer;
+            while (received[c].size() < cobs_messages)
+            {
+                auto n = boost::asio::read_until(socket, buffer, '\0');
+                std::string encoded(boost::asio::buffers_begin(buffer.data()),
+                                    boost::asio::buffers_begin(buffer.data()) + n);
+                buffer.consume(n);
+                std::string decoded(n, '\0');
+                auto decoded_size =
+                    cobs_decode(reinterpret_cast<const uint8_t*>(encoded.data()), n,
+                                reinterpret_cast<uint8_t*>(&decoded[0]));
+                assert(decoded_size > 0);
+                decoded.resize(decoded_size - 1);
+                received[c].push_back(decoded);
+            }
+        });
+    }
+
+    poll_until(main, [&]() { return connected == cobs_clients; });
+
+    for (int i = 0; i < cobs_messages; ++i)
+    {
+        // include zeros, which COBS must remove
+        main.publish<cobs_out>(all_clients(std::string("msg\0", 4) + std::to_string(i)));
+    }
+
+    for (auto& client : clients) client.join();
+    for (const auto& r : received)
+    {
+        assert(r.size() == cobs_messages);
+        for (int i = 0; i < cobs_messages; ++i)
+            assert(r[i] == std::string("msg\0", 4) + std::to_string(i));
+    }
+    std::cout << "COBS: " << cobs_clients << " clients received all messages" << std::endl;
+}
+
+void test_slow_client(goby::middleware::InterThreadTransporter& main)
+{
+    unsigned slow_port = 0;
+    int connected = 0;
+    bool slow_disconnected = false;
+    main.subscribe<line_in, TCPServerEvent>([&](const TCPServerEvent& event) {
+        if (event.event() == TCPServerEvent::EVENT_CONNECT)
+        {
+            ++connected;
+        }
+        else if (event.event() == TCPServerEvent::EVENT_DISCONNECT &&
+                 event.remote_endpoint().port() == slow_port)
+        {
+            slow_disconnected = true;
+            // while the fast client was still connected
+            assert(event.number_of_clients() == 1);
+        }
+    });
+
+    boost::asio::io_context io;
+    // never reads
+    tcp::socket slow_socket(io);
+    connect(slow_socket, line_port);
+    slow_port = slow_socket.local_endpoint().port();
+
+    std::atomic<int> lines_received{0};
+    std::thread fast_client([&]() {
+        boost::asio::io_context io;
+        tcp::socket socket(io);
+        connect(socket, line_port);
+        boost::asio::streambuf buffer;
+        while (lines_received < line_messages)
+        {
+            auto n = boost::asio::read_until(socket, buffer, '\n');
+            std::string line(boost::asio::buffers_begin(buffer.data()),
+                             boost::asio::buffers_begin(buffer.data()) + n);
+            buffer.consume(n);
+            assert(line.size() == line_size);
+            assert(line.compare(0, std::to_string(lines_received).size() + 1,
+                                std::to_string(lines_received) + ":") == 0);
+            ++lines_received;
+        }
+    });
+
+    poll_until(main, [&]() { return connected == 2; });
+
+    for (int i = 0; i < line_messages; ++i)
+    {
+        std::string line = std::to_string(i) + ":";
+        line += std::string(line_size - line.size() - 1, 'x') + "\n";
+        main.publish<line_out>(all_clients(line));
+
+        // keep the fast client's backlog well under max_backlog: lines are only removed from
+        // the backlog once the whole gathered write they are part of has completed, so up to
+        // twice the lines outstanding here may be queued
+        while (i - lines_received > max_backlog / line_size / 4)
+            main.poll(std::chrono::milliseconds(1));
+    }
+
+    fast_client.join();
+    poll_until(main, [&]() { return slow_disconnected; });
+    assert(lines_received == line_messages);
+    std::cout << "Line based: slow client disconnected, fast client received all "
+              << line_messages << " lines" << std::endl;
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::WARN, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    goby::middleware::InterThreadTransporter main;
+
+    std::vector<std::thread> threads;
+    threads.push_back(launch<COBSServer>(cobs_port));
+    threads.push_back(launch<LineServer>(line_port));
+
+    test_cobs_fanout(main);
+    test_slow_client(main);
+
+    alive = false;
+    goby::middleware::ThreadIdentifier all;
+    all.all_threads = true;
+    main.publish<goby::middleware::SimpleThread<
+        goby::middleware::protobuf::TCPServerConfig>::shutdown_group_>(all);
+    for (auto& thread : threads) thread.join();
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
@@ -0,0 +1,280 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "goby/middleware/marshalling/dccl.h"
+#include "goby/middleware/marshalling/interface.h"
+
+// interprocess type whose serializer counts its calls
+struct CountedSample
+{
+    int a;
+};
+
+int serialize_calls = 0;
+
+namespace goby
+{
+namespace middleware
+{
+constexpr int COUNTED_SCHEME = 1001;
+
+template <> struct SerializerParserHelper<CountedSample, COUNTED_SCHEME>
+{
+    static std::vector<char> serialize(const CountedSample& msg)
+    {
+        ++serialize_calls;
+        return std::vector<char>(1, static_cast<char>(msg.a));
+    }
+
+    static std::string type_name() { return "CountedSample"; }
+
+    static std::string type_name(const CountedSample& /*d*/) { return type_name(); }
+
+    static CountedSample parse(const std::vector<char>& bytes)
+    {
+        return CountedSample{bytes.empty() ? 0 : bytes.front()};
+    }
+};
+
+template <typename T>
+constexpr int
+scheme(typename std::enable_if<std::is_same<T, CountedSample>::value>::type* = nullptr)
+{
+    return COUNTED_SCHEME;
+}
+} // namespace middleware
+} // namespace goby
+
+#include "goby/middleware/transport/interprocess.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/middleware/transport/intervehicle.h"
+#include "goby/middleware/transport/metrics.h"
+#include "goby/middleware/transport/rate_limit.h"
+#include "goby/test/middleware/publication_rate_limit/test.pb.h"
+#include "goby/util/debug_logger.h"
+
+// tests TransporterConfig::rate_limit (decimation and max_frequency) on the interthread layer,
+// and that the interprocess and intervehicle layers drop publications before serializing them
+
+using goby::middleware::protobuf::LAYER_INTERPROCESS;
+using goby::middleware::protobuf::LAYER_INTERTHREAD;
+using goby::middleware::protobuf::LAYER_INTERVEHICLE;
+
+constexpr goby::middleware::Group sample{"Sample"};
+constexpr goby::middleware::Group other{"Other"};
+constexpr goby::middleware::Group ip_sample{"IPSample"};
+constexpr goby::middleware::Group iv_sample{"IVSample", goby::middleware::Group::broadcast_group};
+
+struct Sample
+{
+    int a;
+};
+
+goby::middleware::protobuf::TransporterConfig
+rate_limit_cfg(goby::middleware::protobuf::Layer layer, int decimation, double max_frequency)
+{
+    goby::middleware::protobuf::TransporterConfig cfg;
+    // deliver to our own subscription
+    cfg.set_echo(true);
+    auto& limit = *cfg.add_rate_limit();
+    limit.set_layer(layer);
+    limit.set_decimation(decimation);
+    limit.set_max_frequency(max_frequency);
+    return cfg;
+}
+
+void test_limiter()
+{
+    goby::middleware::PublicationRateLimiter limiter(LAYER_INTERTHREAD);
+    auto type_name = []() { return std::string("Sample"); };
+
+    // no limits
+    goby::middleware::protobuf::TransporterConfig no_limit;
+    for (int i = 0; i < 10; ++i) assert(limiter.allow<Sample>(sample, 0, no_limit, type_name));
+
+    // limits for another layer are ignored
+    auto interprocess_cfg = rate_limit_cfg(LAYER_INTERPROCESS, 5, 0);
+    for (int i = 0; i < 10; ++i)
+        assert(limiter.allow<Sample>(sample, 0, interprocess_cfg, type_name));
+    assert(limiter.suppressed() == 0);
+
+    // decimation: first of every 4 passes, independently for each group and scheme
+    auto decimate_cfg = rate_limit_cfg(LAYER_INTERTHREAD, 4, 0);
+    std::vector<bool> expected{true, false, false, false, true, false, false, false, true};
+    for (bool e : expected)
+    {
+        assert(limiter.allow<Sample>(sample, 0, decimate_cfg, type_name) == e);
+        assert(limiter.allow<Sample>(other, 0, decimate_cfg, type_name) == e);
+        assert(limiter.allow<Sample>(sample, 1, decimate_cfg, type_name) == e);
+    }
+    assert(limiter.suppressed() == 3 * 6);
+
+    // max_frequency
+    auto frequency_cfg = rate_limit_cfg(LAYER_INTERTHREAD, 1, 10);
+    goby::middleware::PublicationRateLimiter frequency_limiter(LAYER_INTERTHREAD);
+    assert(frequency_limiter.allow<Sample>(sample, 0, frequency_cfg, type_name));
+    for (int i = 0; i < 10; ++i)
+        assert(!frequency_limiter.allow<Sample>(sample, 0, frequency_cfg, type_name));
+    std::this_thread::sleep_for(std::chrono::milliseconds(120));
+    assert(frequency_limiter.allow<Sample>(sample, 0, frequency_cfg, type_name));
+    assert(!frequency_limiter.allow<Sample>(sample, 0, frequency_cfg, type_name));
+    assert(frequency_limiter.suppressed() == 11);
+
+    // several limits for the same layer: the most restrictive of each applies
+    auto combined_cfg = rate_limit_cfg(LAYER_INTERTHREAD, 2, 100);
+    auto& slower = *combined_cfg.add_rate_limit();
+    slower.set_layer(LAYER_INTERTHREAD);
+    slower.set_max_frequency(10);
+    auto& decimate_more = *combined_cfg.add_rate_limit();
+    decimate_more.set_layer(LAYER_INTERTHREAD);
+    decimate_more.set_decimation(3);
+    auto& other_layer = *combined_cfg.add_rate_limit();
+    other_layer.set_layer(LAYER_INTERPROCESS);
+    other_layer.set_decimation(5);
+
+    goby::middleware::PublicationRateLimiter combined_limiter(LAYER_INTERTHREAD);
+    assert(combined_limiter.allow<Sample>(sample, 0, combined_cfg, type_name));
+    // the 4th passes decimation, but is within 1/10 s of the 1st
+    for (int i = 0; i < 5; ++i)
+        assert(!combined_limiter.allow<Sample>(sample, 0, combined_cfg, type_name));
+    std::this_thread::sleep_for(std::chrono::milliseconds(120));
+    // decimation by 3, not 2 (or 5)
+    assert(combined_limiter.allow<Sample>(sample, 0, combined_cfg, type_name));
+    std::this_thread::sleep_for(std::chrono::milliseconds(120));
+    assert(!combined_limiter.allow<Sample>(sample, 0, combined_cfg, type_name));
+    assert(!combined_limiter.allow<Sample>(sample, 0, combined_cfg, type_name));
+    assert(combined_limiter.allow<Sample>(sample, 0, combined_cfg, type_name));
+    assert(combined_limiter.suppressed() == 7);
+}
+
+void test_interthread()
+{
+    goby::middleware::InterThreadTransporter interthread;
+    std::vector<int> received;
+    interthread.subscribe<sample, Sample>([&](const Sample& s) { received.push_back(s.a); });
+
+    goby::middleware::Publisher<Sample> decimate(rate_limit_cfg(LAYER_INTERTHREAD, 3, 0));
+    for (int i = 0; i < 10; ++i) interthread.publish<sample>(Sample{i}, decimate);
+    while (interthread.poll(std::chrono::milliseconds(10)) > 0) {}
+    assert((received == std::vector<int>{0, 3, 6, 9}));
+
+    // shared pointer variant shares the same state
+    received.clear();
+    for (int i = 10; i < 13; ++i)
+        interthread.publish<sample>(std::make_shared<const Sample>(Sample{i}), decimate);
+    while (interthread.poll(std::chrono::milliseconds(10)) > 0) {}
+    assert((received == std::vector<int>{12}));
+
+    // limits for another layer do not affect interthread
+    received.clear();
+    goby::middleware::Publisher<Sample> interprocess_only(rate_limit_cfg(LAYER_INTERPROCESS, 3, 1));
+    for (int i = 0; i < 5; ++i) interthread.publish<sample>(Sample{i}, interprocess_only);
+    while (interthread.poll(std::chrono::milliseconds(10)) > 0) {}
+    assert(received.size() == 5);
+}
+
+void test_interprocess()
+{
+    goby::middleware::InterThreadTransporter interthread;
+    goby::middleware::InterProcessForwarder<goby::middleware::InterThreadTransporter> interprocess(
+        interthread);
+
+    std::vector<int> received;
+    interthread.subscribe<ip_sample, CountedSample>(
+        [&](const CountedSample& s) { received.push_back(s.a); });
+
+    goby::middleware::Publisher<CountedSample> decimate(rate_limit_cfg(LAYER_INTERPROCESS, 3, 0));
+    for (int i = 0; i < 10; ++i) interprocess.publish<ip_sample>(CountedSample{i}, decimate);
+    for (int i = 10; i < 13; ++i)
+        interprocess.publish<ip_sample>(std::make_shared<const CountedSample>(CountedSample{i}),
+                                        decimate);
+    while (interthread.poll(std::chrono::milliseconds(10)) > 0) {}
+
+    // suppressed publications are never serialized ...
+    assert(serialize_calls == 5);
+    assert(interprocess.rate_limit_suppressed() == 8);
+    // ... but are still delivered on the inner layer
+    assert(received.size() == 13);
+    assert(interthread.rate_limit_suppressed() == 0);
+}
+
+void test_intervehicle()
+{
+    using goby::test::middleware::protobuf::RateLimitSample;
+
+    goby::middleware::InterThreadTransporter interthread;
+    goby::middleware::InterVehicleForwarder<goby::middleware::InterThreadTransporter> intervehicle(
+        interthread);
+
+    goby::middleware::Publisher<RateLimitSample> decimate(
+        rate_limit_cfg(LAYER_INTERVEHICLE, 4, 0));
+    for (int i = 0; i < 10; ++i)
+    {
+        RateLimitSample s;
+        s.set_a(i);
+        intervehicle.publish<iv_sample>(s, decimate);
+    }
+    while (interthread.poll(std::chrono::milliseconds(10)) > 0) {}
+
+    assert(intervehicle.rate_limit_suppressed() == 7);
+}
+
+int main(int argc, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::DEBUG3, &std::cerr);
+    goby::glog.set_name(argv[0]);
+
+    test_limiter();
+
+    goby::middleware::TransportMetrics::set_enabled(true);
+    test_interthread();
+    test_interprocess();
+    test_intervehicle();
+    auto metrics = goby::middleware::TransportMetrics::summary();
+    std::cout << metrics.DebugString() << std::endl;
+    bool found = false;
+    for (const auto& topic : metrics.topic())
+    {
+        if (topic.layer() == LAYER_INTERTHREAD && topic.group() == "Sample")
+        {
+            found = true;
+            assert(topic.type() == "Sample");
+            assert(topic.suppressed() == 6 + 2);
+            assert(topic.published_count() == 4 + 1 + 5);
+        }
+        else if (topic.layer() == LAYER_INTERVEHICLE && topic.group() == "IVSample")
+        {
+            // serialization (and the published count) only happens for publications that pass
+            assert(topic.published_count() == 3);
+            assert(topic.suppressed() == 7);
+        }
+    }
+    assert(found);
+
+    std::cout << "all tests passed" << std::endl;
+}
@@ -0,0 +1,162 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests goby::middleware thread CPU affinity, scheduling policy and nice level configuration
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+
+#include "goby/middleware/application/scheduling.h"
+#include "goby/middleware/application/thread.h"
+#include "goby/middleware/transport/interthread.h"
+
+using goby::middleware::apply_thread_scheduling;
+using goby::middleware::thread_scheduling;
+using goby::middleware::protobuf::AppConfig;
+using goby::middleware::protobuf::ThreadHealth;
+using goby::middleware::protobuf::ThreadScheduling;
+
+class TestThread
+    : public goby::middleware::Thread<int, goby::middleware::InterThreadTransporter>
+{
+  public:
+    TestThread()
+        : goby::middleware::Thread<int, goby::middleware::InterThreadTransporter>(
+              0, &interthread_, 100.0)
+    {
+    }
+
+    ThreadHealth health_report;
+
+  private:
+    void loop() override
+    {
+        this->thread_health(health_report);
+        this->thread_quit();
+    }
+
+    goby::middleware::InterThreadTransporter interthread_;
+};
+
+void test_merge()
+{
+    AppConfig::Scheduling cfg;
+    cfg.mutable_default_thread()->add_cpu(0);
+    cfg.mutable_default_thread()->add_cpu(1);
+    cfg.mutable_default_thread()->set_nice(5);
+
+    auto& thread = *cfg.add_thread();
+    thread.set_name("Control");
+    thread.mutable_scheduling()->add_cpu(3);
+    thread.mutable_scheduling()->set_policy(ThreadScheduling::FIFO);
+    thread.mutable_scheduling()->set_priority(50);
+
+    auto other = thread_scheduling(cfg, "Other");
+    assert(other.SerializeAsString() == cfg.default_thread().SerializeAsString());
+
+    auto control = thread_scheduling(cfg, "Control");
+    assert(control.cpu_size() == 1 && control.cpu(0) == 3);
+    assert(control.policy() == ThreadScheduling::FIFO);
+    assert(control.priority() == 50);
+    assert(control.nice() == 5);
+
+    assert(thread_scheduling(AppConfig::Scheduling(), "Control").ByteSizeLong() == 0);
+}
+
+void test_apply()
+{
+    int main_nice = getpriority(PRIO_PROCESS, 0);
+    cpu_set_t all_cpus;
+    pthread_getaffinity_np(pthread_self(), sizeof(all_cpus), &all_cpus);
+    int first_cpu = 0;
+    while (!CPU_ISSET(first_cpu, &all_cpus)) ++first_cpu;
+
+    std::thread t([&]() {
+        // raising the nice level and restricting affinity need no privileges
+        ThreadScheduling cfg;
+        cfg.add_cpu(first_cpu);
+        cfg.set_nice(std::min(main_nice + 5, 19));
+        auto applied = apply_thread_scheduling(cfg);
+
+        assert(applied.cpu_size() == 1 && applied.cpu(0) == first_cpu);
+        assert(applied.nice() == cfg.nice());
+        assert(!applied.has_policy());
+        assert(getpriority(PRIO_PROCESS, goby::middleware::gettid()) == cfg.nice());
+
+        // may fail without CAP_SYS_NICE: what's reported must match the actual policy
+        ThreadScheduling rt_cfg;
+        rt_cfg.set_policy(ThreadScheduling::RR);
+        auto rt_applied = apply_thread_scheduling(rt_cfg);
+        int policy;
+        sched_param param;
+        pthread_getschedparam(pthread_self(), &policy, &param);
+        assert(rt_applied.has_policy());
+        assert((rt_applied.policy() == ThreadScheduling::RR) == (policy == SCHED_RR));
+        if (policy == SCHED_RR)
+            assert(rt_applied.priority() == sched_get_priority_min(SCHED_RR));
+        std::cout << "RR scheduling: " << (policy == SCHED_RR ? "applied" : "not permitted")
+                  << std::endl;
+    });
+    t.join();
+
+    // other threads are unaffected
+    assert(getpriority(PRIO_PROCESS, 0) == main_nice);
+}
+
+void test_thread_health()
+{
+    TestThread thread;
+    ThreadScheduling cfg;
+    cfg.set_nice(19);
+    thread.set_scheduling(cfg);
+
+    std::atomic<bool> alive{true};
+    std::thread t([&]() { thread.run(alive); });
+    t.join();
+
+    assert(thread.health_report.has_scheduling());
+    assert(thread.health_report.scheduling().nice() == 19);
+
+    // nothing configured, nothing reported
+    TestThread default_thread;
+    std::atomic<bool> default_alive{true};
+    std::thread t2([&]() { default_thread.run(default_alive); });
+    t2.join();
+    assert(!default_thread.health_report.has_scheduling());
+}
+
+int main()
+{
+    test_merge();
+    test_apply();
+    test_thread_health();
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
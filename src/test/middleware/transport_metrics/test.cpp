@@ -0,0 +1,139 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+
+#include "goby/middleware/transport/interthread.h"
+#include "goby/middleware/transport/metrics.h"
+#include "goby/util/debug_logger.h"
+
+// tests TransportMetrics counters, and the interthread hooks
+
+using goby::middleware::TransportMetrics;
+using goby::middleware::protobuf::LAYER_INTERPROCESS;
+using goby::middleware::protobuf::LAYER_INTERTHREAD;
+
+constexpr goby::middleware::Group sample{"Sample"};
+
+struct Sample
+{
+    int a;
+};
+
+const int max_publish = 50;
+std::atomic<bool> subscriber_ready(false);
+
+void subscriber()
+{
+    goby::middleware::InterThreadTransporter interthread;
+    int received = 0;
+    interthread.subscribe<sample, Sample>([&](std::shared_ptr<const Sample> s) { ++received; });
+    subscriber_ready = true;
+    while (received < max_publish) interthread.poll(std::chrono::milliseconds(100));
+}
+
+const goby::middleware::protobuf::TransportMetrics::Topic&
+find_topic(const goby::middleware::protobuf::TransportMetrics& metrics,
+           goby::middleware::protobuf::Layer layer, const std::string& group)
+{
+    for (const auto& topic : metrics.topic())
+    {
+        if (topic.layer() == layer && topic.group() == group)
+            return topic;
+    }
+    std::cerr << "No topic for group: " << group << std::endl;
+    assert(false);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::DEBUG3, &std::cerr);
+    goby::glog.set_name(argv[0]);
+
+    // disabled: nothing is counted
+    assert(!TransportMetrics::enabled());
+    {
+        goby::middleware::InterThreadTransporter interthread;
+        interthread.publish<sample>(Sample{1});
+    }
+    TransportMetrics::set_enabled(true);
+    assert(TransportMetrics::summary().topic_size() == 0);
+
+    // direct counters
+    TransportMetrics::published(LAYER_INTERPROCESS, "g", "T", 10);
+    TransportMetrics::published(LAYER_INTERPROCESS, "g", "T", 5);
+    TransportMetrics::serialized(LAYER_INTERPROCESS, "g", "T", std::chrono::microseconds(7));
+    TransportMetrics::received(LAYER_INTERPROCESS, "g", "T", 3);
+    TransportMetrics::parsed(LAYER_INTERPROCESS, "g", "T", std::chrono::microseconds(2));
+    TransportMetrics::queued(LAYER_INTERPROCESS, "g", "T", 4);
+    TransportMetrics::queued(LAYER_INTERPROCESS, "g", "T", 2);
+    TransportMetrics::dropped(LAYER_INTERPROCESS, "g", "T", 3);
+    TransportMetrics::published(LAYER_INTERPROCESS, "g", "U");
+    TransportMetrics::latency(LAYER_INTERPROCESS, "g", "T", std::chrono::microseconds(100));
+    TransportMetrics::latency(LAYER_INTERPROCESS, "g", "T", std::chrono::microseconds(300));
+
+    auto metrics = TransportMetrics::summary();
+    std::cout << metrics.DebugString() << std::endl;
+    assert(metrics.topic_size() == 2);
+    assert(metrics.interval() >= 0);
+    const auto& t = find_topic(metrics, LAYER_INTERPROCESS, "g");
+    assert(t.type() == "T");
+    assert(t.published_count() == 2);
+    assert(t.published_bytes() == 15);
+    assert(t.serialize_time() == 7);
+    assert(t.received_count() == 1);
+    assert(t.received_bytes() == 3);
+    assert(t.parse_time() == 2);
+    assert(t.max_queue_depth() == 4);
+    assert(t.dropped() == 3);
+    assert(t.latency().count() == 2);
+    assert(t.latency().max() == 300);
+    assert(!metrics.topic(1).has_latency());
+
+    // summary() resets
+    assert(TransportMetrics::summary().topic_size() == 0);
+
+    // interthread
+    std::thread t1(subscriber);
+    while (!subscriber_ready) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        goby::middleware::InterThreadTransporter interthread;
+        for (int i = 0; i < max_publish; ++i) interthread.publish<sample>(Sample{i});
+    }
+    t1.join();
+
+    metrics = TransportMetrics::summary();
+    std::cout << metrics.DebugString() << std::endl;
+    const auto& it = find_topic(metrics, LAYER_INTERTHREAD, "Sample");
+    assert(it.type() == "Sample");
+    assert(it.published_count() == max_publish);
+    assert(it.received_count() == max_publish);
+    assert(it.max_queue_depth() >= 1);
+
+    TransportMetrics::set_enabled(false);
+    std::cout << "all tests passed" << std::endl;
+}
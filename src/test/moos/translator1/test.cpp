@@ -24,6 +24,9 @@
 
 #include <iostream>
 
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/dynamic_message.h>
+
 #include "goby/moos/moos_translator.h"
 #include "goby/test/acomms/dccl1/test.pb.h"
 #include "goby/test/moos/translator1/basic_node_report.pb.h"
@@ -37,6 +40,7 @@ using namespace goby::test::acomms::protobuf;
 
 void populate_test_msg(TestMsg* msg_in);
 void run_one_in_one_out_test(MOOSTranslator& translator, int i, bool hex_encode);
+void compiled_format_test(MOOSTranslator& translator);
 
 int main(int /*argc*/, char* argv[])
 {
@@ -462,6 +466,8 @@ int main(int /*argc*/, char* argv[])
     assert(embedded_test_out->SerializePartialAsString() ==
            embedded_test.SerializePartialAsString());
 
+    compiled_format_test(translator);
+
     std::cout << "all tests passed" << std::endl;
 
     dccl::DynamicProtobufManager::protobuf_shutdown();
@@ -547,6 +553,119 @@ void run_one_in_one_out_test(MOOSTranslator& translator, int i, bool hex_encode)
     assert(msg_out->SerializeAsString() == msg.SerializeAsString());
 }
 
+void compiled_format_test(MOOSTranslator& translator)
+{
+    using GoogleProtobufMessagePointer = std::unique_ptr<google::protobuf::Message>;
+    const std::string protobuf_name = "goby.test.moos.protobuf.BasicNodeReport";
+
+    auto set_entry = [&](const std::string& format) {
+        protobuf::TranslatorEntry entry;
+        entry.set_protobuf_name(protobuf_name);
+
+        protobuf::TranslatorEntry::CreateParser* parser = entry.add_create();
+        parser->set_technique(protobuf::TranslatorEntry::TECHNIQUE_FORMAT);
+        parser->set_moos_var("NODE_REPORT");
+        parser->set_format(format);
+
+        protobuf::TranslatorEntry::PublishSerializer* serializer = entry.add_publish();
+        serializer->set_technique(protobuf::TranslatorEntry::TECHNIQUE_FORMAT);
+        serializer->set_moos_var("NODE_REPORT");
+        serializer->set_format(format);
+
+        translator.clear_entry(entry.protobuf_name());
+        translator.add_entry(entry);
+    };
+
+    // the formats cached for the entry (compiled first if they are not)
+    auto publish_format = [&](const google::protobuf::Descriptor* desc)
+        -> const MOOSTranslator::CompiledFormat* {
+        const protobuf::TranslatorEntry& entry = translator.dictionary().at(protobuf_name);
+        return &translator.compiled_format(protobuf_name, MOOSTranslator::FormatUse::PUBLISH_FORMAT,
+                                           0, desc, entry.publish(0).algorithm(),
+                                           entry.publish(0).format());
+    };
+    auto parse_format = [&](const google::protobuf::Descriptor* desc)
+        -> const MOOSTranslator::CompiledParseFormat* {
+        const protobuf::TranslatorEntry& entry = translator.dictionary().at(protobuf_name);
+        return &translator.compiled_parse_format(protobuf_name, 0, desc, entry.create(0).format());
+    };
+
+    set_entry("NAME=%1%,X=%202%,Y=%3%,HEADING=%201%,REPEAT={%10%}");
+
+    BasicNodeReport report;
+    report.set_name("unicorn");
+    report.set_x(550);
+    report.set_y(1023.5);
+    report.set_heading(240);
+    report.add_repeat(1);
+    report.add_repeat(-1);
+
+    const std::string report_str = "NAME=unicorn,X=550,Y=1023.5,HEADING=240,REPEAT={1,-1}";
+
+    std::multimap<std::string, CMOOSMsg> moos_msgs = translator.protobuf_to_moos(report);
+    assert(moos_msgs.size() == 1 && moos_msgs.begin()->second.GetString() == report_str);
+    GoogleProtobufMessagePointer report_out =
+        translator.moos_to_protobuf<GoogleProtobufMessagePointer>(moos_msgs, protobuf_name);
+    assert(report_out->SerializeAsString() == report.SerializeAsString());
+
+    const MOOSTranslator::CompiledFormat* first_publish_format =
+        publish_format(BasicNodeReport::descriptor());
+    const MOOSTranslator::CompiledParseFormat* first_parse_format =
+        parse_format(BasicNodeReport::descriptor());
+
+    // translating again reuses the compiled formats, with the same result
+    moos_msgs = translator.protobuf_to_moos(report);
+    assert(moos_msgs.size() == 1 && moos_msgs.begin()->second.GetString() == report_str);
+    report_out =
+        translator.moos_to_protobuf<GoogleProtobufMessagePointer>(moos_msgs, protobuf_name);
+    assert(report_out->SerializeAsString() == report.SerializeAsString());
+
+    assert(publish_format(BasicNodeReport::descriptor()) == first_publish_format);
+    assert(parse_format(BasicNodeReport::descriptor()) == first_parse_format);
+
+    // a message of the same name but another Descriptor (e.g. loaded at runtime) recompiles them
+    google::protobuf::FileDescriptorProto file_proto;
+    BasicNodeReport::descriptor()->file()->CopyTo(&file_proto);
+    google::protobuf::DescriptorPool pool;
+    pool.BuildFile(file_proto);
+    const google::protobuf::Descriptor* dynamic_desc = pool.FindMessageTypeByName(protobuf_name);
+    assert(dynamic_desc && dynamic_desc != BasicNodeReport::descriptor());
+
+    google::protobuf::DynamicMessageFactory factory(&pool);
+    GoogleProtobufMessagePointer dynamic_report(factory.GetPrototype(dynamic_desc)->New());
+    dynamic_report->ParseFromString(report.SerializeAsString());
+
+    moos_msgs = translator.protobuf_to_moos(*dynamic_report);
+    assert(moos_msgs.size() == 1 && moos_msgs.begin()->second.GetString() == report_str);
+    assert(publish_format(dynamic_desc)->descriptor() == dynamic_desc);
+    assert(parse_format(dynamic_desc)->descriptor() == dynamic_desc);
+
+    // and back again for the compiled-in message
+    moos_msgs = translator.protobuf_to_moos(report);
+    assert(moos_msgs.size() == 1 && moos_msgs.begin()->second.GetString() == report_str);
+    report_out =
+        translator.moos_to_protobuf<GoogleProtobufMessagePointer>(moos_msgs, protobuf_name);
+    assert(report_out->SerializeAsString() == report.SerializeAsString());
+    assert(publish_format(BasicNodeReport::descriptor())->descriptor() ==
+           BasicNodeReport::descriptor());
+    assert(parse_format(BasicNodeReport::descriptor())->descriptor() ==
+           BasicNodeReport::descriptor());
+
+    // replacing the entry drops the formats compiled for the old one
+    set_entry("X=%202%;Y=%3%");
+
+    moos_msgs = translator.protobuf_to_moos(report);
+    goby::glog << "Value: " << moos_msgs.begin()->second.GetString() << std::endl;
+    assert(moos_msgs.size() == 1 && moos_msgs.begin()->second.GetString() == "X=550;Y=1023.5");
+
+    report_out =
+        translator.moos_to_protobuf<GoogleProtobufMessagePointer>(moos_msgs, protobuf_name);
+    BasicNodeReport expected_report;
+    expected_report.set_x(550);
+    expected_report.set_y(1023.5);
+    assert(report_out->SerializeAsString() == expected_report.SerializeAsString());
+}
+
 void populate_test_msg(TestMsg* msg_in)
 {
     int i = 0;
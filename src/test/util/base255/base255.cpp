@@ -22,6 +22,7 @@
 // You should have received a copy of the GNU General Public License
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
+#include "goby/exception.h"
 #include "goby/util/base_convert.h"
 #include "goby/util/binary.h"
 
@@ -72,6 +73,38 @@ void test(const std::string& in, bool output = true, int other_base = 255)
     assert(in == in2);
 }
 
+void block_test(const std::string& in, int other_base = 251)
+{
+    std::string out;
+    goby::util::block_base_encode(in, &out, other_base);
+
+    for (char c : out) assert((c & 0xFF) < other_base);
+
+    std::string in2;
+    goby::util::block_base_decode(out, &in2, other_base);
+
+    std::cout << "Block encoded string is " << (int)out.size() - (int)in.size()
+              << " bytes larger than original string (" << in.size() << " bytes)" << std::endl;
+
+    // bounded expansion per 64 byte block
+    const int max_block_digits = goby::util::block_base_encoded_size(64, other_base);
+    assert(out.size() <= (in.size() / 64 + 1) * max_block_digits);
+    assert(in == in2);
+}
+
+void rudics_test(const std::string& in, goby::acomms::RudicsPacketVersion version)
+{
+    std::string rudics, out;
+    goby::acomms::serialize_rudics_packet(in, &rudics, goby::acomms::rudics_default_reserved(),
+                                          true, version);
+
+    goby::acomms::RudicsPacketVersion parsed_version;
+    goby::acomms::parse_rudics_packet(&out, rudics, goby::acomms::rudics_default_reserved(), true,
+                                      &parsed_version);
+    assert(in == out);
+    assert(parsed_version == version);
+}
+
 std::string randstring(int size)
 {
     std::string test(size, 0);
@@ -130,6 +163,42 @@ int main()
     std::cout << "fixed: ";
     intprint(out);
 
+    assert(goby::util::block_base_encoded_size(0, 251) == 0);
+    assert(goby::util::block_base_encoded_size(1, 16) == 2);
+    assert(goby::util::block_base_encoded_size(8, 251) == 9);
+    assert(goby::util::block_base_encoded_size(64, 251) == 65);
+
+    block_test("");
+    block_test("TOMcat");
+    block_test(std::string(4, 0xff));
+    block_test(std::string(64, 0xff));
+    block_test(std::string(200, 0));
+    block_test(randstring(1500));
+    block_test(randstring(15000), 252);
+    block_test(randstring(1000), 3);
+
+    for (int size : {0, 1, 20, 63, 64, 65, 1500})
+    {
+        // use enough random packets that some version 1 packets start with the version 2 marker
+        for (int i = 0; i < 100; ++i)
+        {
+            std::string in = randstring(size);
+            rudics_test(in, goby::acomms::RUDICS_PACKET_V1);
+            rudics_test(in, goby::acomms::RUDICS_PACKET_V2);
+        }
+    }
+
+    try
+    {
+        std::string bad;
+        goby::util::block_base_decode(std::string(1, 0), &bad, 251);
+        assert(false);
+    }
+    catch (goby::Exception& e)
+    {
+        std::cout << "Correctly rejected invalid block encoding: " << e.what() << std::endl;
+    }
+
     std::cout << "all tests passed" << std::endl;
 
     return 0;
@@ -0,0 +1,270 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests the asynchronous glog backend (per-thread buffers written by a single writer thread)
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "goby/exception.h"
+#include "goby/util/debug_logger.h"
+
+using goby::glog;
+using namespace goby::util::logger;
+using AsyncConfig = goby::util::protobuf::GLogConfig::Async;
+
+struct A
+{
+    int i{0};
+};
+
+std::ostream& operator<<(std::ostream& out, const A& a) { return out << "A(" << a.i << ")"; }
+
+// returns the text following the header ("[ time ] {group}: ") for each line of the log
+std::vector<std::string> messages(const std::stringstream& ss)
+{
+    std::vector<std::string> result;
+    std::stringstream in(ss.str());
+    std::string line;
+    while (std::getline(in, line))
+    {
+        auto pos = line.find("}: ");
+        if (pos == std::string::npos)
+            pos = line.find("]: ");
+        assert(pos != std::string::npos);
+        result.push_back(line.substr(pos + 3));
+    }
+    return result;
+}
+
+void test_threads()
+{
+    std::stringstream ss;
+    glog.add_stream(DEBUG1, &ss);
+
+    AsyncConfig cfg;
+    cfg.set_overflow_policy(AsyncConfig::BLOCK);
+    cfg.set_buffer_size(16);
+    glog.enable_async(cfg);
+
+    const int num_threads = 4;
+    const int num_messages = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < num_messages; ++i)
+            {
+                // different formatting state per thread must not leak between threads
+                if (t % 2)
+                    glog.is_verbose() && glog << group("odd") << std::hex << A{t} << " " << i
+                                              << std::dec << std::endl;
+                else
+                    glog.is_debug1() && glog << group("even") << A{t} << " " << std::setw(6)
+                                             << std::setfill('0') << i << std::endl;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    glog.disable_async();
+
+    std::map<int, int> next;
+    for (const auto& message : messages(ss))
+    {
+        int t = message[message.find("A(") + 2] - '0';
+        std::stringstream expected;
+        if (t % 2)
+            expected << "A(" << t << ") " << std::hex << next[t]++;
+        else
+            expected << "D: A(" << t << ") " << std::setw(6) << std::setfill('0') << next[t]++;
+        assert(message == expected.str());
+    }
+    for (int t = 0; t < num_threads; ++t) assert(next[t] == num_messages);
+    assert(glog.async_dropped() == 0);
+
+    assert(ss.str().find("{odd}") != std::string::npos);
+    assert(ss.str().find("{even}") != std::string::npos);
+
+    glog.add_stream(QUIET, &ss);
+    std::cout << "threads ok" << std::endl;
+}
+
+void test_drop()
+{
+    std::stringstream ss;
+    glog.add_stream(VERBOSE, &ss);
+
+    AsyncConfig cfg;
+    cfg.set_overflow_policy(AsyncConfig::DROP);
+    cfg.set_buffer_size(4);
+    glog.enable_async(cfg);
+
+    const int num_messages = 100;
+    {
+        // the writer thread cannot write while this is held, so the buffer fills up
+        std::lock_guard<std::recursive_mutex> lock(glog.mutex());
+        for (int i = 0; i < num_messages; ++i)
+            glog.is_verbose() && glog << "message " << i << std::endl;
+    }
+    glog.disable_async();
+
+    auto dropped = glog.async_dropped();
+    assert(dropped > 0);
+
+    const std::string report = "(Warning): Asynchronous logger dropped ";
+    int written = 0;
+    std::uint64_t reported = 0;
+    for (const auto& message : messages(ss))
+    {
+        if (message.find("message ") == 0)
+            ++written;
+        else if (message.find(report) == 0)
+            reported += std::stoul(message.substr(report.size()));
+    }
+    assert(written + dropped == num_messages);
+    assert(reported == dropped);
+
+    glog.add_stream(QUIET, &ss);
+    std::cout << "drop ok (" << dropped << " dropped)" << std::endl;
+}
+
+void test_block()
+{
+    std::stringstream ss;
+    glog.add_stream(VERBOSE, &ss);
+
+    AsyncConfig cfg;
+    cfg.set_overflow_policy(AsyncConfig::BLOCK);
+    cfg.set_buffer_size(4);
+    glog.enable_async(cfg);
+
+    const int num_messages = 100;
+    std::atomic<bool> done{false};
+    std::thread writer;
+    {
+        std::lock_guard<std::recursive_mutex> lock(glog.mutex());
+        writer = std::thread([&]() {
+            for (int i = 0; i < num_messages; ++i)
+                glog.is_verbose() && glog << "message " << i << std::endl;
+            done = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        // blocked waiting for the writer thread
+        assert(!done);
+    }
+    writer.join();
+    glog.disable_async();
+
+    auto written = messages(ss);
+    assert(written.size() == num_messages);
+    for (int i = 0; i < num_messages; ++i) assert(written[i] == "message " + std::to_string(i));
+    assert(glog.async_dropped() == 0);
+
+    glog.add_stream(QUIET, &ss);
+    std::cout << "block ok" << std::endl;
+}
+
+// blocks the inserting thread (in the middle of a message) until released
+struct Pause
+{
+    std::atomic<bool>* paused;
+    std::atomic<bool>* release;
+};
+
+std::ostream& operator<<(std::ostream& out, const Pause& p)
+{
+    *p.paused = true;
+    while (!*p.release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return out;
+}
+
+void test_disable_during_message()
+{
+    std::stringstream ss;
+    glog.add_stream(VERBOSE, &ss);
+
+    glog.enable_async(AsyncConfig());
+
+    bool threw = false;
+    try
+    {
+        glog.enable_async(AsyncConfig());
+    }
+    catch (goby::Exception&)
+    {
+        threw = true;
+    }
+    assert(threw);
+
+    std::atomic<bool> paused{false}, release{false};
+    std::thread thread([&]() {
+        glog.is_verbose() && glog << "started async, " << Pause{&paused, &release}
+                                  << "completed after disable" << std::endl;
+        // the next message is synchronous
+        glog.is_verbose() && glog << "sync from thread" << std::endl;
+    });
+    while (!paused) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    glog.disable_async();
+    assert(!glog.buf().is_async());
+    glog.is_verbose() && glog << "sync from main" << std::endl;
+
+    release = true;
+    thread.join();
+
+    auto written = messages(ss);
+    assert(written.size() == 3);
+    assert(written[0] == "sync from main");
+    assert(written[1] == "started async, completed after disable");
+    assert(written[2] == "sync from thread");
+
+    glog.add_stream(QUIET, &ss);
+    std::cout << "disable during message ok" << std::endl;
+}
+
+int main()
+{
+    glog.set_name("test");
+    glog.set_lock_action(goby::util::logger_lock::lock);
+
+    test_threads();
+    test_drop();
+    test_block();
+    test_disable_during_message();
+
+    // back to synchronous logging
+    std::stringstream ss;
+    glog.add_stream(VERBOSE, &ss);
+    glog.is_verbose() && glog << "sync ok" << std::endl;
+    assert(messages(ss).at(0) == "sync ok");
+    glog.add_stream(QUIET, &ss);
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
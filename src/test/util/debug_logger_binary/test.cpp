@@ -0,0 +1,150 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// tests capturing goby::glog in the binary format and rendering it to text offline
+
+#include <cassert>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "goby/util/binary.h"
+#include "goby/util/debug_logger.h"
+#include "goby/util/debug_logger/binary_log.h"
+
+using goby::glog;
+using namespace goby::util::logger;
+using goby::util::protobuf::GLogBinaryRecord;
+using goby::util::protobuf::GLogConfig;
+
+std::string render(std::stringstream& binary, std::set<std::uint64_t>* threads = nullptr)
+{
+    std::stringstream in(binary.str());
+    BinaryLogReader reader(&in);
+    assert(reader.name() == "test");
+
+    std::stringstream text;
+    GLogBinaryRecord::Entry entry;
+    std::vector<Payload> payloads;
+    while (reader.read(&entry, &payloads))
+    {
+        BinaryLogReader::write_text(text, entry, payloads);
+        if (threads)
+            threads->insert(entry.thread());
+    }
+    return text.str();
+}
+
+void log_messages(const GLogConfig& cfg, int thread)
+{
+    const std::string bytes("\x01\x02\xfe\xff", 4);
+    for (int i = 0; i < 3; ++i)
+    {
+        glog.is_verbose() && glog << "plain text " << thread << ":" << i << std::endl;
+        glog.is_debug2() && glog << group("g1") << "cfg: " << debug_string(cfg) << " (" << i
+                                 << ")" << std::endl;
+        glog.is_debug3() && glog << group("g2") << goby::util::tcolor::red << "bytes "
+                                 << hex_string(bytes) << goby::util::tcolor::nocolor << " and "
+                                 << debug_string(cfg) << std::endl
+                                 << "second line " << i << std::endl;
+        glog.is_warn() && glog << "warning" << std::endl;
+    }
+}
+
+int main()
+{
+    glog.set_name("test");
+
+    GLogConfig cfg;
+    cfg.set_tty_verbosity(GLogConfig::DEBUG2);
+    cfg.mutable_file_log()->set_file_name("test_%1%.txt");
+
+    // outside of glog the manipulators format immediately
+    {
+        std::stringstream ss;
+        ss << debug_string(cfg) << " " << hex_string("\x01\xab");
+        assert(ss.str() == cfg.ShortDebugString() + " 01ab");
+    }
+
+    // the rendered binary log matches the text log
+    {
+        std::stringstream text, binary;
+        glog.add_stream(DEBUG3, &text);
+        glog.add_binary_stream(DEBUG3, &binary);
+
+        log_messages(cfg, 0);
+
+        glog.add_stream(QUIET, &text);
+        glog.add_binary_stream(QUIET, &binary);
+
+        assert(!text.str().empty());
+        assert(text.str().find(cfg.ShortDebugString()) != std::string::npos);
+        assert(text.str().find("bytes 0102feff and ") != std::string::npos);
+        assert(render(binary) == text.str());
+        std::cout << "render ok" << std::endl;
+    }
+
+    // binary log at a higher verbosity than the text log
+    {
+        std::stringstream text, binary;
+        glog.add_stream(VERBOSE, &text);
+        glog.add_binary_stream(DEBUG3, &binary);
+
+        log_messages(cfg, 0);
+
+        glog.add_stream(QUIET, &text);
+        glog.add_binary_stream(QUIET, &binary);
+
+        assert(text.str().find("cfg: ") == std::string::npos);
+        auto rendered = render(binary);
+        assert(rendered.find("cfg: " + cfg.ShortDebugString() + " (2)") != std::string::npos);
+        std::cout << "binary only ok" << std::endl;
+    }
+
+    // asynchronous mode, multiple threads
+    {
+        std::stringstream text, binary;
+        glog.add_stream(DEBUG3, &text);
+        glog.add_binary_stream(DEBUG3, &binary);
+        glog.enable_async();
+
+        std::thread t1([&]() { log_messages(cfg, 1); });
+        std::thread t2([&]() { log_messages(cfg, 2); });
+        t1.join();
+        t2.join();
+        glog.disable_async();
+
+        glog.add_stream(QUIET, &text);
+        glog.add_binary_stream(QUIET, &binary);
+
+        std::set<std::uint64_t> threads;
+        assert(render(binary, &threads) == text.str());
+        assert(threads.size() == 2);
+        std::cout << "async ok" << std::endl;
+    }
+
+    std::cout << "All tests passed." << std::endl;
+    return 0;
+}
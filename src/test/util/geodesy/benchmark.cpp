@@ -0,0 +1,58 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+// compares batch conversion against converting each point (not run by ctest):
+//   goby_benchmark_geodesy [num_points]
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "goby/util/geodesy.h"
+
+int main(int argc, char* argv[])
+{
+    using boost::units::degree::degrees;
+    using boost::units::si::meters;
+
+    const int num_points = argc > 1 ? std::stoi(argv[1]) : 100000;
+    goby::util::UTMGeodesy geodesy({41 * degrees, -70 * degrees});
+    std::vector<goby::util::UTMGeodesy::XYPoint> utm;
+    for (int i = 0; i < num_points; ++i)
+        utm.push_back({(i % 1000) * 1.0 * meters, (i / 1000) * 1.0 * meters});
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<goby::util::UTMGeodesy::LatLonPoint> single_geo;
+    single_geo.reserve(utm.size());
+    for (const auto& point : utm) single_geo.push_back(geodesy.convert(point));
+    auto single_end = std::chrono::steady_clock::now();
+    auto batch_geo = geodesy.convert(utm);
+    auto batch_end = std::chrono::steady_clock::now();
+
+    std::cout << "converted " << num_points << " points: single "
+              << std::chrono::duration<double>(single_end - start).count() << " s, batch "
+              << std::chrono::duration<double>(batch_end - single_end).count() << " s"
+              << std::endl;
+    return 0;
+}
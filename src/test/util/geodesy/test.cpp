@@ -22,9 +22,12 @@
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "goby/util/geodesy.h"
+#include <atomic>
 #include <cassert>
 #include <iomanip>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include <boost/units/io.hpp>
 
@@ -103,6 +106,52 @@ int main()
         assert(double_cmp(utm.y / meters, 100, 3));
     }
 
+    {
+        goby::util::UTMGeodesy geodesy({41 * degrees, -70 * degrees});
+
+        std::vector<goby::util::UTMGeodesy::XYPoint> utm;
+        for (int i = 0; i < 1000; ++i)
+            utm.push_back({(i - 500) * 10.0 * meters, (i % 37) * 100.0 * meters});
+
+        // batch conversion gives the same results as converting each point
+        auto geo = geodesy.convert(utm);
+        auto reconverted_utm = geodesy.convert(geo);
+        assert(geo.size() == utm.size() && reconverted_utm.size() == utm.size());
+        for (std::size_t i = 0, n = utm.size(); i < n; ++i)
+        {
+            auto single_geo = geodesy.convert(utm[i]);
+            assert(double_cmp(geo[i].lat / degrees, single_geo.lat / degrees, 9));
+            assert(double_cmp(geo[i].lon / degrees, single_geo.lon / degrees, 9));
+            auto single_utm = geodesy.convert(geo[i]);
+            assert(double_cmp(reconverted_utm[i].x / meters, single_utm.x / meters, 6));
+            assert(double_cmp(reconverted_utm[i].y / meters, single_utm.y / meters, 6));
+            assert(double_cmp(reconverted_utm[i].x / meters, utm[i].x / meters, 3));
+            assert(double_cmp(reconverted_utm[i].y / meters, utm[i].y / meters, 3));
+        }
+        assert(geodesy.convert(std::vector<goby::util::UTMGeodesy::XYPoint>()).empty());
+
+        // concurrent batch conversions with the same geodesy from several threads
+        std::atomic<int> mismatches(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&]() {
+                for (int j = 0; j < 20; ++j)
+                {
+                    auto thread_geo = geodesy.convert(utm);
+                    for (std::size_t i = 0, n = utm.size(); i < n; ++i)
+                    {
+                        if (!double_cmp(thread_geo[i].lat / degrees, geo[i].lat / degrees, 9) ||
+                            !double_cmp(thread_geo[i].lon / degrees, geo[i].lon / degrees, 9))
+                            ++mismatches;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        assert(mismatches == 0);
+    }
+
     std::cout << "all tests passed" << std::endl;
     return 0;
 }
@@ -189,3 +189,117 @@ BOOST_AUTO_TEST_CASE(gps_rte3)
     BOOST_CHECK_EQUAL(rte, rte2);
     std::cout << rte2.serialize().message() << std::endl;
 }
+
+BOOST_AUTO_TEST_CASE(view_matches_sentence)
+{
+    goby::util::NMEASentenceView view;
+    for (const char* orig :
+         {"$GPRMC,225446,A,4916.45,N,12311.12,W,000.5,054.7,191194,020.3,E*68",
+          "$YXXDR,A,0.3,D,PTCH,A,13.3,D,ROLL*6f ", "!AIVDO,1,1,,,B0000003wk?8mP=18D3Q3wwUkP06,0*7B",
+          "  $ECWPL,4135.868,N,07043.697,W,*45\r\n", "$CCTXD,2,1,1", "$FOOBA,,,"})
+    {
+        // reuse the same view for all sentences
+        view.parse(orig);
+        goby::util::NMEASentence nmea(orig);
+
+        BOOST_REQUIRE_EQUAL(view.size(), nmea.size());
+        for (std::size_t i = 0, n = nmea.size(); i < n; ++i)
+            BOOST_CHECK_EQUAL(view.at(i), nmea.at(i));
+        BOOST_CHECK_EQUAL(view.talker_id(), nmea.talker_id());
+        BOOST_CHECK_EQUAL(view.sentence_id(), nmea.sentence_id());
+        BOOST_CHECK_EQUAL(goby::util::NMEASentence(view).message(), nmea.message());
+    }
+    BOOST_CHECK_THROW(view.at(view.size()), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(view_errors)
+{
+    using goby::util::NMEASentence;
+    goby::util::NMEASentenceView view("$CCTXD,2,1,1*56");
+
+    BOOST_CHECK_THROW(view.parse("   "), goby::util::bad_nmea_sentence);
+    BOOST_CHECK(view.empty());
+    BOOST_CHECK_THROW(view.parse("CCTXD,2,1,1*56"), goby::util::bad_nmea_sentence);
+    BOOST_CHECK_THROW(view.parse("$CCTXD,2,1,1*57"), goby::util::bad_nmea_sentence);
+    BOOST_CHECK(view.empty());
+    BOOST_CHECK_THROW(view.parse("$CCTXD,2,1,1", NMEASentence::REQUIRE),
+                      goby::util::bad_nmea_sentence);
+    BOOST_CHECK_THROW(view.parse("$CCTX,2,1,1*1C"), goby::util::bad_nmea_sentence);
+
+    // a checksum that is not a hex number is no checksum
+    view.parse("$GPXXX,1*ZZ");
+    BOOST_CHECK_EQUAL(view.size(), 2);
+    BOOST_CHECK_THROW(view.parse("$GPXXX,1*ZZ", NMEASentence::REQUIRE),
+                      goby::util::bad_nmea_sentence);
+
+    // otherwise it is read as hex_string2number does ("$GPXXX,f" has checksum 05, "$GPXXX,c" 00)
+    for (const char* sentence :
+         {"$GPXXX,f*05", "$GPXXX,f*5", "$GPXXX,f* 5", "$GPXXX,f*+5", "$GPXXX,f*5Z", "$GPXXX,f*-5",
+          "$GPXXX,c*-0", "$GPXXX,f* 6", "$GPXXX,f*6Z", "$GPXXX,f*ZZ", "$GPXXX,f*0x", "$GPXXX,f*x5"})
+    {
+        for (auto cs_strat : {NMEASentence::IGNORE, NMEASentence::VALIDATE, NMEASentence::REQUIRE})
+        {
+            BOOST_TEST_CONTEXT("sentence: '" << sentence << "', strategy: " << cs_strat)
+            {
+                // checksum handling of NMEASentence before it used NMEASentenceView
+                std::string bare = sentence;
+                unsigned cs = 0;
+                bool found_csum = false;
+                if (bare.size() > 3 && bare.at(bare.size() - 3) == '*')
+                {
+                    found_csum = goby::util::hex_string2number(bare.substr(bare.size() - 2), cs);
+                    bare = bare.substr(0, bare.size() - 3);
+                }
+                bool valid = !(cs_strat == NMEASentence::REQUIRE && !found_csum) &&
+                             !(found_csum && cs_strat != NMEASentence::IGNORE &&
+                               NMEASentence::checksum(bare) != cs);
+
+                if (valid)
+                {
+                    view.parse(sentence, cs_strat);
+                    BOOST_CHECK_EQUAL(view.size(), 2);
+                    BOOST_CHECK_NO_THROW(NMEASentence nmea(sentence, cs_strat));
+                }
+                else
+                {
+                    BOOST_CHECK_THROW(view.parse(sentence, cs_strat),
+                                      goby::util::bad_nmea_sentence);
+                    BOOST_CHECK_THROW(NMEASentence nmea(sentence, cs_strat),
+                                      goby::util::bad_nmea_sentence);
+                }
+            }
+        }
+    }
+
+    view.parse("$CCTXD,2,1,1*57", NMEASentence::IGNORE);
+    BOOST_CHECK_EQUAL(view.size(), 4);
+    view.parse("$CCTXD,2,1,1*56", NMEASentence::REQUIRE);
+    BOOST_CHECK_EQUAL(view.size(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(view_as)
+{
+    std::string fields = "-12,+7,4916.45,,abc,1e3,2.5,-0.0,TRUE,1,0,99999999999,-2147483648,1.,x,"
+                         "0x10,-1,inf,1e999,A";
+    goby::util::NMEASentence nmea("$GPXXX," + fields);
+    goby::util::NMEASentenceView view("$GPXXX," + fields);
+
+    for (std::size_t i = 1, n = nmea.size(); i < n; ++i)
+    {
+        BOOST_TEST_CONTEXT("field: '" << nmea.at(i) << "'")
+        {
+            auto check_double = [](double a, double b) {
+                BOOST_CHECK((std::isnan(a) && std::isnan(b)) || a == b);
+            };
+            check_double(view.as<double>(i), nmea.as<double>(i));
+            check_double(view.as<float>(i), nmea.as<float>(i));
+            BOOST_CHECK_EQUAL(view.as<int>(i), nmea.as<int>(i));
+            BOOST_CHECK_EQUAL(view.as<long long>(i), nmea.as<long long>(i));
+            BOOST_CHECK_EQUAL(view.as<short>(i), nmea.as<short>(i));
+            BOOST_CHECK_EQUAL(view.as<bool>(i), nmea.as<bool>(i));
+            BOOST_CHECK_EQUAL(view.as<char>(i), nmea.as<char>(i));
+            BOOST_CHECK_EQUAL(view.as<std::string>(i), nmea.as<std::string>(i));
+            BOOST_CHECK_EQUAL(view.as<unsigned>(i), nmea.as<unsigned>(i));
+        }
+    }
+}
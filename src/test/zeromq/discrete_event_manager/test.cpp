@@ -0,0 +1,164 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include <zmq.hpp>
+
+#include "goby/middleware/marshalling/protobuf.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/time/discrete_event.h"
+#include "goby/time/system_clock.h"
+#include "goby/util/debug_logger.h"
+#include "goby/zeromq/transport/interprocess.h"
+
+// tests that the Manager (gobyd) advances the discrete event simulation time for a client
+// InterProcessPortal, waking it exactly at each of its poll() deadlines
+
+using goby::glog;
+using goby::time::SystemClock;
+using namespace goby::util::logger;
+using Clock = std::chrono::steady_clock;
+
+constexpr goby::middleware::Group stop_group{"stop"};
+
+constexpr int steps = 100;
+constexpr auto step = std::chrono::milliseconds(100);
+
+std::atomic<bool> observer_subscribed(false);
+std::atomic<bool> client_done(false);
+
+// written by the observer thread and read after it is joined
+int advance_count = 0;
+SystemClock::time_point last_advance;
+
+void wait_for(const std::atomic<bool>& flag, const std::string& what)
+{
+    auto timeout = Clock::now() + std::chrono::seconds(30);
+    while (!flag)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (Clock::now() > timeout)
+            glog.is(DIE) && glog << "Timed out waiting for " << what << std::endl;
+    }
+}
+
+// subscribes (through the client's portal) to the Manager's advances of the simulation time
+void observer()
+{
+    goby::middleware::InterThreadTransporter inproc;
+    goby::middleware::InterProcessForwarder<goby::middleware::InterThreadTransporter> ipc(inproc);
+    ipc.subscribe<goby::zeromq::groups::manager_response, goby::zeromq::protobuf::ManagerResponse>(
+        [](const goby::zeromq::protobuf::ManagerResponse& response) {
+            if (response.request() == goby::zeromq::protobuf::REPORT_DISCRETE_EVENT_STATE)
+            {
+                ++advance_count;
+                last_advance = SystemClock::time_point(
+                    std::chrono::microseconds(response.discrete_event_time()));
+            }
+        });
+
+    bool stop = false;
+    inproc.subscribe_empty<stop_group>([&stop]() { stop = true; });
+    observer_subscribed = true;
+
+    // participates without a deadline, so only the client's deadlines advance the time
+    while (!stop) ipc.poll();
+}
+
+void client(const goby::zeromq::protobuf::InterProcessPortalConfig& cfg)
+{
+    goby::middleware::InterThreadTransporter inproc;
+    goby::zeromq::InterProcessPortal<goby::middleware::InterThreadTransporter> zmq(inproc, cfg);
+
+    std::thread observer_thread(observer);
+    wait_for(observer_subscribed, "observer");
+    // let the forwarded subscription reach gobyd (in real time, as sleeping does not participate)
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    // time stands still until the hold is released and the Manager is advancing it
+    const auto start = SystemClock::now();
+    while (zmq.hold_state()) zmq.poll(std::chrono::milliseconds(10));
+
+    auto real_start = Clock::now();
+    for (int i = 1; i <= steps; ++i)
+    {
+        const auto deadline = start + i * step;
+        while (SystemClock::now() < deadline) zmq.poll(deadline);
+        // woken exactly at the deadline
+        assert(SystemClock::now() == deadline);
+    }
+    double real_elapsed = std::chrono::duration<double>(Clock::now() - real_start).count();
+    std::cout << steps << " steps of " << step.count() << " ms in " << real_elapsed << " s (real)"
+              << std::endl;
+    // CPU-light, so much faster than real time
+    assert(real_elapsed < std::chrono::duration<double>(steps * step).count());
+
+    inproc.publish_empty<stop_group>();
+    observer_thread.join();
+
+    std::cout << "observed " << advance_count << " advances by the Manager" << std::endl;
+    assert(advance_count >= steps);
+    assert(last_advance == start + steps * step);
+
+    client_done = true;
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::WARN, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    goby::time::SimulatorSettings::using_sim_time = true;
+    goby::time::SimulatorSettings::discrete_event = true;
+    goby::time::SimulatorSettings::discrete_event_settle_time = std::chrono::milliseconds(5);
+    assert(goby::time::DiscreteEventClock::enabled());
+
+    goby::zeromq::protobuf::InterProcessPortalConfig cfg;
+    cfg.set_platform("test_discrete_event_manager");
+    cfg.set_client_name("client");
+
+    auto manager_context = std::make_unique<zmq::context_t>(1);
+    auto router_context = std::make_unique<zmq::context_t>(1);
+    goby::zeromq::Router router(*router_context, cfg);
+    std::thread router_thread([&] { router.run(); });
+    goby::zeromq::Manager manager(*manager_context, cfg, router);
+    std::thread manager_thread([&] { manager.run(); });
+
+    std::thread client_thread([&] { client(cfg); });
+    wait_for(client_done, "client");
+    client_thread.join();
+
+    manager_context.reset();
+    router_context.reset();
+    router_thread.join();
+    manager_thread.join();
+
+    std::cout << "all tests passed" << std::endl;
+}
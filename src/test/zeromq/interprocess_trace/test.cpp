@@ -0,0 +1,161 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <zmq.hpp>
+
+#include "goby/middleware/marshalling/protobuf.h"
+#include "goby/middleware/protobuf/io.pb.h"
+#include "goby/middleware/transport/metrics.h"
+#include "goby/util/debug_logger.h"
+#include "goby/zeromq/transport/interprocess.h"
+
+// tests the trace added to sampled interprocess publications (InterProcessPortalConfig
+// trace_sample_rate), and the latency recorded from it by the receiving portal
+
+using goby::glog;
+using goby::middleware::protobuf::IOData;
+using namespace goby::util::logger;
+using Clock = std::chrono::steady_clock;
+
+constexpr goby::middleware::Group traced{"traced"};
+constexpr int messages = 10;
+
+std::atomic<bool> subscribed(false);
+std::atomic<int> received(0);
+
+void test_trace()
+{
+    using goby::zeromq::make_trace;
+    using goby::zeromq::parse_trace;
+    auto now = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point publish_time;
+
+    std::string frame = "/Sample1/PROTOBUF/goby.test.Sample/1234/1f/" + make_trace(now) +
+                        std::string(1, '\0') + "a/b\0/tc";
+    assert(parse_trace(frame, publish_time));
+    assert(std::chrono::duration_cast<std::chrono::nanoseconds>(publish_time - now).count() == 0);
+
+    // no trace
+    assert(!parse_trace("/Sample1/PROTOBUF/goby.test.Sample/1234/1f/" + std::string(1, '\0') +
+                            "/tab",
+                        publish_time));
+    assert(!parse_trace("/Sample1/PROTOBUF/goby.test.Sample/1234/1f/t", publish_time));
+    assert(!parse_trace("/Sample1/PROTOBUF/goby.test.Sample/1234/1f/tzz" + std::string(1, '\0'),
+                        publish_time));
+    std::cout << "trace format ok" << std::endl;
+}
+
+void subscriber(const goby::zeromq::protobuf::InterProcessPortalConfig& cfg)
+{
+    goby::zeromq::InterProcessPortal<> zmq(cfg);
+    zmq.subscribe<traced, IOData>([](const IOData& /*data*/) { ++received; });
+    subscribed = true;
+
+    auto timeout = Clock::now() + std::chrono::seconds(10);
+    while (received < messages)
+    {
+        zmq.poll(std::chrono::milliseconds(10));
+        if (Clock::now() > timeout)
+            glog.is(DIE) && glog << "Timed out waiting for the traced publications" << std::endl;
+    }
+}
+
+void publisher(goby::zeromq::protobuf::InterProcessPortalConfig cfg)
+{
+    // trace every publication
+    cfg.set_trace_sample_rate(1);
+    goby::zeromq::InterProcessPortal<> zmq(cfg);
+
+    while (!subscribed) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // until the subscription has reached gobyd, publications are not received
+    while (received < messages)
+    {
+        IOData data;
+        data.set_data("trace");
+        zmq.publish<traced>(data);
+        zmq.poll(std::chrono::milliseconds(10));
+    }
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::WARN, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    test_trace();
+
+    goby::middleware::TransportMetrics::set_enabled(true);
+
+    goby::zeromq::protobuf::InterProcessPortalConfig cfg;
+    cfg.set_platform("test_interprocess_trace");
+
+    auto manager_context = std::make_unique<zmq::context_t>(1);
+    auto router_context = std::make_unique<zmq::context_t>(1);
+    goby::zeromq::Router router(*router_context, cfg);
+    std::thread router_thread([&] { router.run(); });
+    goby::zeromq::Manager manager(*manager_context, cfg, router);
+    std::thread manager_thread([&] { manager.run(); });
+
+    auto subscriber_cfg = cfg;
+    subscriber_cfg.set_client_name("subscriber");
+    std::thread subscriber_thread([&] { subscriber(subscriber_cfg); });
+
+    auto publisher_cfg = cfg;
+    publisher_cfg.set_client_name("publisher");
+    std::thread publisher_thread([&] { publisher(publisher_cfg); });
+
+    subscriber_thread.join();
+    publisher_thread.join();
+
+    // latency of the traced publications received by the subscriber
+    auto metrics = goby::middleware::TransportMetrics::summary();
+    bool latency_found = false;
+    for (const auto& topic : metrics.topic())
+    {
+        if (topic.layer() == goby::middleware::protobuf::LAYER_INTERPROCESS &&
+            topic.group() == std::string(traced) && topic.received_count() > 0)
+        {
+            std::cout << "Metrics: " << topic.ShortDebugString() << std::endl;
+            assert(topic.latency().count() == topic.received_count());
+            latency_found = true;
+        }
+    }
+    assert(latency_found);
+
+    manager_context.reset();
+    router_context.reset();
+    router_thread.join();
+    manager_thread.join();
+
+    std::cout << "all tests passed" << std::endl;
+}
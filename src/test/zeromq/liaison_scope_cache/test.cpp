@@ -0,0 +1,138 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "goby/middleware/protobuf/io.pb.h"
+#include "goby/util/debug_logger.h"
+
+#include "../../../apps/zeromq/liaison/liaison_scope_cache.h"
+
+// tests the parsing and change tracking of the values shared by the liaison scope sessions
+
+using goby::apps::zeromq::ScopeCache;
+using goby::middleware::protobuf::CanPGNMessage;
+
+const std::string type = CanPGNMessage::descriptor()->full_name();
+
+std::vector<unsigned char> serialize(const CanPGNMessage& msg)
+{
+    std::vector<unsigned char> data(msg.ByteSizeLong());
+    msg.SerializePartialToArray(data.data(), data.size());
+    return data;
+}
+
+void test_parse()
+{
+    CanPGNMessage msg;
+    msg.set_pgn(127250);
+    msg.set_data("abc");
+
+    ScopeCache cache;
+    cache.insert("can", type, serialize(msg));
+    std::uint64_t since = 0;
+    auto updates = cache.updates(since);
+    assert(updates.size() == 1);
+    assert(updates[0].group == "can" && updates[0].value->type() == type);
+
+    auto parsed = updates[0].value->message();
+    assert(parsed);
+    assert(parsed->SerializeAsString() == msg.SerializeAsString());
+    // parsed once
+    assert(updates[0].value->message() == parsed);
+    std::cout << "parse ok" << std::endl;
+}
+
+void test_parse_failure()
+{
+    ScopeCache cache;
+
+    // truncated: the length of the data field runs past the end
+    CanPGNMessage msg;
+    msg.set_pgn(127250);
+    msg.set_data("abc");
+    auto truncated = serialize(msg);
+    truncated.pop_back();
+    cache.insert("truncated", type, truncated);
+
+    // missing the required pgn
+    CanPGNMessage incomplete;
+    incomplete.set_data("abc");
+    cache.insert("incomplete", type, serialize(incomplete));
+
+    // not a known type
+    cache.insert("unknown", "goby.test.NoSuchMessage", serialize(msg));
+
+    std::uint64_t since = 0;
+    auto updates = cache.updates(since);
+    assert(updates.size() == 3);
+    for (const auto& update : updates)
+    {
+        assert(!update.value->message());
+        // and not retried
+        assert(!update.value->message());
+    }
+    std::cout << "parse failure ok" << std::endl;
+}
+
+void test_updates()
+{
+    CanPGNMessage msg;
+    msg.set_pgn(1);
+
+    ScopeCache cache;
+    cache.insert("a", type, serialize(msg));
+    cache.insert("b", type, serialize(msg));
+    std::uint64_t since = 0;
+    assert(cache.updates(since).size() == 2);
+    assert(cache.updates(since).empty());
+
+    // only the latest value of each (group, type)
+    msg.set_pgn(2);
+    cache.insert("a", type, serialize(msg));
+    msg.set_pgn(3);
+    cache.insert("a", type, serialize(msg));
+    auto updates = cache.updates(since);
+    assert(updates.size() == 1);
+    assert(updates[0].group == "a");
+    CanPGNMessage latest;
+    latest.CopyFrom(*updates[0].value->message());
+    assert(latest.pgn() == 3);
+    std::cout << "updates ok" << std::endl;
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::WARN, &std::cerr);
+    goby::glog.set_name(argv[0]);
+
+    test_parse();
+    test_parse_failure();
+    test_updates();
+
+    std::cout << "all tests passed" << std::endl;
+    return 0;
+}
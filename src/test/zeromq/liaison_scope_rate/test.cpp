@@ -0,0 +1,98 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cassert>
+#include <iostream>
+
+#include "../../../apps/zeromq/liaison/liaison_scope_rate.h"
+
+// tests the row interval and byte budget accounting of the liaison scope
+
+using goby::apps::zeromq::ScopeRateLimit;
+using Clock = ScopeRateLimit::Clock;
+
+void test_row_interval()
+{
+    auto start = Clock::now();
+
+    // no limits: rows are redrawn on every scope refresh (at 2 Hz)
+    ScopeRateLimit unlimited(0, 0, start);
+    unlimited.set_scope_update_freq(2);
+    assert(unlimited.row_interval() == std::chrono::milliseconds(250));
+    assert(unlimited.row_due("a", start));
+    unlimited.row_updated("a", start);
+    assert(unlimited.row_due("a", start + std::chrono::milliseconds(500)));
+    assert(!unlimited.update(start + std::chrono::seconds(10)));
+
+    // max_row_update_freq: each row at most once per second, independently
+    ScopeRateLimit limited(1, 0, start);
+    limited.set_scope_update_freq(2);
+    assert(limited.row_interval() == std::chrono::milliseconds(750));
+    limited.row_updated("a", start);
+    assert(!limited.row_due("a", start + std::chrono::milliseconds(500)));
+    assert(limited.row_due("b", start + std::chrono::milliseconds(500)));
+    assert(limited.row_due("a", start + std::chrono::seconds(1)));
+}
+
+void test_byte_budget()
+{
+    auto start = Clock::now();
+    ScopeRateLimit budget(0, 1000, start);
+    budget.set_scope_update_freq(1);
+
+    budget.add_bytes(3000);
+    budget.add_bytes(1000);
+    assert(budget.bytes_sent() == 4000);
+
+    // no update until a full window has passed
+    assert(!budget.update(start + std::chrono::milliseconds(500)));
+    assert(budget.bytes_sent() == 4000);
+    assert(budget.row_interval_scale() == 1);
+
+    // 4000 bytes over 2 s is twice the budget: scale smoothed to (1 + 2) / 2
+    auto now = start + std::chrono::seconds(2);
+    assert(budget.update(now));
+    assert(budget.last_rate() == 2000);
+    assert(budget.row_interval_scale() == 1.5);
+    assert(budget.bytes_sent() == 0);
+    assert(budget.row_interval() == std::chrono::milliseconds(1000));
+
+    // under budget: scale relaxes but never drops below 1
+    now += std::chrono::seconds(1);
+    budget.add_bytes(100);
+    assert(budget.update(now));
+    assert(budget.row_interval_scale() == 1);
+
+    // small changes are not reported
+    now += std::chrono::seconds(1);
+    budget.add_bytes(1000);
+    assert(!budget.update(now));
+    assert(budget.row_interval_scale() == 1);
+}
+
+int main()
+{
+    test_row_interval();
+    test_byte_budget();
+    std::cout << "all tests passed" << std::endl;
+}
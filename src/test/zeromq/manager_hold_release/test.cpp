@@ -0,0 +1,208 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Binaries
+// ("The Goby Binaries").
+//
+// The Goby Binaries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// The Goby Binaries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <zmq.hpp>
+
+#include "goby/middleware/marshalling/protobuf.h"
+#include "goby/middleware/transport/interthread.h"
+#include "goby/util/debug_logger.h"
+#include "goby/zeromq/transport/interprocess.h"
+
+// tests that the Manager pushes the release of the hold to a required client that has stopped
+// requesting the hold state, and publishes the startup latency of each client upon release
+
+using goby::glog;
+using namespace goby::util::logger;
+using Clock = std::chrono::steady_clock;
+
+std::atomic<bool> running(true);
+std::atomic<bool> observer_subscribed(false);
+std::atomic<bool> early_ready(false);
+std::atomic<bool> early_released(false);
+std::atomic<bool> late_released(false);
+
+// written by one thread and read after it is joined
+Clock::time_point early_release_time;
+Clock::time_point late_ready_time;
+
+std::mutex release_mutex;
+std::unique_ptr<goby::zeromq::protobuf::ManagerResponse> release_response;
+
+void wait_for(const std::atomic<bool>& flag, const std::string& what)
+{
+    auto timeout = Clock::now() + std::chrono::seconds(10);
+    while (!flag)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (Clock::now() > timeout)
+            glog.is(DIE) && glog << "Timed out waiting for " << what << std::endl;
+    }
+}
+
+// subscribes (through the early client's portal) to the Manager's responses
+void observer()
+{
+    goby::middleware::InterThreadTransporter inproc;
+    goby::middleware::InterProcessForwarder<goby::middleware::InterThreadTransporter> ipc(inproc);
+    ipc.subscribe<goby::zeromq::groups::manager_response, goby::zeromq::protobuf::ManagerResponse>(
+        [](const goby::zeromq::protobuf::ManagerResponse& response) {
+            if (response.all_clients())
+            {
+                std::lock_guard<std::mutex> lock(release_mutex);
+                release_response.reset(new goby::zeromq::protobuf::ManagerResponse(response));
+            }
+        });
+    observer_subscribed = true;
+    while (running) ipc.poll(std::chrono::milliseconds(10));
+}
+
+// required client that is ready immediately, so it is only waiting on the Manager
+void early_client(const goby::zeromq::protobuf::InterProcessPortalConfig& cfg)
+{
+    goby::middleware::InterThreadTransporter inproc;
+    goby::zeromq::InterProcessPortal<goby::middleware::InterThreadTransporter> zmq(inproc, cfg);
+
+    std::thread observer_thread(observer);
+    wait_for(observer_subscribed, "observer");
+    // let the forwarded subscription reach gobyd
+    auto subscribe_end = Clock::now() + std::chrono::seconds(1);
+    while (Clock::now() < subscribe_end) zmq.poll(std::chrono::milliseconds(10));
+
+    zmq.ready();
+    early_ready = true;
+
+    while (zmq.hold_state()) zmq.poll(std::chrono::milliseconds(10));
+    early_release_time = Clock::now();
+    early_released = true;
+
+    while (running) zmq.poll(std::chrono::milliseconds(10));
+    observer_thread.join();
+}
+
+// required client that becomes ready well after the early client has stopped requesting the hold
+// state (which it does upon the Manager's first response)
+void late_client(const goby::zeromq::protobuf::InterProcessPortalConfig& cfg)
+{
+    goby::zeromq::InterProcessPortal<> zmq(cfg);
+
+    wait_for(early_ready, "early client");
+    auto ready_time = Clock::now() + std::chrono::seconds(2);
+    while (Clock::now() < ready_time) zmq.poll(std::chrono::milliseconds(10));
+
+    late_ready_time = Clock::now();
+    zmq.ready();
+
+    while (zmq.hold_state()) zmq.poll(std::chrono::milliseconds(10));
+    late_released = true;
+
+    while (running) zmq.poll(std::chrono::milliseconds(10));
+}
+
+int main(int /*argc*/, char* argv[])
+{
+    goby::glog.add_stream(goby::util::logger::WARN, &std::cerr);
+    goby::glog.set_name(argv[0]);
+    goby::glog.set_lock_action(goby::util::logger_lock::lock);
+
+    goby::zeromq::protobuf::InterProcessPortalConfig cfg;
+    cfg.set_platform("test_manager_hold_release");
+    cfg.set_manager_timeout_seconds(5);
+
+    goby::zeromq::protobuf::InterProcessManagerHold hold;
+    hold.add_required_client("early");
+    hold.add_required_client("late");
+
+    auto manager_context = std::make_unique<zmq::context_t>(1);
+    auto router_context = std::make_unique<zmq::context_t>(1);
+    goby::zeromq::Router router(*router_context, cfg);
+    std::thread router_thread([&] { router.run(); });
+    goby::zeromq::Manager manager(*manager_context, cfg, router, hold);
+    std::thread manager_thread([&] { manager.run(); });
+
+    auto early_cfg = cfg;
+    early_cfg.set_client_name("early");
+    std::thread early_thread([&] { early_client(early_cfg); });
+
+    auto late_cfg = cfg;
+    late_cfg.set_client_name("late");
+    std::thread late_thread([&] { late_client(late_cfg); });
+
+    wait_for(early_released, "release of the early client");
+    wait_for(late_released, "release of the late client");
+
+    auto timeout = Clock::now() + std::chrono::seconds(10);
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(release_mutex);
+            if (release_response)
+                break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        if (Clock::now() > timeout)
+            glog.is(DIE) && glog << "Timed out waiting for the release response" << std::endl;
+    }
+
+    running = false;
+    early_thread.join();
+    late_thread.join();
+
+    // the early client is released by the Manager's push as soon as the late client is ready
+    auto release_delay = early_release_time - late_ready_time;
+    std::cout << "early client released "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(release_delay).count()
+              << " ms after the late client was ready" << std::endl;
+    assert(early_release_time > late_ready_time);
+    assert(release_delay < std::chrono::milliseconds(500));
+
+    // startup latency of each client
+    std::cout << release_response->ShortDebugString() << std::endl;
+    assert(release_response->request() == goby::zeromq::protobuf::PROVIDE_HOLD_STATE);
+    assert(!release_response->hold());
+    assert(release_response->startup_latency_size() == 2);
+    for (const auto& latency : release_response->startup_latency())
+    {
+        assert(latency.client_name() == "early" || latency.client_name() == "late");
+        assert(latency.client_pid() == getpid());
+        assert(latency.has_connected() && latency.has_ready() && latency.has_released());
+        assert(latency.connected() <= latency.ready());
+        assert(latency.ready() <= latency.released());
+        if (latency.client_name() == "late")
+            // ready about two seconds after connecting
+            assert(latency.ready() > 1000000);
+    }
+
+    manager_context.reset();
+    router_context.reset();
+    router_thread.join();
+    manager_thread.join();
+
+    std::cout << "all tests passed" << std::endl;
+}
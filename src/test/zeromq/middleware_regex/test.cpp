@@ -178,8 +178,38 @@ void zmq_forward(const goby::zeromq::protobuf::InterProcessPortalConfig& cfg)
     assert(special_chars_receive);
 }
 
+void test_filters()
+{
+    using goby::zeromq::regex_subscription_filters;
+    using Filters = std::vector<std::string>;
+    const std::set<int> protobuf{goby::middleware::MarshallingScheme::PROTOBUF};
+    const std::set<int> all{goby::middleware::MarshallingScheme::ALL_SCHEMES};
+
+    assert(regex_subscription_filters(all, ".*", ".*") == Filters({"/"}));
+    assert(regex_subscription_filters(protobuf, ".*Sample", "Sample1|Sample2") ==
+           Filters({"/Sample1/PROTOBUF/", "/Sample2/PROTOBUF/"}));
+    assert(regex_subscription_filters(protobuf, "goby\\.test\\..*", "^\\[Sample\\]\\(\\)$") ==
+           Filters({"/[Sample]()/PROTOBUF/goby.test."}));
+    assert(regex_subscription_filters(protobuf, "Widget", "Sample") ==
+           Filters({"/Sample/PROTOBUF/Widget/"}));
+    assert(regex_subscription_filters(all, ".*", "goby::health.*") == Filters({"/goby::health"}));
+    assert(regex_subscription_filters(all, ".*", "Sample1|Sample2") ==
+           Filters({"/Sample1/", "/Sample2/"}));
+    // quantifiers make the preceding character optional, or end the prefix after it
+    assert(regex_subscription_filters(all, ".*", "Samples?1") == Filters({"/Sample"}));
+    assert(regex_subscription_filters(all, ".*", "Sx+1") == Filters({"/Sx"}));
+    // filters covered by another are removed
+    assert(regex_subscription_filters(all, ".*", "Sample1|Sample.*") == Filters({"/Sample"}));
+    // unable to derive a prefix (alternatives within a group, character classes)
+    assert(regex_subscription_filters(all, ".*", "(Sample1|Widget)") == Filters({"/"}));
+    assert(regex_subscription_filters(all, ".*", "\\w+|Sample") == Filters({"/"}));
+    assert(regex_subscription_filters(all, ".*", "[A-Z]ample") == Filters({"/"}));
+}
+
 int main(int /*argc*/, char* argv[])
 {
+    test_filters();
+
     goby::zeromq::protobuf::InterProcessPortalConfig cfg;
     cfg.set_platform("test4");
 
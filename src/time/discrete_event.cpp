@@ -0,0 +1,280 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <algorithm>     // for min
+#include <thread>        // for thread, get_id
+#include <unordered_map> // for unordered_map
+#include <utility>       // for pair
+#include <vector>        // for vector
+
+#include "discrete_event.h"
+
+namespace
+{
+using goby::time::DiscreteEventClock;
+
+struct Participant
+{
+    bool idle{false};
+    DiscreteEventClock::time_point deadline{DiscreteEventClock::time_point::max()};
+    std::shared_ptr<std::timed_mutex> poll_mutex;
+    std::shared_ptr<std::condition_variable_any> cv;
+};
+
+using Waiter =
+    std::pair<std::shared_ptr<std::timed_mutex>, std::shared_ptr<std::condition_variable_any>>;
+
+void notify(const std::vector<Waiter>& waiters)
+{
+    for (const auto& waiter : waiters)
+    {
+        // lock to ensure the other thread isn't between registering as idle and wait(), where the
+        // notification would be lost
+        {
+            std::lock_guard<std::timed_mutex> lock(*waiter.first);
+        }
+        waiter.second->notify_all();
+    }
+}
+
+// participants of this process; all members are protected by mutex
+class Registry
+{
+  public:
+    void set_idle(Participant& p, bool idle)
+    {
+        if (p.idle != idle)
+        {
+            p.idle = idle;
+            idle ? ++idle_count : --idle_count;
+        }
+    }
+
+    // call after any change to the participants
+    void update()
+    {
+        bool idle = !participants.empty() && idle_count == participants.size();
+        auto next_deadline = DiscreteEventClock::time_point::max();
+        if (idle)
+        {
+            for (const auto& p : participants)
+                next_deadline = std::min(next_deadline, p.second.deadline);
+        }
+
+        if (idle == state.idle && next_deadline == state.next_deadline)
+            return;
+
+        state.idle = idle;
+        state.next_deadline = next_deadline;
+        ++state.sequence;
+
+        if (handler)
+            handler(state);
+        else
+            advance_cv.notify_all();
+    }
+
+    // sets the time and returns the participants to notify (outside the lock)
+    std::vector<Waiter> advance(DiscreteEventClock::time_point t)
+    {
+        std::int64_t t_microseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(t.time_since_epoch()).count();
+        if (t_microseconds > goby::time::SimulatorSettings::discrete_event_time)
+            goby::time::SimulatorSettings::discrete_event_time = t_microseconds;
+
+        auto now = DiscreteEventClock::now();
+        std::vector<Waiter> waiters;
+        for (auto& p : participants)
+        {
+            if (p.second.idle && p.second.deadline <= now)
+            {
+                set_idle(p.second, false);
+                waiters.emplace_back(p.second.poll_mutex, p.second.cv);
+            }
+        }
+        update();
+        return waiters;
+    }
+
+    // advances time when there is no coordinator (handler), until local_advance_generation changes
+    void run_local_advance(std::uint64_t generation)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            advance_cv.wait(lock, [&]() {
+                return generation != local_advance_generation ||
+                       (!handler && state.idle &&
+                        state.next_deadline != DiscreteEventClock::time_point::max());
+            });
+            if (generation != local_advance_generation)
+                return;
+
+            // let any messages in flight be delivered
+            auto sequence = state.sequence;
+            if (advance_cv.wait_for(lock, goby::time::SimulatorSettings::discrete_event_settle_time,
+                                    [&]() {
+                                        return state.sequence != sequence || handler ||
+                                               generation != local_advance_generation;
+                                    }))
+                continue;
+
+            auto waiters = advance(state.next_deadline);
+            lock.unlock();
+            notify(waiters);
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable advance_cv;
+    std::unordered_map<std::thread::id, Participant> participants;
+    std::size_t idle_count{0};
+    DiscreteEventClock::State state{false, DiscreteEventClock::time_point::max(), 0};
+    DiscreteEventClock::StateHandler handler;
+
+    // runs run_local_advance() while there are participants
+    std::thread local_advance_thread;
+    std::uint64_t local_advance_generation{0};
+};
+
+// never destroyed, as participants are removed at thread exit (possibly after static destruction)
+Registry& registry()
+{
+    static Registry* registry = new Registry;
+    return *registry;
+}
+
+// thread_local: registers the thread on first wait and removes it when the thread exits
+struct ParticipantGuard
+{
+    ParticipantGuard()
+    {
+        auto& reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.participants.insert(std::make_pair(std::this_thread::get_id(), Participant()));
+        if (!reg.local_advance_thread.joinable())
+        {
+            auto generation = reg.local_advance_generation;
+            reg.local_advance_thread =
+                std::thread([&reg, generation]() { reg.run_local_advance(generation); });
+        }
+    }
+
+    // the last participant to exit stops the local advance thread
+    ~ParticipantGuard()
+    {
+        auto& reg = registry();
+        std::thread local_advance_thread;
+        {
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            auto it = reg.participants.find(std::this_thread::get_id());
+            reg.set_idle(it->second, false);
+            reg.participants.erase(it);
+            reg.update();
+
+            if (reg.participants.empty() && reg.local_advance_thread.joinable())
+            {
+                // a participant added while joining starts a new thread
+                ++reg.local_advance_generation;
+                local_advance_thread = std::move(reg.local_advance_thread);
+                reg.advance_cv.notify_all();
+            }
+        }
+        if (local_advance_thread.joinable())
+            local_advance_thread.join();
+    }
+};
+} // namespace
+
+void goby::time::DiscreteEventClock::add_participant()
+{
+    thread_local ParticipantGuard participant;
+}
+
+void goby::time::DiscreteEventClock::advance(time_point t)
+{
+    auto& reg = registry();
+    std::vector<Waiter> waiters;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        waiters = reg.advance(t);
+    }
+    notify(waiters);
+}
+
+bool goby::time::DiscreteEventClock::wait_until(
+    std::unique_lock<std::timed_mutex>& lock, const std::shared_ptr<std::timed_mutex>& poll_mutex,
+    const std::shared_ptr<std::condition_variable_any>& cv, time_point deadline)
+{
+    add_participant();
+
+    auto& reg = registry();
+    {
+        std::lock_guard<std::mutex> reg_lock(reg.mutex);
+        if (now() >= deadline)
+            return false;
+
+        auto& p = reg.participants[std::this_thread::get_id()];
+        p.deadline = deadline;
+        p.poll_mutex = poll_mutex;
+        p.cv = cv;
+        reg.set_idle(p, true);
+        reg.update();
+    }
+
+    cv->wait(lock);
+
+    {
+        std::lock_guard<std::mutex> reg_lock(reg.mutex);
+        auto& p = reg.participants[std::this_thread::get_id()];
+        reg.set_idle(p, false);
+        p.poll_mutex.reset();
+        p.cv.reset();
+        reg.update();
+        return now() < deadline;
+    }
+}
+
+void goby::time::DiscreteEventClock::wake(const std::condition_variable_any* cv)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& p : reg.participants)
+    {
+        if (p.second.idle && p.second.cv.get() == cv)
+            reg.set_idle(p.second, false);
+    }
+    reg.update();
+}
+
+void goby::time::DiscreteEventClock::set_state_handler(StateHandler handler)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.handler = std::move(handler);
+    if (reg.handler)
+        reg.handler(reg.state);
+    else
+        reg.advance_cv.notify_all();
+}
@@ -0,0 +1,103 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_TIME_DISCRETE_EVENT_H
+#define GOBY_TIME_DISCRETE_EVENT_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "goby/time/simulation.h"
+#include "goby/time/system_clock.h"
+
+namespace goby
+{
+namespace time
+{
+/// \brief Simulation clock that jumps to the next pending deadline rather than running at (a multiple of) real time (see SimulatorSettings::discrete_event)
+///
+/// Threads that block in goby::middleware::PollerInterface::poll() (e.g. the loop() timing of goby::middleware::Thread) are the participants. While any participant is busy, time stands still. Once they are all idle for SimulatorSettings::discrete_event_settle_time, time is advanced to the earliest of their deadlines and the corresponding threads are woken.
+///
+/// Within a single process this is done locally. When a StateHandler is set (as goby::zeromq::InterProcessPortal does), the idle state is instead reported to a coordinator (gobyd) which advances time across all the participating processes.
+class DiscreteEventClock
+{
+  public:
+    using time_point = SystemClock::time_point;
+    using duration = SystemClock::duration;
+
+    /// \brief Idle state of all the participants in this process
+    struct State
+    {
+        /// \brief true if all the participants are waiting
+        bool idle;
+        /// \brief earliest deadline of the waiting participants (time_point::max() if none)
+        time_point next_deadline;
+        /// \brief incremented on each change of state
+        std::uint64_t sequence;
+    };
+    using StateHandler = std::function<void(const State&)>;
+
+    /// \brief Is discrete event simulation time in use?
+    static bool enabled()
+    {
+        return SimulatorSettings::using_sim_time && SimulatorSettings::discrete_event;
+    }
+
+    /// \brief Current simulation time
+    static time_point now()
+    {
+        return time_point(duration(SimulatorSettings::discrete_event_time.load()));
+    }
+
+    /// \brief Advance the simulation time to t (if later than now()) and wake the participants whose deadline has been reached
+    static void advance(time_point t);
+
+    /// \brief Register the calling thread as a (busy) participant until it exits, so that the time does not advance before it first waits (wait_until() registers automatically)
+    static void add_participant();
+
+    /// \brief Wait as a participant on cv until notified or the simulation time reaches deadline
+    ///
+    /// \param lock Lock on poll_mutex, held by the caller (released while waiting, as for std::condition_variable_any::wait)
+    /// \param poll_mutex Mutex held by anyone notifying cv
+    /// \param cv Condition variable to wait on
+    /// \param deadline Simulation time to wake at (time_point::max() to only wait for cv)
+    /// \return false if the deadline was reached, true otherwise
+    static bool wait_until(std::unique_lock<std::timed_mutex>& lock,
+                           const std::shared_ptr<std::timed_mutex>& poll_mutex,
+                           const std::shared_ptr<std::condition_variable_any>& cv,
+                           time_point deadline);
+
+    /// \brief Mark the participants waiting on cv as busy. Call before notifying cv so that time does not advance while the notified thread has work pending.
+    static void wake(const std::condition_variable_any* cv);
+
+    /// \brief Report changes of State to handler (called with the current State immediately, and then never concurrently) instead of advancing time locally. Pass an empty handler to revert to advancing locally.
+    static void set_state_handler(StateHandler handler);
+};
+
+} // namespace time
+} // namespace goby
+
+#endif
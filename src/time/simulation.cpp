@@ -50,6 +50,13 @@ std::chrono::system_clock::time_point create_reference_time()
 std::chrono::system_clock::time_point
     goby::time::SimulatorSettings::reference_time(create_reference_time());
 
+bool goby::time::SimulatorSettings::discrete_event = false;
+std::atomic<std::int64_t> goby::time::SimulatorSettings::discrete_event_time(
+    std::chrono::duration_cast<std::chrono::microseconds>(
+        goby::time::SimulatorSettings::reference_time.time_since_epoch())
+        .count());
+std::chrono::microseconds goby::time::SimulatorSettings::discrete_event_settle_time(1000);
+
 goby::time::SystemClock::time_point
 goby::time::SystemClock::warp(const std::chrono::system_clock::time_point& real_time)
 {
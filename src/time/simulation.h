@@ -25,7 +25,9 @@
 #ifndef GOBY_TIME_SIMULATION_H
 #define GOBY_TIME_SIMULATION_H
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 
 namespace goby
 {
@@ -40,6 +42,12 @@ struct SimulatorSettings
     static int warp_factor;
     /// \brief Reference time when calculating SystemClock::now(). If this is unset, the default is 1 January of the current year.
     static std::chrono::system_clock::time_point reference_time;
+    /// \brief If true (and using_sim_time), time only moves when DiscreteEventClock advances it to the next pending deadline once all participating threads are idle (warp_factor is not used)
+    static bool discrete_event;
+    /// \brief Current simulation time (microseconds since the UNIX epoch) when discrete_event is true
+    static std::atomic<std::int64_t> discrete_event_time;
+    /// \brief Real time that all participants must remain idle before the simulation time is advanced (allows messages in flight to be delivered)
+    static std::chrono::microseconds discrete_event_settle_time;
 };
 
 } // namespace time
@@ -49,6 +49,10 @@ struct SteadyClock
     static time_point now() noexcept
     {
         using namespace std::chrono;
+        // simulation time only moves forward, so it is also steady
+        if (SimulatorSettings::using_sim_time && SimulatorSettings::discrete_event)
+            return time_point(duration(SimulatorSettings::discrete_event_time.load()));
+
         auto now = steady_clock::now();
 
         if (!SimulatorSettings::using_sim_time)
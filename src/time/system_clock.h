@@ -55,7 +55,7 @@ struct SystemClock
     typedef std::chrono::time_point<SystemClock> time_point;
     static const bool is_steady = false;
 
-    /// \brief Returns the current system time unless SimulatorSettings::using_sim_time is set to true, in which case a simulated time is returned that is sped up by the SimulatorSettings::warp_factor
+    /// \brief Returns the current system time unless SimulatorSettings::using_sim_time is set to true, in which case a simulated time is returned that is sped up by the SimulatorSettings::warp_factor (or, if SimulatorSettings::discrete_event is set, the time last set by DiscreteEventClock)
     ///
     /// When using simulated time, the returned time (t_sim) is computed relative to SimulatorSettings::reference_time (t_0) with an accelerated progression by a factor of the SimulatorSettings::warp_time (w) such that:
     /// t_sim = (t-t_0)*w + t_0
@@ -63,6 +63,9 @@ struct SystemClock
     static time_point now() noexcept
     {
         using namespace std::chrono;
+        if (SimulatorSettings::using_sim_time && SimulatorSettings::discrete_event)
+            return time_point(duration(SimulatorSettings::discrete_event_time.load()));
+
         auto now = system_clock::now();
 
         if (!SimulatorSettings::using_sim_time)
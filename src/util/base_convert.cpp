@@ -32,6 +32,63 @@
 
 #include <boost/multiprecision/number.hpp>
 
+#include <cstdint> // for uint32_t, uint64_t
+#include <vector>  // for vector
+
+#include "goby/exception.h" // for Exception
+
+namespace
+{
+// fixed size unsigned integer used by the block conversions: 32-bit limbs, least significant first
+using Limbs = std::vector<std::uint32_t>;
+
+// value = value * mult + add
+void multiply_add(Limbs& value, std::uint32_t mult, std::uint32_t add)
+{
+    std::uint64_t carry = add;
+    for (auto& limb : value)
+    {
+        std::uint64_t product = static_cast<std::uint64_t>(limb) * mult + carry;
+        limb = static_cast<std::uint32_t>(product);
+        carry = product >> 32;
+    }
+    if (carry)
+        value.push_back(static_cast<std::uint32_t>(carry));
+}
+
+// value = value / div, returns value % div
+std::uint32_t divide(Limbs& value, std::uint32_t div)
+{
+    std::uint64_t remainder = 0;
+    for (auto it = value.rbegin(), end = value.rend(); it != end; ++it)
+    {
+        std::uint64_t dividend = (remainder << 32) | *it;
+        *it = static_cast<std::uint32_t>(dividend / div);
+        remainder = dividend % div;
+    }
+    while (!value.empty() && value.back() == 0) value.pop_back();
+    return static_cast<std::uint32_t>(remainder);
+}
+
+int bit_length(const Limbs& value)
+{
+    if (value.empty())
+        return 0;
+    int bits = (value.size() - 1) * 32;
+    for (std::uint32_t ms_limb = value.back(); ms_limb; ms_limb >>= 1) ++bits;
+    return bits;
+}
+
+void check_block_args(int base, int block_bytes)
+{
+    if (base < 2 || base > 255)
+        throw(goby::Exception("Block base conversion requires a base in the range [2, 255]"));
+    if (block_bytes < 1)
+        throw(goby::Exception("Block base conversion requires a positive block size"));
+}
+
+} // namespace
+
 void goby::util::base_convert(const std::string& source, std::string* sink, int source_base,
                               int sink_base)
 {
@@ -76,3 +133,92 @@ void goby::util::base_convert(const std::string& source, std::string* sink, int
     // preserve MS zeros by adding that number to the most significant end
     for (int i = 0; i < ms_zeros; ++i) sink->push_back(0);
 }
+
+int goby::util::block_base_encoded_size(int bytes, int base)
+{
+    // smallest n such that base^n >= 2^(8*bytes), i.e. base^n has at least 8*bytes+1 bits
+    Limbs power{1};
+    int n = 0;
+    while (bit_length(power) < 8 * bytes + 1)
+    {
+        multiply_add(power, base, 0);
+        ++n;
+    }
+    return n;
+}
+
+void goby::util::block_base_encode(const std::string& source, std::string* sink, int sink_base,
+                                   int block_bytes)
+{
+    check_block_args(sink_base, block_bytes);
+
+    const int full_block_digits = block_base_encoded_size(block_bytes, sink_base);
+    const int num_full_blocks = source.size() / block_bytes;
+    const int partial_block_bytes = source.size() % block_bytes;
+    const int partial_block_digits = block_base_encoded_size(partial_block_bytes, sink_base);
+
+    sink->assign(num_full_blocks * full_block_digits + partial_block_digits, 0);
+
+    Limbs value;
+    value.reserve(block_bytes / 4 + 2);
+    auto sink_it = sink->begin();
+    for (int block_start = 0, n = source.size(); block_start < n; block_start += block_bytes)
+    {
+        const bool full_block = (block_start + block_bytes <= n);
+        const int bytes = full_block ? block_bytes : partial_block_bytes;
+        const int digits = full_block ? full_block_digits : partial_block_digits;
+
+        value.clear();
+        for (int i = block_start; i < block_start + bytes; ++i)
+            multiply_add(value, 256, 0xFF & source[i]);
+
+        // most significant digit first within each block
+        for (int i = digits - 1; i >= 0; --i) *(sink_it + i) = divide(value, sink_base);
+        sink_it += digits;
+    }
+}
+
+void goby::util::block_base_decode(const std::string& source, std::string* sink, int source_base,
+                                   int block_bytes)
+{
+    check_block_args(source_base, block_bytes);
+
+    const int full_block_digits = block_base_encoded_size(block_bytes, source_base);
+    const int num_full_blocks = source.size() / full_block_digits;
+    const int partial_block_digits = source.size() % full_block_digits;
+
+    // find the number of bytes that encodes to the trailing partial block of digits
+    int partial_block_bytes = 0;
+    while (partial_block_bytes < block_bytes &&
+           block_base_encoded_size(partial_block_bytes, source_base) < partial_block_digits)
+        ++partial_block_bytes;
+    if (block_base_encoded_size(partial_block_bytes, source_base) != partial_block_digits)
+        throw(goby::Exception("Invalid length for block base encoded data"));
+
+    sink->assign(num_full_blocks * block_bytes + partial_block_bytes, 0);
+
+    Limbs value;
+    value.reserve(block_bytes / 4 + 2);
+    auto sink_it = sink->begin();
+    for (int block_start = 0, n = source.size(); block_start < n;
+         block_start += full_block_digits)
+    {
+        const bool full_block = (block_start + full_block_digits <= n);
+        const int digits = full_block ? full_block_digits : partial_block_digits;
+        const int bytes = full_block ? block_bytes : partial_block_bytes;
+
+        value.clear();
+        for (int i = block_start; i < block_start + digits; ++i)
+        {
+            int digit = 0xFF & source[i];
+            if (digit >= source_base)
+                throw(goby::Exception("Digit out of range for block base encoded data"));
+            multiply_add(value, source_base, digit);
+        }
+
+        for (int i = bytes - 1; i >= 0; --i) *(sink_it + i) = divide(value, 256);
+        if (!value.empty())
+            throw(goby::Exception("Block value too large for block base encoded data"));
+        sink_it += bytes;
+    }
+}
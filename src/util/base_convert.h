@@ -32,6 +32,21 @@ namespace goby
 namespace util
 {
 void base_convert(const std::string& source, std::string* sink, int source_base, int sink_base);
+
+/// \brief Number of base \c base digits needed to hold any value of \c bytes bytes (i.e. the smallest n such that base^n >= 256^bytes)
+int block_base_encoded_size(int bytes, int base);
+
+/// \brief Converts bytes (base 256) to digits of base \c sink_base (2-255), converting \c block_bytes of source at a time
+///
+/// Unlike base_convert(), which treats the whole source as a single integer (quadratic in the source length), this is linear in the source length. Each full block becomes block_base_encoded_size(block_bytes, sink_base) digits and a trailing partial block of n bytes becomes block_base_encoded_size(n, sink_base) digits, so the expansion is bounded for every block (about 1.6% for 64 byte blocks into base 251). As with base_convert(), each digit is stored as a char with value [0, sink_base).
+void block_base_encode(const std::string& source, std::string* sink, int sink_base,
+                       int block_bytes = 64);
+
+/// \brief Inverse of block_base_encode()
+///
+/// \throw goby::Exception if source is not a valid encoding (digit out of range, block value too large, or invalid length)
+void block_base_decode(const std::string& source, std::string* sink, int source_base,
+                       int block_bytes = 64);
 } // namespace util
 } // namespace goby
 
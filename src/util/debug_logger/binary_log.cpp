@@ -0,0 +1,212 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <chrono>     // for microseconds
+#include <functional> // for hash
+#include <memory>     // for shared_ptr
+
+#include <google/protobuf/io/coded_stream.h> // for CodedOutputStream
+#include <google/protobuf/message.h>         // for Message
+
+#include "goby/exception.h"    // for Exception
+#include "goby/time/convert.h" // for str
+
+#include "binary_log.h"
+
+namespace
+{
+constexpr const char* magic = "GOBYGLOG";
+constexpr int magic_size = 8;
+} // namespace
+
+goby::util::logger::BinaryLogWriter::BinaryLogWriter(std::ostream* os, const std::string& name)
+    : os_(os)
+{
+    os_->write(magic, magic_size);
+    record_.set_name(name);
+    write_record(record_);
+}
+
+void goby::util::logger::BinaryLogWriter::write(goby::time::SystemClock::time_point time,
+                                                std::thread::id thread, Verbosity verbosity,
+                                                const std::string& group_name,
+                                                const std::string& text,
+                                                const std::vector<Payload>& payloads)
+{
+    for (const auto& payload : payloads)
+    {
+        if (payload.message)
+            write_file_descriptor(payload.message->GetDescriptor()->file());
+    }
+
+    auto& entry = *record_.mutable_entry();
+    entry.Clear();
+    entry.set_time(
+        std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count());
+    entry.set_thread(std::hash<std::thread::id>()(thread));
+    entry.set_verbosity(verbosity);
+    if (!group_name.empty())
+        entry.set_group(group_name);
+    entry.set_text(text);
+
+    for (const auto& payload : payloads)
+    {
+        auto& pb_payload = *entry.add_payload();
+        pb_payload.set_offset(payload.offset);
+        if (payload.message)
+        {
+            pb_payload.set_protobuf_type(payload.message->GetDescriptor()->full_name());
+            payload.message->SerializeToString(pb_payload.mutable_data());
+        }
+        else
+        {
+            pb_payload.set_data(payload.bytes);
+        }
+    }
+
+    write_record(record_);
+}
+
+void goby::util::logger::BinaryLogWriter::write_file_descriptor(
+    const google::protobuf::FileDescriptor* file_desc)
+{
+    if (written_file_desc_.count(file_desc))
+        return;
+
+    // dependencies first so that the reader can build each file as it is read
+    for (int i = 0, n = file_desc->dependency_count(); i < n; ++i)
+        write_file_descriptor(file_desc->dependency(i));
+
+    written_file_desc_.insert(file_desc);
+
+    protobuf::GLogBinaryRecord record;
+    file_desc->CopyTo(record.mutable_file_descriptor());
+    write_record(record);
+}
+
+void goby::util::logger::BinaryLogWriter::write_record(const protobuf::GLogBinaryRecord& record)
+{
+    record.SerializeToString(&buffer_);
+
+    // varint32 is at most 5 bytes
+    std::uint8_t size[5];
+    auto size_end = google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
+        buffer_.size(), size);
+    os_->write(reinterpret_cast<const char*>(size), size_end - size);
+    os_->write(buffer_.data(), buffer_.size());
+}
+
+goby::util::logger::BinaryLogReader::BinaryLogReader(std::istream* is) : is_(is)
+{
+    char file_magic[magic_size];
+    protobuf::GLogBinaryRecord record;
+    if (!is_->read(file_magic, magic_size) || std::string(file_magic, magic_size) != magic ||
+        !read_record(&record) || !record.has_name())
+        throw(goby::Exception("Not a binary glog file"));
+    name_ = record.name();
+}
+
+bool goby::util::logger::BinaryLogReader::read_record(protobuf::GLogBinaryRecord* record)
+{
+    std::uint32_t size = 0;
+    for (int shift = 0;; shift += 7)
+    {
+        auto c = is_->get();
+        if (c == std::istream::traits_type::eof())
+        {
+            if (shift == 0)
+                return false;
+            throw(goby::Exception("Binary glog file ends within a record size"));
+        }
+        if (shift > 28)
+            throw(goby::Exception("Invalid record size in binary glog file"));
+
+        size |= static_cast<std::uint32_t>(c & 0x7F) << shift;
+        if (!(c & 0x80))
+            break;
+    }
+
+    buffer_.resize(size);
+    if (!is_->read(&buffer_[0], size))
+        throw(goby::Exception("Binary glog file ends within a record"));
+    if (!record->ParseFromString(buffer_))
+        throw(goby::Exception("Invalid record in binary glog file"));
+    return true;
+}
+
+bool goby::util::logger::BinaryLogReader::read(protobuf::GLogBinaryRecord::Entry* entry,
+                                               std::vector<Payload>* payloads)
+{
+    protobuf::GLogBinaryRecord record;
+    while (read_record(&record))
+    {
+        switch (record.record_case())
+        {
+            case protobuf::GLogBinaryRecord::kFileDescriptor:
+                // on failure the affected payloads are read as bytes
+                pool_.BuildFile(record.file_descriptor());
+                break;
+
+            case protobuf::GLogBinaryRecord::kEntry:
+            {
+                entry->Swap(record.mutable_entry());
+                payloads->clear();
+                for (const auto& pb_payload : entry->payload())
+                {
+                    Payload payload;
+                    payload.offset = pb_payload.offset();
+
+                    const google::protobuf::Descriptor* desc =
+                        pb_payload.has_protobuf_type()
+                            ? pool_.FindMessageTypeByName(pb_payload.protobuf_type())
+                            : nullptr;
+                    std::shared_ptr<google::protobuf::Message> msg(
+                        desc ? factory_.GetPrototype(desc)->New() : nullptr);
+                    if (msg && msg->ParseFromString(pb_payload.data()))
+                        payload.message = msg;
+                    else
+                        payload.bytes = pb_payload.data();
+
+                    payloads->push_back(std::move(payload));
+                }
+                return true;
+            }
+
+            case protobuf::GLogBinaryRecord::kName:
+            case protobuf::GLogBinaryRecord::RECORD_NOT_SET: break;
+        }
+    }
+    return false;
+}
+
+void goby::util::logger::BinaryLogReader::write_text(
+    std::ostream& os, const protobuf::GLogBinaryRecord::Entry& entry,
+    const std::vector<Payload>& payloads)
+{
+    goby::time::SystemClock::time_point time{std::chrono::microseconds(entry.time())};
+    std::string text = render(entry.text(), payloads);
+    FlexOStreamBuf::strip_escapes(text);
+
+    basic_log_header(os, entry.group(), goby::time::str(time));
+    os << text << "\n";
+}
@@ -0,0 +1,109 @@
+// Copyright 2026:
+//   GobySoft, LLC (2013-)
+//   Community contributors (see AUTHORS file)
+// File authors:
+//   Toby Schneider <toby@gobysoft.org>
+//
+//
+// This file is part of the Goby Underwater Autonomy Project Libraries
+// ("The Goby Libraries").
+//
+// The Goby Libraries are free software: you can redistribute them and/or modify
+// them under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 2.1 of the License, or
+// (at your option) any later version.
+//
+// The Goby Libraries are distributed in the hope that they will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with Goby.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef GOBY_UTIL_DEBUG_LOGGER_BINARY_LOG_H
+#define GOBY_UTIL_DEBUG_LOGGER_BINARY_LOG_H
+
+#include <iostream> // for istream, ostream
+#include <set>      // for set
+#include <string>   // for string
+#include <thread>   // for thread
+#include <vector>   // for vector
+
+#include <google/protobuf/descriptor.h>      // for DescriptorPool
+#include <google/protobuf/dynamic_message.h> // for DynamicMessageFactory
+
+#include "goby/time/system_clock.h"                     // for SystemClock
+#include "goby/util/debug_logger/flex_ostreambuf.h"     // for Verbosity
+#include "goby/util/debug_logger/logger_manipulators.h" // for Payload
+#include "goby/util/protobuf/debug_logger_binary.pb.h"  // for GLogBinaryRecord
+
+namespace goby
+{
+namespace util
+{
+namespace logger
+{
+/// \brief Writes goby::glog messages in the compact binary format (protobuf::GLogBinaryRecord), to be rendered offline by BinaryLogReader (goby_glog_render)
+///
+/// Payloads (see debug_string()) are stored as serialized Protobuf messages, along with the file descriptors required to parse them.
+class BinaryLogWriter
+{
+  public:
+    BinaryLogWriter(std::ostream* os, const std::string& name);
+
+    void write(goby::time::SystemClock::time_point time, std::thread::id thread,
+               Verbosity verbosity, const std::string& group_name, const std::string& text,
+               const std::vector<Payload>& payloads);
+
+    std::ostream* os() const { return os_; }
+
+  private:
+    void write_file_descriptor(const google::protobuf::FileDescriptor* file_desc);
+    void write_record(const protobuf::GLogBinaryRecord& record);
+
+  private:
+    std::ostream* os_;
+    std::set<const google::protobuf::FileDescriptor*> written_file_desc_;
+    protobuf::GLogBinaryRecord record_;
+    std::string buffer_;
+};
+
+/// \brief Reads a log written by BinaryLogWriter
+class BinaryLogReader
+{
+  public:
+    /// \throw goby::Exception if is does not contain a binary debug log
+    explicit BinaryLogReader(std::istream* is);
+
+    /// \brief Read the next entry
+    ///
+    /// \param entry Entry read
+    /// \param payloads The entry's payloads, with Protobuf messages parsed using the file descriptors stored in the log (if the type is unknown, the bytes are used instead). These messages must not outlive this reader.
+    /// \return false at the end of the log
+    /// \throw goby::Exception if the log is corrupt
+    bool read(protobuf::GLogBinaryRecord::Entry* entry, std::vector<Payload>* payloads);
+
+    /// \brief Write the entry as goby::glog writes to a (non terminal) text stream
+    static void write_text(std::ostream& os, const protobuf::GLogBinaryRecord::Entry& entry,
+                           const std::vector<Payload>& payloads);
+
+    /// Name of the application that wrote the log
+    const std::string& name() const { return name_; }
+
+  private:
+    bool read_record(protobuf::GLogBinaryRecord* record);
+
+  private:
+    std::istream* is_;
+    std::string name_;
+    std::string buffer_;
+    google::protobuf::DescriptorPool pool_;
+    google::protobuf::DynamicMessageFactory factory_{&pool_};
+};
+
+} // namespace logger
+} // namespace util
+} // namespace goby
+
+#endif
@@ -71,7 +71,14 @@ std::ostream& goby::util::FlexOstream::operator<<(std::ostream& (*pf)(std::ostre
     if (pf == die)
         sb_.set_die_flag(true);
     //    set_unset_verbosity();
-    return std::ostream::operator<<(pf);
+    return stream() << pf;
+}
+
+std::ostream& goby::util::FlexOstream::thread_stream()
+{
+    // there is only ever one FlexOstream (goby::glog)
+    thread_local std::ostream os(&sb_);
+    return os;
 }
 
 bool goby::util::FlexOstream::is(logger::Verbosity verbosity)
@@ -82,7 +89,8 @@ bool goby::util::FlexOstream::is(logger::Verbosity verbosity)
 
     if (display)
     {
-        if (sb_.lock_action() == logger_lock::lock)
+        // the asynchronous backend keeps per-thread state so no lock is required
+        if (sb_.lock_action() == logger_lock::lock && !sb_.message_is_async())
         {
             goby::util::logger::mutex.lock();
         }
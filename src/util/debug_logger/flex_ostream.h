@@ -28,6 +28,7 @@
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include <google/protobuf/io/tokenizer.h>
 #include <google/protobuf/text_format.h>
@@ -100,8 +101,27 @@ class FlexOstream : public std::ostream
         sb_.add_stream(static_cast<logger::Verbosity>(verbosity), os);
     }
 
+    /// Attach a stream to the logger that is written in the compact binary format (rendered to text offline by goby_glog_render); QUIET detaches the stream
+    void add_binary_stream(logger::Verbosity verbosity, std::ostream* os)
+    {
+        std::lock_guard<std::recursive_mutex> l(goby::util::logger::mutex);
+        sb_.add_binary_stream(verbosity, os);
+    }
+
     const FlexOStreamBuf& buf() { return sb_; }
 
+    /// \brief Queue messages in per-thread buffers written out by a single writer thread, rather than locking logger::mutex and writing from the calling thread. Call before starting any threads that log.
+    void enable_async(const goby::util::protobuf::GLogConfig::Async& cfg = {})
+    {
+        sb_.enable_async(cfg);
+    }
+
+    /// \brief Write out all queued messages and return to synchronous logging
+    void disable_async() { sb_.disable_async(); }
+
+    /// Number of messages dropped by the asynchronous backend (overflow_policy: DROP)
+    std::uint64_t async_dropped() { return sb_.async_dropped(); }
+
     //@}
 
     /// \name Overloaded insert stream operator<<
@@ -113,23 +133,23 @@ class FlexOstream : public std::ostream
     std::ostream& operator<<(std::ostream& (*pf)(std::ostream&));
 
     //provide interfaces to the rest of the types
-    std::ostream& operator<<(bool& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const short& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const unsigned short& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const int& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const unsigned int& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const long& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const long long& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const unsigned long& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const float& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const double& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(const long double& val) { return std::ostream::operator<<(val); }
-    std::ostream& operator<<(std::streambuf* sb) { return std::ostream::operator<<(sb); }
-    std::ostream& operator<<(std::ios& (*pf)(std::ios&)) { return std::ostream::operator<<(pf); }
-    std::ostream& operator<<(std::ios_base& (*pf)(std::ios_base&))
-    {
-        return std::ostream::operator<<(pf);
-    }
+    std::ostream& operator<<(bool& val) { return stream() << val; }
+    std::ostream& operator<<(const short& val) { return stream() << val; }
+    std::ostream& operator<<(const unsigned short& val) { return stream() << val; }
+    std::ostream& operator<<(const int& val) { return stream() << val; }
+    std::ostream& operator<<(const unsigned int& val) { return stream() << val; }
+    std::ostream& operator<<(const long& val) { return stream() << val; }
+    std::ostream& operator<<(const long long& val) { return stream() << val; }
+    std::ostream& operator<<(const unsigned long& val) { return stream() << val; }
+    std::ostream& operator<<(const float& val) { return stream() << val; }
+    std::ostream& operator<<(const double& val) { return stream() << val; }
+    std::ostream& operator<<(const long double& val) { return stream() << val; }
+    std::ostream& operator<<(std::streambuf* sb) { return stream() << sb; }
+    std::ostream& operator<<(std::ios& (*pf)(std::ios&)) { return stream() << pf; }
+    std::ostream& operator<<(std::ios_base& (*pf)(std::ios_base&)) { return stream() << pf; }
+
+    /// The stream insertions are made on: *this, or in asynchronous mode a per-thread std::ostream sharing this stream buffer (so that formatting state is not shared between threads)
+    std::ostream& stream() { return sb_.message_is_async() ? thread_stream() : *this; }
 
     //@}
 
@@ -143,6 +163,7 @@ class FlexOstream : public std::ostream
 
     void refresh() { sb_.refresh(); }
     void set_group(const std::string& s) { sb_.group_name(s); }
+    void add_payload(logger::Payload payload) { sb_.add_payload(std::move(payload)); }
 
     // void set_unset_verbosity()
     // {
@@ -156,6 +177,8 @@ class FlexOstream : public std::ostream
 
     bool quiet() { return (sb_.is_quiet()); }
 
+    std::ostream& thread_stream();
+
     friend std::ostream& operator<<(FlexOstream& out, char c);
     friend std::ostream& operator<<(FlexOstream& out, signed char c);
     friend std::ostream& operator<<(FlexOstream& out, unsigned char c);
@@ -171,28 +194,38 @@ class FlexOstream : public std::ostream
     logger_lock::LockAction lock_action_{logger_lock::none};
 };
 
-inline std::ostream& operator<<(FlexOstream& out, char c) { return std::operator<<(out, c); }
-inline std::ostream& operator<<(FlexOstream& out, signed char c) { return std::operator<<(out, c); }
+inline std::ostream& operator<<(FlexOstream& out, char c)
+{
+    return std::operator<<(out.stream(), c);
+}
+inline std::ostream& operator<<(FlexOstream& out, signed char c)
+{
+    return std::operator<<(out.stream(), c);
+}
 inline std::ostream& operator<<(FlexOstream& out, unsigned char c)
 {
-    return std::operator<<(out, c);
+    return std::operator<<(out.stream(), c);
+}
+inline std::ostream& operator<<(FlexOstream& out, const char* s)
+{
+    return std::operator<<(out.stream(), s);
 }
-inline std::ostream& operator<<(FlexOstream& out, const char* s) { return std::operator<<(out, s); }
 inline std::ostream& operator<<(FlexOstream& out, const signed char* s)
 {
-    return std::operator<<(out, s);
+    return std::operator<<(out.stream(), s);
 }
 inline std::ostream& operator<<(FlexOstream& out, const unsigned char* s)
 {
-    return std::operator<<(out, s);
+    return std::operator<<(out.stream(), s);
 }
 //@}
 
-template <typename _CharT, typename _Traits, typename _Alloc>
-inline std::ostream& operator<<(FlexOstream& out,
-                                const std::basic_string<_CharT, _Traits, _Alloc>& s)
+/// Any other type that can be inserted into a std::ostream (std::string, manipulators, user types, ...)
+template <typename T>
+inline auto operator<<(FlexOstream& out, T&& t)
+    -> decltype(std::declval<std::ostream&>() << std::forward<T>(t))
 {
-    return std::operator<<(out, s);
+    return out.stream() << std::forward<T>(t);
 }
 
 } // namespace util
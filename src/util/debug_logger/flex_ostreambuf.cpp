@@ -22,24 +22,25 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
-#include <algorithm> // for copy, max
-#include <atomic>    // for atomic
-#include <cassert>   // for assert
-#include <chrono>    // for time_point
-#include <cstdio>    // for EOF
-#include <cstdlib>   // for exit
-#include <deque>     // for deque
-#include <iomanip>   // for operator<<
-#include <iostream>  // for operator<<
-#include <iterator>  // for ostreamb...
-#include <map>       // for map, map...
-#include <memory>    // for make_shared
-#include <mutex>     // for mutex
-#include <sstream>   // for basic_st...
-#include <string>    // for string
-#include <thread>    // for thread
-#include <utility>   // for move, pair
-#include <vector>    // for vector
+#include <algorithm>          // for copy, max, find_if
+#include <atomic>             // for atomic
+#include <cassert>            // for assert
+#include <chrono>             // for time_point
+#include <condition_variable> // for condition_variable
+#include <cstdio>             // for EOF
+#include <cstdlib>            // for exit
+#include <deque>              // for deque
+#include <iomanip>            // for operator<<
+#include <iostream>           // for operator<<
+#include <iterator>           // for ostreamb...
+#include <map>                // for map, map...
+#include <memory>             // for make_shared
+#include <mutex>              // for mutex
+#include <sstream>            // for basic_st...
+#include <string>             // for string
+#include <thread>             // for thread
+#include <utility>            // for move, pair
+#include <vector>             // for vector
 
 #include <boost/date_time/gregorian/gregorian.hpp>          // for date
 #include <boost/date_time/posix_time/posix_time_config.hpp> // for time_dur...
@@ -55,6 +56,7 @@
 #ifdef HAS_NCURSES
 #include "flex_ncurses.h" // for FlexNCurses
 #endif
+#include "binary_log.h"          // for BinaryLogWriter
 #include "flex_ostream.h"        // for FlexOstream
 #include "logger_manipulators.h" // for Group
 
@@ -66,6 +68,132 @@ std::mutex curses_mutex;
 
 std::recursive_mutex goby::util::logger::mutex;
 
+namespace
+{
+/// Bounded queue with a single producer (the logging thread) and a single consumer (the writer thread). Neither side takes a lock.
+template <typename Entry> class LogRing
+{
+  public:
+    explicit LogRing(std::size_t min_capacity)
+    {
+        std::size_t capacity = 1;
+        while (capacity < min_capacity) capacity <<= 1;
+        slots_.resize(capacity);
+        mask_ = capacity - 1;
+    }
+
+    /// producer only: returns false (leaving entry untouched) if full
+    bool push(Entry& entry)
+    {
+        auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) > mask_)
+            return false;
+        slots_[tail & mask_] = std::move(entry);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// consumer only: returns false if empty
+    bool pop(Entry& entry)
+    {
+        auto head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return false;
+        entry = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    std::size_t capacity() const { return mask_ + 1; }
+
+    void add_dropped() { dropped_.fetch_add(1, std::memory_order_relaxed); }
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /// producer: returns true only for the first call since the consumer last called drained()
+    bool signal_wake() { return !wake_signalled_.exchange(true); }
+    /// consumer: called after emptying the ring
+    void drained() { wake_signalled_ = false; }
+
+  private:
+    std::vector<Entry> slots_;
+    std::size_t mask_;
+    std::atomic<std::size_t> head_{0};
+    std::atomic<std::size_t> tail_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::atomic<bool> wake_signalled_{false};
+};
+} // namespace
+
+struct goby::util::FlexOStreamBuf::AsyncWriter
+{
+    using Ring = LogRing<LogEntry>;
+
+    void wake()
+    {
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            wake_requested = true;
+        }
+        wake_cv.notify_one();
+    }
+
+    // dropped messages from all rings, including those of threads that have exited
+    std::uint64_t dropped()
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex);
+        std::uint64_t total = retired_dropped;
+        for (const auto& ring : rings) total += ring->dropped();
+        return total;
+    }
+
+    protobuf::GLogConfig::Async cfg;
+
+    // one ring per logging thread
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<Ring>> rings;
+    std::uint64_t retired_dropped{0};
+
+    std::mutex wake_mutex;
+    std::condition_variable wake_cv;
+    bool wake_requested{false};
+    // false once disable_async() has been called
+    std::atomic<bool> running{true};
+
+    // producers waiting for space in their ring (overflow_policy: BLOCK)
+    std::mutex space_mutex;
+    std::condition_variable space_cv;
+    std::atomic<int> blocked{0};
+
+    // held while draining the rings and writing: by the writer thread or, once the writer has
+    // been stopped, by a thread completing a message
+    std::mutex write_mutex;
+    std::vector<LogEntry> pending;
+    std::uint64_t reported_dropped{0};
+    std::chrono::steady_clock::time_point last_drop_report;
+
+    std::thread thread;
+};
+
+struct goby::util::FlexOStreamBuf::ThreadBuffer
+{
+    std::deque<Line> lines = std::deque<Line>(1);
+    std::string group_name;
+    logger::Verbosity verbosity{logger::UNKNOWN};
+    bool die{false};
+
+    // backend chosen for the message being composed (see message_is_async())
+    bool in_message{false};
+    AsyncWriter* message_writer{nullptr};
+
+    // ring registered with writer
+    AsyncWriter* writer{nullptr};
+    std::shared_ptr<AsyncWriter::Ring> ring;
+};
+
 goby::util::FlexOStreamBuf::FlexOStreamBuf(FlexOstream* parent)
     : buffer_(1),
       name_("no name"),
@@ -84,6 +212,7 @@ goby::util::FlexOStreamBuf::FlexOStreamBuf(FlexOstream* parent)
 
 goby::util::FlexOStreamBuf::~FlexOStreamBuf()
 {
+    disable_async();
 #ifdef HAS_NCURSES
     if (curses_)
         delete curses_;
@@ -107,12 +236,53 @@ void goby::util::FlexOStreamBuf::add_stream(logger::Verbosity verbosity, std::os
     if (!stream_exists)
         streams_.emplace_back(os, verbosity);
 
-    highest_verbosity_ = logger::QUIET;
-    for (auto stream : streams_)
+    update_highest_verbosity();
+}
+
+void goby::util::FlexOStreamBuf::add_binary_stream(logger::Verbosity verbosity, std::ostream* os)
+{
+    // the writer keeps per-file state (header, descriptors written), so QUIET detaches the stream
+    auto it = std::find_if(binary_streams_.begin(), binary_streams_.end(),
+                           [os](const BinaryStreamConfig& sc) { return sc.writer->os() == os; });
+    if (it != binary_streams_.end())
+    {
+        if (verbosity == logger::QUIET)
+            binary_streams_.erase(it);
+        else
+            it->verbosity = verbosity;
+    }
+    else if (verbosity != logger::QUIET)
+    {
+        binary_streams_.push_back(
+            {std::unique_ptr<logger::BinaryLogWriter>(new logger::BinaryLogWriter(os, name_)),
+             verbosity});
+    }
+
+    update_highest_verbosity();
+}
+
+void goby::util::FlexOStreamBuf::update_highest_verbosity()
+{
+    logger::Verbosity highest_verbosity = logger::QUIET;
+    for (const auto& stream : streams_)
+    {
+        if (stream.verbosity() > highest_verbosity)
+            highest_verbosity = stream.verbosity();
+    }
+    for (const auto& stream : binary_streams_)
     {
-        if (stream.verbosity() > highest_verbosity_)
-            highest_verbosity_ = stream.verbosity();
+        if (stream.verbosity > highest_verbosity)
+            highest_verbosity = stream.verbosity;
     }
+    highest_verbosity_ = highest_verbosity;
+}
+
+void goby::util::FlexOStreamBuf::add_payload(logger::Payload payload)
+{
+    AsyncWriter* writer = message_writer();
+    Line& line = writer ? thread_buffer(*writer).lines.back() : buffer_.back();
+    payload.offset = line.text.size();
+    line.payloads.push_back(std::move(payload));
 }
 
 void goby::util::FlexOStreamBuf::enable_gui()
@@ -157,16 +327,51 @@ void goby::util::FlexOStreamBuf::add_group(const std::string& name, logger::Grou
 #endif
 }
 
+void goby::util::FlexOStreamBuf::group_name(const std::string& s)
+{
+    if (AsyncWriter* writer = message_writer())
+        thread_buffer(*writer).group_name = s;
+    else
+        group_name_ = s;
+}
+
+void goby::util::FlexOStreamBuf::set_die_flag(bool b)
+{
+    if (AsyncWriter* writer = message_writer())
+        thread_buffer(*writer).die = b;
+    else
+        die_flag_ = b;
+}
+
+void goby::util::FlexOStreamBuf::set_verbosity_depth(logger::Verbosity depth)
+{
+    if (AsyncWriter* writer = message_writer())
+        thread_buffer(*writer).verbosity = depth;
+    else
+        current_verbosity_ = depth;
+}
+
+goby::util::logger::Verbosity goby::util::FlexOStreamBuf::verbosity_depth()
+{
+    // doesn't start a message
+    const ThreadBuffer& local = local_buffer();
+    return (local.in_message && local.message_writer) ? local.verbosity
+                                                      : current_verbosity_.load();
+}
+
 int goby::util::FlexOStreamBuf::overflow(int c /*= EOF*/)
 {
     //    parent_->set_unset_verbosity();
 
+    AsyncWriter* writer = message_writer();
+    std::deque<Line>& buffer = writer ? thread_buffer(*writer).lines : buffer_;
+
     if (c == EOF)
         return c;
     else if (c == '\n')
-        buffer_.emplace_back();
+        buffer.emplace_back();
     else
-        buffer_.back().push_back(c);
+        buffer.back().text.push_back(c);
 
     return c;
 }
@@ -174,13 +379,23 @@ int goby::util::FlexOStreamBuf::overflow(int c /*= EOF*/)
 // called when flush() or std::endl
 int goby::util::FlexOStreamBuf::sync()
 {
+    // this completes the message
+    AsyncWriter* writer = message_writer();
+    local_buffer().in_message = false;
+
+    if (writer)
+    {
+        async_sync(thread_buffer(*writer), *writer);
+        return 0;
+    }
+
     if (current_verbosity_ == logger::UNKNOWN && lock_action_ == logger_lock::lock)
     {
         std::cerr
             << "== Misuse of goby::glog in threaded mode: must use 'glog.is_*() && glog' syntax. "
                "For example, glog.is_verbose() && glog << \"My message\" << std::endl;"
             << std::endl;
-        std::cerr << "== Offending line: " << buffer_.front() << std::endl;
+        std::cerr << "== Offending line: " << buffer_.front().text << std::endl;
         assert(!(lock_action_ == logger_lock::lock && current_verbosity_ == logger::UNKNOWN));
         exit(EXIT_FAILURE);
         return 0;
@@ -189,7 +404,12 @@ int goby::util::FlexOStreamBuf::sync()
     // all but last one
     while (buffer_.size() > 1)
     {
-        display(buffer_.front());
+        Line& line = buffer_.front();
+        LogEntry entry{current_verbosity_,       group_name_,
+                       SystemClock::now(),       std::this_thread::get_id(),
+                       std::move(line.text),     std::move(line.payloads),
+                       die_flag_};
+        display(entry, true);
         buffer_.pop_front();
     }
 
@@ -208,39 +428,65 @@ int goby::util::FlexOStreamBuf::sync()
     return 0;
 }
 
-void goby::util::FlexOStreamBuf::display(std::string& s)
+void goby::util::FlexOStreamBuf::display(LogEntry& entry, bool flush)
 {
+    // binary streams store the payloads as is
+    for (const BinaryStreamConfig& cfg : binary_streams_)
+    {
+        if (entry.verbosity <= cfg.verbosity)
+        {
+            cfg.writer->write(entry.time, entry.thread, entry.verbosity, entry.group_name,
+                              entry.text, entry.payloads);
+            if (flush)
+                cfg.writer->os()->flush();
+        }
+    }
+
+    // text streams format them, but only if the entry is written to at least one
+    if (!entry.payloads.empty() &&
+        std::any_of(streams_.begin(), streams_.end(), [&](const StreamConfig& cfg) {
+            return cfg.os() && entry.verbosity <= cfg.verbosity();
+        }))
+    {
+        entry.text = logger::render(entry.text, entry.payloads);
+        entry.payloads.clear();
+    }
+
+    std::string& s = entry.text;
+    const std::string& group_name = entry.group_name;
+    const std::string time_str = goby::time::str(entry.time);
+
     bool gui_displayed = false;
     for (const StreamConfig& cfg : streams_)
     {
         if ((cfg.os() == &std::cout || cfg.os() == &std::cerr || cfg.os() == &std::clog) &&
-            current_verbosity_ <= cfg.verbosity())
+            entry.verbosity <= cfg.verbosity())
         {
 #ifdef HAS_NCURSES
-            if (is_gui_ && current_verbosity_ <= cfg.verbosity() && !gui_displayed)
+            if (is_gui_ && entry.verbosity <= cfg.verbosity() && !gui_displayed)
             {
-                if (!die_flag_)
+                if (!entry.die)
                 {
                     std::lock_guard<std::mutex> lock(curses_mutex);
                     std::stringstream line;
                     boost::posix_time::time_duration time_of_day =
-                        SystemClock::now<boost::posix_time::ptime>().time_of_day();
+                        time::convert<boost::posix_time::ptime>(entry.time).time_of_day();
                     line << "\n"
                          << std::setfill('0') << std::setw(2) << time_of_day.hours() << ":"
                          << std::setw(2) << time_of_day.minutes() << ":" << std::setw(2)
                          << time_of_day.seconds()
-                         << TermColor::esc_code_from_col(groups_[group_name_].color()) << " | "
+                         << TermColor::esc_code_from_col(groups_[group_name].color()) << " | "
                          << esc_nocolor << s;
 
-                    curses_->insert(SystemClock::now<boost::posix_time::ptime>(), line.str(),
-                                    &groups_[group_name_]);
+                    curses_->insert(time::convert<boost::posix_time::ptime>(entry.time),
+                                    line.str(), &groups_[group_name]);
                 }
                 else
                 {
                     curses_->alive(false);
                     input_thread_->join();
                     curses_->cleanup();
-                    std::cerr << TermColor::esc_code_from_col(groups_[group_name_].color()) << name_
+                    std::cerr << TermColor::esc_code_from_col(groups_[group_name].color()) << name_
                               << esc_nocolor << ": " << s << esc_nocolor << std::endl;
                 }
                 gui_displayed = true;
@@ -251,22 +497,287 @@ void goby::util::FlexOStreamBuf::display(std::string& s)
             (void)gui_displayed;
 #endif
 
-            *cfg.os() << TermColor::esc_code_from_col(groups_[group_name_].color()) << name_
-                      << esc_nocolor << " [" << goby::time::str() << "]";
-            if (!group_name_.empty())
+            *cfg.os() << TermColor::esc_code_from_col(groups_[group_name].color()) << name_
+                      << esc_nocolor << " [" << time_str << "]";
+            if (!group_name.empty())
                 *cfg.os() << " "
-                          << "{" << group_name_ << "}";
-            *cfg.os() << ": " << s << std::endl;
+                          << "{" << group_name << "}";
+            *cfg.os() << ": " << s << "\n";
+            if (flush)
+                cfg.os()->flush();
         }
-        else if (cfg.os() && current_verbosity_ <= cfg.verbosity())
+        else if (cfg.os() && entry.verbosity <= cfg.verbosity())
         {
-            goby::util::logger::basic_log_header(*cfg.os(), group_name_);
+            goby::util::logger::basic_log_header(*cfg.os(), group_name, time_str);
             strip_escapes(s);
-            *cfg.os() << s << std::endl;
+            *cfg.os() << s << "\n";
+            if (flush)
+                cfg.os()->flush();
         }
     }
 }
 
+void goby::util::FlexOStreamBuf::enable_async(const protobuf::GLogConfig::Async& cfg)
+{
+    std::lock_guard<std::mutex> control_lock(async_control_mutex_);
+    if (async_writer_)
+        throw(goby::Exception("glog asynchronous mode is already enabled"));
+
+    std::unique_ptr<AsyncWriter> writer(new AsyncWriter);
+    writer->cfg = cfg;
+    writer->last_drop_report = std::chrono::steady_clock::now();
+    AsyncWriter* w = writer.get();
+    writer->thread = std::thread([this, w]() { async_run(*w); });
+    async_writers_.push_back(std::move(writer));
+    async_writer_ = w;
+}
+
+void goby::util::FlexOStreamBuf::disable_async()
+{
+    std::lock_guard<std::mutex> control_lock(async_control_mutex_);
+    AsyncWriter* writer = async_writer_.exchange(nullptr);
+    if (!writer)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(writer->wake_mutex);
+        writer->running = false;
+    }
+    writer->wake_cv.notify_one();
+    {
+        std::lock_guard<std::mutex> lock(writer->space_mutex);
+    }
+    writer->space_cv.notify_all();
+
+    // the writer drains every ring before exiting. Messages started before this call but
+    // completed afterwards are written out by their own thread (see async_sync)
+    writer->thread.join();
+}
+
+std::uint64_t goby::util::FlexOStreamBuf::async_dropped()
+{
+    std::lock_guard<std::mutex> control_lock(async_control_mutex_);
+    return async_writers_.empty() ? 0 : async_writers_.back()->dropped();
+}
+
+goby::util::FlexOStreamBuf::ThreadBuffer& goby::util::FlexOStreamBuf::local_buffer()
+{
+    // there is only ever one FlexOStreamBuf (owned by goby::glog)
+    thread_local ThreadBuffer buffer;
+    return buffer;
+}
+
+goby::util::FlexOStreamBuf::AsyncWriter* goby::util::FlexOStreamBuf::message_writer()
+{
+    ThreadBuffer& buffer = local_buffer();
+    if (!buffer.in_message)
+    {
+        buffer.message_writer = async_writer_;
+        buffer.in_message = true;
+    }
+    return buffer.message_writer;
+}
+
+goby::util::FlexOStreamBuf::ThreadBuffer&
+goby::util::FlexOStreamBuf::thread_buffer(AsyncWriter& writer)
+{
+    ThreadBuffer& buffer = local_buffer();
+    if (buffer.writer != &writer)
+    {
+        buffer.ring = std::make_shared<AsyncWriter::Ring>(writer.cfg.buffer_size());
+        {
+            std::lock_guard<std::mutex> lock(writer.rings_mutex);
+            writer.rings.push_back(buffer.ring);
+        }
+        buffer.writer = &writer;
+    }
+    return buffer;
+}
+
+void goby::util::FlexOStreamBuf::async_sync(ThreadBuffer& buffer, AsyncWriter& writer)
+{
+    AsyncWriter::Ring& ring = *buffer.ring;
+    const auto now = SystemClock::now();
+    const auto thread = std::this_thread::get_id();
+    const bool block =
+        buffer.die || writer.cfg.overflow_policy() == protobuf::GLogConfig::Async::BLOCK;
+
+    // all but last one
+    while (buffer.lines.size() > 1)
+    {
+        Line& line = buffer.lines.front();
+        LogEntry entry{buffer.verbosity,     buffer.group_name,        now,
+                       thread,               std::move(line.text),     std::move(line.payloads),
+                       buffer.die};
+        buffer.lines.pop_front();
+
+        if (ring.push(entry))
+        {
+            // don't wait for the flush interval if this thread is producing quickly
+            if (ring.size() >= ring.capacity() / 2 && ring.signal_wake())
+                writer.wake();
+        }
+        else if (block)
+        {
+            async_push_blocking(buffer, writer, entry);
+        }
+        else
+        {
+            ring.add_dropped();
+        }
+    }
+
+    buffer.group_name.erase();
+    buffer.verbosity = logger::UNKNOWN;
+
+    // if the writer was stopped while this message was composed, its final pass may have missed
+    // this message, so write it out here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!writer.running)
+        async_write_pending(writer, true);
+
+    if (buffer.die)
+    {
+        disable_async();
+        exit(EXIT_FAILURE);
+    }
+}
+
+void goby::util::FlexOStreamBuf::async_push_blocking(ThreadBuffer& buffer, AsyncWriter& writer,
+                                                     LogEntry& entry)
+{
+    writer.wake();
+
+    std::unique_lock<std::mutex> lock(writer.space_mutex);
+    ++writer.blocked;
+    while (!buffer.ring->push(entry))
+    {
+        if (writer.running)
+        {
+            writer.space_cv.wait(lock);
+        }
+        else
+        {
+            // no writer to wait for: empty our ring ourselves
+            lock.unlock();
+            async_write_pending(writer, true);
+            lock.lock();
+        }
+    }
+    --writer.blocked;
+}
+
+void goby::util::FlexOStreamBuf::async_run(AsyncWriter& writer)
+{
+    const auto flush_interval = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::duration<double>(writer.cfg.flush_interval()));
+
+    bool running = true;
+    while (running)
+    {
+        {
+            std::unique_lock<std::mutex> lock(writer.wake_mutex);
+            writer.wake_cv.wait_for(lock, flush_interval, [&writer]() {
+                return writer.wake_requested || !writer.running;
+            });
+            writer.wake_requested = false;
+            running = writer.running;
+        }
+        // one last pass after disable_async() to write out everything still queued
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        async_write_pending(writer, !running);
+    }
+}
+
+void goby::util::FlexOStreamBuf::async_write_pending(AsyncWriter& async, bool final_pass)
+{
+    std::lock_guard<std::mutex> write_lock(async.write_mutex);
+
+    std::uint64_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(async.rings_mutex);
+        for (auto it = async.rings.begin(); it != async.rings.end();)
+        {
+            // only the writer holds the ring once its thread has exited
+            bool retired = it->use_count() == 1;
+
+            LogEntry entry{};
+            while ((*it)->pop(entry)) async.pending.push_back(std::move(entry));
+            (*it)->drained();
+
+            if (retired)
+            {
+                async.retired_dropped += (*it)->dropped();
+                it = async.rings.erase(it);
+            }
+            else
+            {
+                dropped += (*it)->dropped();
+                ++it;
+            }
+        }
+        dropped += async.retired_dropped;
+    }
+
+    // wake any threads waiting for space in their ring
+    if (async.blocked > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(async.space_mutex);
+        }
+        async.space_cv.notify_all();
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const bool report_drops =
+        dropped > async.reported_dropped &&
+        (final_pass ||
+         now - async.last_drop_report >=
+             std::chrono::duration<double>(async.cfg.drop_report_interval()));
+
+    if (async.pending.empty() && !report_drops)
+        return;
+
+    // interleave the threads' messages in the order they were completed
+    std::stable_sort(async.pending.begin(), async.pending.end(),
+                     [](const LogEntry& a, const LogEntry& b) { return a.time < b.time; });
+
+    // only contends with configuration changes (add_stream, add_group, ...)
+    std::lock_guard<std::recursive_mutex> lock(logger::mutex);
+    auto most_severe = report_drops ? logger::WARN : logger::DEBUG3;
+    for (LogEntry& entry : async.pending)
+    {
+        most_severe = std::min(most_severe, entry.verbosity);
+        display(entry, false);
+    }
+    async.pending.clear();
+
+    if (report_drops)
+    {
+        std::stringstream ss;
+        ss << logger::warn << "Asynchronous logger dropped " << dropped - async.reported_dropped
+           << " message(s): a thread's buffer (buffer_size: " << async.cfg.buffer_size()
+           << ") was full";
+        LogEntry entry{logger::WARN, "", SystemClock::now(), std::this_thread::get_id(), ss.str(),
+                       {},           false};
+        display(entry, false);
+        async.reported_dropped = dropped;
+        async.last_drop_report = now;
+    }
+
+    // flush the streams that were written to
+    for (const StreamConfig& cfg : streams_)
+    {
+        if (cfg.os() && most_severe <= cfg.verbosity())
+            cfg.os()->flush();
+    }
+    for (const BinaryStreamConfig& cfg : binary_streams_)
+    {
+        if (most_severe <= cfg.verbosity)
+            cfg.writer->os()->flush();
+    }
+}
+
 void goby::util::FlexOStreamBuf::refresh()
 {
 #ifdef HAS_NCURSES
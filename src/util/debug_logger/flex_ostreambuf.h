@@ -26,6 +26,7 @@
 #define GOBY_UTIL_DEBUG_LOGGER_FLEX_OSTREAMBUF_H
 
 #include <atomic>
+#include <cstdint>
 #include <cstdio>
 #include <deque>
 #include <iostream>
@@ -38,8 +39,10 @@
 #include <boost/date_time.hpp>
 #include <memory>
 
+#include "goby/time/system_clock.h"
 #include "goby/util/protobuf/debug_logger.pb.h"
 
+#include "logger_manipulators.h"
 #include "term_color.h"
 
 namespace goby
@@ -51,7 +54,8 @@ class FlexNCurses;
 namespace logger
 {
 class Group;
-}
+class BinaryLogWriter;
+} // namespace logger
 
 namespace logger_lock
 {
@@ -102,6 +106,12 @@ class FlexOStreamBuf : public std::streambuf
     /// add a stream to the logger
     void add_stream(logger::Verbosity verbosity, std::ostream* os);
 
+    /// add a stream to the logger that is written in the compact binary format (see logger::BinaryLogWriter)
+    void add_binary_stream(logger::Verbosity verbosity, std::ostream* os);
+
+    /// add a payload (see logger::debug_string()) at the current position of the message being composed
+    void add_payload(logger::Payload payload);
+
     /// do all attached streams have Verbosity == quiet?
     bool is_quiet() const { return highest_verbosity_ == logger::QUIET; }
 
@@ -113,14 +123,14 @@ class FlexOStreamBuf : public std::streambuf
     logger::Verbosity highest_verbosity() const { return highest_verbosity_; }
 
     /// current group name (last insertion of group("") into the stream)
-    void group_name(const std::string& s) { group_name_ = s; }
+    void group_name(const std::string& s);
 
     /// exit on error at the next call to sync()
-    void set_die_flag(bool b) { die_flag_ = b; }
+    void set_die_flag(bool b);
 
-    void set_verbosity_depth(logger::Verbosity depth) { current_verbosity_ = depth; }
+    void set_verbosity_depth(logger::Verbosity depth);
 
-    logger::Verbosity verbosity_depth() { return current_verbosity_; }
+    logger::Verbosity verbosity_depth();
 
     /// add a new group
     void add_group(const std::string& name, logger::Group g);
@@ -132,12 +142,63 @@ class FlexOStreamBuf : public std::streambuf
 
     logger_lock::LockAction lock_action() { return lock_action_; }
 
+    /// \brief Switch to the asynchronous backend: each thread composes messages in its own buffer (without taking logger::mutex) and a single writer thread formats and writes them to the attached streams
+    ///
+    /// \throw goby::Exception if the asynchronous backend is already enabled
+    void enable_async(const protobuf::GLogConfig::Async& cfg);
+
+    /// \brief Write all queued messages, stop the writer thread and return to synchronous logging
+    ///
+    /// Messages that other threads started before this call are still completed asynchronously (and written out by that thread)
+    void disable_async();
+
+    bool is_async() const { return async_writer_ != nullptr; }
+
+    /// \brief Is the message being composed by the calling thread handled by the asynchronous backend?
+    ///
+    /// The backend is chosen once per message (at is() or the first insertion) and kept until the message is completed (std::endl or std::flush), so enable_async() / disable_async() never split a message between the two backends.
+    bool message_is_async() { return message_writer() != nullptr; }
+
+    /// Total number of messages discarded by the asynchronous backend since enable_async()
+    std::uint64_t async_dropped();
+
+    /// clean out any escape codes (for non terminal streams)
+    static void strip_escapes(std::string& s);
+
   private:
-    void display(std::string& s);
-    void strip_escapes(std::string& s);
+    struct Line
+    {
+        std::string text;
+        std::vector<logger::Payload> payloads;
+    };
+
+    struct LogEntry
+    {
+        logger::Verbosity verbosity;
+        std::string group_name;
+        goby::time::SystemClock::time_point time;
+        std::thread::id thread;
+        std::string text;
+        std::vector<logger::Payload> payloads;
+        bool die;
+    };
+
+    struct ThreadBuffer;
+    struct AsyncWriter;
+
+    ThreadBuffer& local_buffer();
+    AsyncWriter* message_writer();
+    ThreadBuffer& thread_buffer(AsyncWriter& writer);
+    void async_sync(ThreadBuffer& buffer, AsyncWriter& writer);
+    void async_push_blocking(ThreadBuffer& buffer, AsyncWriter& writer, LogEntry& entry);
+    void async_run(AsyncWriter& writer);
+    void async_write_pending(AsyncWriter& writer, bool final_pass);
+
+    void display(LogEntry& entry, bool flush);
+    void update_highest_verbosity();
 
   private:
-    std::deque<std::string> buffer_;
+    std::deque<Line> buffer_;
 
     class StreamConfig
     {
@@ -171,11 +232,26 @@ class FlexOStreamBuf : public std::streambuf
 
     std::vector<StreamConfig> streams_;
 
+    struct BinaryStreamConfig
+    {
+        std::unique_ptr<logger::BinaryLogWriter> writer;
+        logger::Verbosity verbosity;
+    };
+    std::vector<BinaryStreamConfig> binary_streams_;
+
     bool is_gui_;
 
     std::atomic<logger::Verbosity> highest_verbosity_;
 
     std::atomic<logger_lock::LockAction> lock_action_;
+
+    // serializes enable_async() / disable_async()
+    std::mutex async_control_mutex_;
+    // writer for new messages (nullptr when synchronous)
+    std::atomic<AsyncWriter*> async_writer_{nullptr};
+    // stopped writers are kept until destruction, as threads may still be completing messages
+    // started while they were enabled
+    std::vector<std::unique_ptr<AsyncWriter>> async_writers_;
     //    FlexOstream* parent_;
 };
 } // namespace util
@@ -29,7 +29,10 @@
 #include <iterator>                                     // for ostreambuf_i...
 #include <sstream>                                      // for basic_string...
 
+#include <google/protobuf/message.h> // for Message
+
 #include "goby/time/convert.h" // for str
+#include "goby/util/binary.h"  // for hex_encode
 
 #include "flex_ostream.h" // for FlexOstream
 #include "logger_manipulators.h"
@@ -48,6 +51,13 @@ void goby::util::logger::GroupSetter::operator()(goby::util::FlexOstream& os) co
 
 void goby::util::logger::GroupSetter::operator()(std::ostream& os) const
 {
+    // per-thread stream used by goby::glog in asynchronous mode
+    if (os.rdbuf() == goby::glog.rdbuf())
+    {
+        goby::glog.set_group(group_);
+        return;
+    }
+
     try
     {
         auto& flex = dynamic_cast<goby::util::FlexOstream&>(os);
@@ -59,9 +69,70 @@ void goby::util::logger::GroupSetter::operator()(std::ostream& os) const
     }
 }
 
+std::string goby::util::logger::Payload::str() const
+{
+    return message ? message->ShortDebugString() : goby::util::hex_encode(bytes);
+}
+
+std::string goby::util::logger::render(const std::string& text,
+                                       const std::vector<Payload>& payloads)
+{
+    if (payloads.empty())
+        return text;
+
+    std::string rendered;
+    std::size_t pos = 0;
+    for (const auto& payload : payloads)
+    {
+        rendered.append(text, pos, payload.offset - pos);
+        rendered += payload.str();
+        pos = payload.offset;
+    }
+    rendered.append(text, pos, std::string::npos);
+    return rendered;
+}
+
+void goby::util::logger::PayloadSetter::operator()(std::ostream& os) const
+{
+    // goby::glog (or its per-thread stream in asynchronous mode)
+    if (os.rdbuf() == goby::glog.rdbuf())
+        goby::glog.add_payload(payload_);
+    else
+        os << payload_.str();
+}
+
+goby::util::logger::PayloadSetter
+goby::util::logger::debug_string(const google::protobuf::Message& msg)
+{
+    std::shared_ptr<google::protobuf::Message> copy(msg.New());
+    copy->CopyFrom(msg);
+    return debug_string(std::move(copy));
+}
+
+goby::util::logger::PayloadSetter
+goby::util::logger::debug_string(std::shared_ptr<const google::protobuf::Message> msg)
+{
+    Payload payload;
+    payload.message = std::move(msg);
+    return PayloadSetter(std::move(payload));
+}
+
+goby::util::logger::PayloadSetter goby::util::logger::hex_string(std::string bytes)
+{
+    Payload payload;
+    payload.bytes = std::move(bytes);
+    return PayloadSetter(std::move(payload));
+}
+
 std::ostream& goby::util::logger::basic_log_header(std::ostream& os, const std::string& group_name)
 {
-    os << "[ " << goby::time::str() << " ]";
+    return basic_log_header(os, group_name, goby::time::str());
+}
+
+std::ostream& goby::util::logger::basic_log_header(std::ostream& os, const std::string& group_name,
+                                                   const std::string& time_str)
+{
+    os << "[ " << time_str << " ]";
 
     if (!group_name.empty())
         os << " " << std::setfill(' ') << std::setw(15) << "{" << group_name << "}";
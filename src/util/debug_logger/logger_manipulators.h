@@ -26,11 +26,21 @@
 #define GOBY_UTIL_DEBUG_LOGGER_LOGGER_MANIPULATORS_H
 
 #include <iostream>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "term_color.h"
 
+namespace google
+{
+namespace protobuf
+{
+class Message;
+} // namespace protobuf
+} // namespace google
+
 namespace goby
 {
 namespace util
@@ -113,8 +123,51 @@ class GroupSetter
     std::string group_;
 };
 
+/// Argument inserted using debug_string() or hex_string() that goby::glog keeps in its raw form, only formatting it when written to a text stream
+struct Payload
+{
+    /// position in the line's text
+    std::size_t offset{0};
+    /// Protobuf message (formatted using ShortDebugString()), or if null ...
+    std::shared_ptr<const google::protobuf::Message> message;
+    /// ... raw bytes (formatted using hex_encode())
+    std::string bytes;
+
+    std::string str() const;
+};
+
+/// Returns text with each payload's str() inserted at its offset
+std::string render(const std::string& text, const std::vector<Payload>& payloads);
+
+/// Helper class for enabling the debug_string() and hex_string() manipulators
+class PayloadSetter
+{
+  public:
+    explicit PayloadSetter(Payload payload) : payload_(std::move(payload)) {}
+    void operator()(std::ostream& os) const;
+
+  private:
+    Payload payload_;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const PayloadSetter& ps)
+{
+    ps(os);
+    return (os);
+}
+
+/// \brief Insert msg.ShortDebugString(). When inserted into goby::glog the formatting is deferred until written to a text stream (and binary streams store the serialized message instead)
+PayloadSetter debug_string(const google::protobuf::Message& msg);
+/// \brief As above, sharing ownership of msg rather than copying it
+PayloadSetter debug_string(std::shared_ptr<const google::protobuf::Message> msg);
+/// \brief Insert goby::util::hex_encode(bytes), deferred as for debug_string()
+PayloadSetter hex_string(std::string bytes);
+
 /// used for non tty ostreams (everything but std::cout / std::cerr) as the header for every line
 std::ostream& basic_log_header(std::ostream& os, const std::string& group_name);
+/// as above, using a preformatted timestamp (time::str()) rather than the current time
+std::ostream& basic_log_header(std::ostream& os, const std::string& group_name,
+                               const std::string& time_str);
 
 std::ostream& operator<<(std::ostream& os, const Group& g);
 inline std::ostream& operator<<(std::ostream& os, const GroupSetter& gs)
@@ -30,6 +30,10 @@
 // TODO(tes): See if this dynamic cast is unncessary now
 std::ostream& goby::util::tcolor::add_escape_code(std::ostream& os, const std::string& esc_code)
 {
+    // per-thread stream used by goby::glog in asynchronous mode
+    if (os.rdbuf() == goby::glog.rdbuf())
+        return (os << esc_code);
+
     try
     {
         auto& flex = dynamic_cast<FlexOstream&>(os);
@@ -23,7 +23,11 @@
 
 #include <cmath>    // for floor
 #include <iostream> // for operator<<, basic_...
+#include <map>      // for map
+#include <mutex>    // for mutex, lock_guard
 #include <string>   // for operator+, basic_s...
+#include <thread>   // for thread::id
+#include <utility>  // for make_pair
 
 #include <boost/units/io.hpp>                     // for operator<<
 #include <boost/units/systems/si/plane_angle.hpp> // for plane_angle, radians
@@ -48,8 +52,37 @@
 #include <proj_api.h> // proj4
 #endif
 
+// Proj objects for each thread that has called a batch convert()
+class goby::util::UTMGeodesy::BatchProj
+{
+  public:
+    ~BatchProj()
+    {
+        for (const auto& thread_proj_p : proj)
+        {
+            const ThreadProj& thread_proj = thread_proj_p.second;
+#ifdef USE_PROJ4
+            pj_free(static_cast<projPJ>(thread_proj.pj4_utm));
+            pj_free(static_cast<projPJ>(thread_proj.pj4_latlong));
+            pj_ctx_free(static_cast<projCtx>(thread_proj.ctx));
+#else
+            proj_destroy(static_cast<PJ*>(thread_proj.pj6));
+            proj_context_destroy(static_cast<PJ_CONTEXT*>(thread_proj.ctx));
+#endif
+        }
+    }
+
+    std::mutex mutex;
+    std::map<std::thread::id, ThreadProj> proj;
+};
+
 goby::util::UTMGeodesy::UTMGeodesy(const LatLonPoint& origin)
-    : origin_geo_(origin), origin_zone_(0), pj4_utm_(nullptr), pj4_latlong_(nullptr), pj6_(nullptr)
+    : origin_geo_(origin),
+      origin_zone_(0),
+      pj4_utm_(nullptr),
+      pj4_latlong_(nullptr),
+      pj6_(nullptr),
+      batch_proj_(std::make_shared<BatchProj>())
 {
     // avoid -Wunused-private-field by assigning here
     pj4_utm_ = nullptr;
@@ -62,6 +95,8 @@ goby::util::UTMGeodesy::UTMGeodesy(const LatLonPoint& origin)
     std::stringstream proj_utm, proj_latlong;
     proj_utm << "+proj=utm +ellps=WGS84 +zone=" << origin_zone_;
     proj_latlong << "+proj=latlong +ellps=WGS84";
+    proj_utm_ = proj_utm.str();
+    proj_latlong_ = proj_latlong.str();
 
 #ifdef USE_PROJ4
     if (!(pj4_utm_ = pj_init_plus(proj_utm.str().c_str())))
@@ -198,3 +233,136 @@ goby::util::UTMGeodesy::LatLonPoint goby::util::UTMGeodesy::convert(const XYPoin
     return geo;
 #endif
 }
+
+const goby::util::UTMGeodesy::ThreadProj& goby::util::UTMGeodesy::thread_proj() const
+{
+    std::lock_guard<std::mutex> lock(batch_proj_->mutex);
+    auto it = batch_proj_->proj.find(std::this_thread::get_id());
+    if (it != batch_proj_->proj.end())
+        return it->second;
+
+    ThreadProj proj{nullptr, nullptr, nullptr, nullptr};
+#ifdef USE_PROJ4
+    proj.ctx = pj_ctx_alloc();
+    if (!(proj.pj4_utm = pj_init_plus_ctx(static_cast<projCtx>(proj.ctx), proj_utm_.c_str())))
+    {
+        pj_ctx_free(static_cast<projCtx>(proj.ctx));
+        throw(goby::Exception("Failed to initiate utm proj"));
+    }
+    if (!(proj.pj4_latlong =
+              pj_init_plus_ctx(static_cast<projCtx>(proj.ctx), proj_latlong_.c_str())))
+    {
+        pj_free(static_cast<projPJ>(proj.pj4_utm));
+        pj_ctx_free(static_cast<projCtx>(proj.ctx));
+        throw(goby::Exception("Failed to initiate latlong proj"));
+    }
+#else
+    proj.ctx = proj_context_create();
+    proj.pj6 = proj_create_crs_to_crs(static_cast<PJ_CONTEXT*>(proj.ctx), proj_latlong_.c_str(),
+                                      proj_utm_.c_str(), NULL);
+    if (!proj.pj6)
+    {
+        proj_context_destroy(static_cast<PJ_CONTEXT*>(proj.ctx));
+        throw(goby::Exception("Failed to create PJ object for projection transformation"));
+    }
+#endif
+
+    return batch_proj_->proj.insert(std::make_pair(std::this_thread::get_id(), proj)).first->second;
+}
+
+void goby::util::UTMGeodesy::convert(const LatLonPoint* geo, std::size_t n, XYPoint* utm) const
+{
+    if (n == 0)
+        return;
+
+    const ThreadProj& proj = thread_proj();
+    std::vector<double> x(n), y(n);
+#ifdef USE_PROJ4
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = boost::units::quantity<boost::units::si::plane_angle>(geo[i].lon) /
+               boost::units::si::radians;
+        y[i] = boost::units::quantity<boost::units::si::plane_angle>(geo[i].lat) /
+               boost::units::si::radians;
+    }
+
+    int err;
+    if ((err = pj_transform(static_cast<projPJ>(proj.pj4_latlong),
+                            static_cast<projPJ>(proj.pj4_utm), n, 1, x.data(), y.data(), nullptr)))
+        throw(goby::Exception(std::string("Failed to transform ") + std::to_string(n) +
+                              " (lat,lon) points, reason: " + pj_strerrno(err)));
+#else
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = boost::units::quantity<boost::units::degree::plane_angle>(geo[i].lon) /
+               boost::units::degree::degrees;
+        y[i] = boost::units::quantity<boost::units::degree::plane_angle>(geo[i].lat) /
+               boost::units::degree::degrees;
+    }
+
+    PJ* pj = static_cast<PJ*>(proj.pj6);
+    proj_errno_reset(pj);
+    std::size_t transformed = proj_trans_generic(pj, PJ_FWD, x.data(), sizeof(double), n, y.data(),
+                                                 sizeof(double), n, nullptr, 0, 0, nullptr, 0, 0);
+    int err = proj_errno(pj);
+    if (err || transformed != n)
+        throw(goby::Exception(std::string("Failed to transform ") + std::to_string(n) +
+                              " (lat,lon) points, reason: " +
+                              (err ? proj_errno_string(err) : "not all points transformed")));
+#endif
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        utm[i].x = x[i] * boost::units::si::meters - origin_utm_.x;
+        utm[i].y = y[i] * boost::units::si::meters - origin_utm_.y;
+    }
+}
+
+void goby::util::UTMGeodesy::convert(const XYPoint* utm, std::size_t n, LatLonPoint* geo) const
+{
+    if (n == 0)
+        return;
+
+    const ThreadProj& proj = thread_proj();
+    std::vector<double> x(n), y(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = (utm[i].x + origin_utm_.x) / boost::units::si::meters;
+        y[i] = (utm[i].y + origin_utm_.y) / boost::units::si::meters;
+    }
+
+#ifdef USE_PROJ4
+    int err;
+    if ((err = pj_transform(static_cast<projPJ>(proj.pj4_utm),
+                            static_cast<projPJ>(proj.pj4_latlong), n, 1, x.data(), y.data(),
+                            nullptr)))
+        throw(goby::Exception(std::string("Failed to transform ") + std::to_string(n) +
+                              " (x,y) points, reason: " + pj_strerrno(err)));
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        geo[i].lon = boost::units::quantity<boost::units::degree::plane_angle>(
+            x[i] * boost::units::si::radians);
+        geo[i].lat = boost::units::quantity<boost::units::degree::plane_angle>(
+            y[i] * boost::units::si::radians);
+    }
+#else
+    PJ* pj = static_cast<PJ*>(proj.pj6);
+    proj_errno_reset(pj);
+    std::size_t transformed = proj_trans_generic(pj, PJ_INV, x.data(), sizeof(double), n, y.data(),
+                                                 sizeof(double), n, nullptr, 0, 0, nullptr, 0, 0);
+    int err = proj_errno(pj);
+    if (err || transformed != n)
+        throw(goby::Exception(std::string("Failed to transform ") + std::to_string(n) +
+                              " (x,y) points, reason: " +
+                              (err ? proj_errno_string(err) : "not all points transformed")));
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        geo[i].lon = boost::units::quantity<boost::units::degree::plane_angle>(
+            x[i] * boost::units::degree::degrees);
+        geo[i].lat = boost::units::quantity<boost::units::degree::plane_angle>(
+            y[i] * boost::units::degree::degrees);
+    }
+#endif
+}
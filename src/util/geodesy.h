@@ -24,11 +24,15 @@
 #ifndef GOBY_UTIL_GEODESY_H
 #define GOBY_UTIL_GEODESY_H
 
+#include <cstddef> // for size_t
+#include <memory>  // for shared_ptr
+#include <string>  // for string
+#include <vector>  // for vector
+
 #include <boost/units/quantity.hpp>              // for quantity
 #include <boost/units/systems/angle/degrees.hpp> // for plane_angle
 #include <boost/units/systems/si/length.hpp>     // for length
 
-
 namespace goby
 {
 namespace util
@@ -58,6 +62,43 @@ class UTMGeodesy
     LatLonPoint convert(const XYPoint& utm) const;
     XYPoint convert(const LatLonPoint& geo) const;
 
+    /// \brief Convert n points with a single call to Proj (much faster than converting each point
+    /// individually for large numbers of points)
+    ///
+    /// The batch convert() functions may be called concurrently from multiple threads.
+    void convert(const XYPoint* utm, std::size_t n, LatLonPoint* geo) const;
+    void convert(const LatLonPoint* geo, std::size_t n, XYPoint* utm) const;
+
+    std::vector<LatLonPoint> convert(const std::vector<XYPoint>& utm) const
+    {
+        std::vector<LatLonPoint> geo(utm.size());
+        convert(utm.data(), utm.size(), geo.data());
+        return geo;
+    }
+
+    std::vector<XYPoint> convert(const std::vector<LatLonPoint>& geo) const
+    {
+        std::vector<XYPoint> utm(geo.size());
+        convert(geo.data(), geo.size(), utm.data());
+        return utm;
+    }
+
+  private:
+    // Proj contexts (and the objects created in them) cannot be shared between threads, so each
+    // thread that calls a batch convert() gets its own (created on first use)
+    struct ThreadProj
+    {
+        void* ctx;
+
+        // proj4
+        void *pj4_utm, *pj4_latlong;
+
+        // proj6+
+        void* pj6;
+    };
+    class BatchProj;
+    const ThreadProj& thread_proj() const;
+
   private:
     LatLonPoint origin_geo_;
     int origin_zone_;
@@ -67,7 +108,12 @@ class UTMGeodesy
     void *pj4_utm_, *pj4_latlong_;
 
     // proj6+
-    void *pj6_;
+    void* pj6_;
+
+    std::string proj_utm_, proj_latlong_;
+
+    // per-thread Proj objects for the batch convert() functions
+    std::shared_ptr<BatchProj> batch_proj_;
 };
 } // namespace util
 } // namespace goby
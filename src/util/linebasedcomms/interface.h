@@ -25,11 +25,12 @@
 #ifndef GOBY_UTIL_LINEBASEDCOMMS_INTERFACE_H
 #define GOBY_UTIL_LINEBASEDCOMMS_INTERFACE_H
 
-#include <deque>  // for deque
-#include <memory> // for shared_ptr
-#include <mutex>  // for mutex
-#include <string> // for string
-#include <thread> // for thread
+#include <condition_variable> // for condition_variable_any
+#include <deque>              // for deque
+#include <memory>             // for shared_ptr
+#include <mutex>              // for mutex
+#include <string>             // for string
+#include <thread>             // for thread
 
 #include <boost/bind/bind.hpp> // for bind_t, list_av_1<...
 
@@ -106,6 +107,10 @@ class LineBasedInterface
     void set_delimiter(const std::string& s) { delimiter_ = s; }
     std::string delimiter() const { return delimiter_; }
 
+    /// \brief mutex and condition variable signaled when new data arrives (for readers that sleep until data is available rather than polling readline())
+    std::shared_ptr<std::timed_mutex> poll_mutex() { return interthread_.poll_mutex(); }
+    std::shared_ptr<std::condition_variable_any> poll_cv() { return interthread_.cv(); }
+
   protected:
     virtual void do_start() = 0;
     virtual void do_close() = 0;
@@ -23,51 +23,26 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
+#include <cctype>  // for isspace, isxdigit
+#include <cerrno>  // for errno, ERANGE
+#include <cmath>   // for isinf
+#include <cstdlib> // for strtod, strtof, strtold
 #include <iomanip> // for operator<<, setfill, setw
 
-#include <boost/algorithm/string/trim.hpp> // for trim
-
-#include "goby/util/binary.h" // for hex_string2number
-
 #include "nmea_sentence.h"
 
 bool goby::util::NMEASentence::enforce_talker_length = true;
 
 goby::util::NMEASentence::NMEASentence(std::string s, strategy cs_strat /*= VALIDATE*/)
+    : NMEASentence(NMEASentenceView(s, cs_strat))
 {
-    bool found_csum = false;
-    unsigned int cs;
-    // Silently drop leading/trailing whitespace if present.
-    boost::trim(s);
-    // Basic error checks ($, empty)
-    if (s.empty())
-        throw bad_nmea_sentence("NMEASentence: no message provided.");
-    if (s[0] != '$' && s[0] != '!')
-        throw bad_nmea_sentence("NMEASentence: no $ or !: '" + s + "'.");
-    // Check if the checksum exists and is correctly placed, and strip it.
-    // If it's not correctly placed, we'll interpret it as part of message.
-    // NMEA spec doesn't seem to say that * is forbidden elsewhere? (should be)
-    if (s.size() > 3 && s.at(s.size() - 3) == '*')
-    {
-        std::string hex_csum = s.substr(s.size() - 2);
-        found_csum = util::hex_string2number(hex_csum, cs);
-        s = s.substr(0, s.size() - 3);
-    }
-    // If we require a checksum and haven't found one, fail.
-    if (cs_strat == REQUIRE and !found_csum)
-        throw bad_nmea_sentence("NMEASentence: no checksum: '" + s + "'.");
-    // If we found a bad checksum and we care, fail.
-    if (found_csum && (cs_strat == REQUIRE || cs_strat == VALIDATE))
-    {
-        unsigned char calc_cs = NMEASentence::checksum(s);
-        if (calc_cs != cs)
-            throw bad_nmea_sentence("NMEASentence: bad checksum: '" + s + "'.");
-    }
-    // Split string into parts.
-    boost::split(*(std::vector<std::string>*)this, s, boost::is_any_of(","));
-    // Validate talker size.
-    if (enforce_talker_length && this->front().size() != 6)
-        throw bad_nmea_sentence("NMEASentence: bad talker length '" + s + "'.");
+}
+
+goby::util::NMEASentence::NMEASentence(const NMEASentenceView& view)
+{
+    reserve(view.size());
+    for (std::size_t i = 0, n = view.size(); i < n; ++i)
+        std::vector<std::string>::emplace_back(view[i].data(), view[i].size());
 }
 
 unsigned char goby::util::NMEASentence::checksum(const std::string& s)
@@ -109,3 +84,182 @@ std::string goby::util::NMEASentence::message() const
     message << std::uppercase << std::hex << std::setfill('0') << std::setw(2) << unsigned(csum);
     return message.str();
 }
+
+namespace
+{
+unsigned hex_value(char c)
+{
+    return (c <= '9') ? c - '0' : (std::toupper(static_cast<unsigned char>(c)) - 'A' + 10);
+}
+
+// same as hex_string2number (std::istream >> std::hex >> unsigned): optional leading whitespace,
+// sign and "0x", then one or more hex digits (anything after them is ignored)
+bool parse_hex_checksum(const char* begin, const char* end, unsigned& value)
+{
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin))) ++begin;
+
+    bool negative = false;
+    if (begin != end && (*begin == '+' || *begin == '-'))
+        negative = (*begin++ == '-');
+
+    if (end - begin >= 2 && begin[0] == '0' && (begin[1] == 'x' || begin[1] == 'X'))
+        begin += 2;
+
+    if (begin == end || !std::isxdigit(static_cast<unsigned char>(*begin)))
+        return false;
+
+    value = 0;
+    for (; begin != end && std::isxdigit(static_cast<unsigned char>(*begin)); ++begin)
+        value = value * 16 + hex_value(*begin);
+    if (negative)
+        value = 0u - value;
+    return true;
+}
+
+template <typename T> bool parse_digits(const char* begin, const char* end, T& value)
+{
+    if (begin == end)
+        return false;
+
+    value = 0;
+    for (; begin != end; ++begin)
+    {
+        if (*begin < '0' || *begin > '9')
+            return false;
+        T digit = *begin - '0';
+        if (value > (std::numeric_limits<T>::max() - digit) / 10)
+            return false;
+        value = value * 10 + digit;
+    }
+    return true;
+}
+
+template <typename T, typename StrTo>
+bool parse_floating(boost::string_view field, T& value, StrTo strto)
+{
+    // reject what strto* accepts but lexical_cast doesn't (leading whitespace, hexadecimal)
+    if (field.empty() || std::isspace(static_cast<unsigned char>(field.front())) ||
+        field.find_first_of("xX") != boost::string_view::npos)
+        return false;
+
+    char* end = nullptr;
+    errno = 0;
+    value = strto(field.data(), &end);
+    return end == field.data() + field.size() && !(errno == ERANGE && std::isinf(value));
+}
+} // namespace
+
+void goby::util::NMEASentenceView::parse(boost::string_view s,
+                                         NMEASentence::strategy cs_strat /*= VALIDATE*/)
+{
+    clear();
+
+    // Silently drop leading/trailing whitespace if present.
+    const char* begin = s.data();
+    const char* end = begin + s.size();
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin))) ++begin;
+    while (end != begin && std::isspace(static_cast<unsigned char>(*(end - 1)))) --end;
+
+    // Basic error checks ($, empty)
+    if (begin == end)
+        throw bad_nmea_sentence("NMEASentence: no message provided.");
+    if (*begin != '$' && *begin != '!')
+        throw bad_nmea_sentence("NMEASentence: no $ or !: '" + std::string(begin, end) + "'.");
+
+    // Check if the checksum exists and is correctly placed, and strip it.
+    // If it's not correctly placed, we'll interpret it as part of message.
+    // If what follows the '*' is not a hex number, there is no checksum.
+    bool found_csum = false;
+    unsigned cs = 0;
+    if (end - begin > 3 && *(end - 3) == '*')
+    {
+        found_csum = parse_hex_checksum(end - 2, end, cs);
+        end -= 3;
+    }
+
+    // If we require a checksum and haven't found one, fail.
+    if (cs_strat == NMEASentence::REQUIRE && !found_csum)
+        throw bad_nmea_sentence("NMEASentence: no checksum: '" + std::string(begin, end) + "'.");
+
+    // Single pass to split the fields and compute the checksum (up to the first '*', as
+    // NMEASentence::checksum).
+    buffer_.assign(begin, end);
+    offsets_.push_back(0);
+    unsigned char calc_cs = 0;
+    bool in_csum = true;
+    for (std::size_t i = 1, n = buffer_.size(); i < n; ++i)
+    {
+        char& c = buffer_[i];
+        if (c == '*')
+            in_csum = false;
+        if (in_csum)
+            calc_cs ^= c;
+        if (c == ',')
+        {
+            c = '\0';
+            offsets_.push_back(i + 1);
+        }
+    }
+
+    // If we found a bad checksum and we care, fail.
+    if (found_csum && (cs_strat == NMEASentence::REQUIRE || cs_strat == NMEASentence::VALIDATE) &&
+        calc_cs != cs)
+    {
+        clear();
+        throw bad_nmea_sentence("NMEASentence: bad checksum: '" + std::string(begin, end) + "'.");
+    }
+
+    // Validate talker size.
+    if (NMEASentence::enforce_talker_length && front().size() != 6)
+    {
+        clear();
+        throw bad_nmea_sentence("NMEASentence: bad talker length '" + std::string(begin, end) +
+                                "'.");
+    }
+}
+
+bool goby::util::NMEASentenceView::from_chars(boost::string_view field, float& value)
+{
+    return parse_floating(field, value,
+                          [](const char* s, char** end) { return std::strtof(s, end); });
+}
+
+bool goby::util::NMEASentenceView::from_chars(boost::string_view field, double& value)
+{
+    return parse_floating(field, value,
+                          [](const char* s, char** end) { return std::strtod(s, end); });
+}
+
+bool goby::util::NMEASentenceView::from_chars(boost::string_view field, long double& value)
+{
+    return parse_floating(field, value,
+                          [](const char* s, char** end) { return std::strtold(s, end); });
+}
+
+bool goby::util::NMEASentenceView::from_chars(boost::string_view field, long long& value)
+{
+    unsigned long long magnitude;
+    bool negative;
+    if (!from_chars(field, magnitude, negative))
+        return false;
+
+    const auto max = static_cast<unsigned long long>(std::numeric_limits<long long>::max());
+    if (negative && magnitude == max + 1)
+        value = std::numeric_limits<long long>::min();
+    else if (magnitude <= max)
+        value = negative ? -static_cast<long long>(magnitude) : static_cast<long long>(magnitude);
+    else
+        return false;
+    return true;
+}
+
+bool goby::util::NMEASentenceView::from_chars(boost::string_view field,
+                                              unsigned long long& magnitude, bool& negative)
+{
+    const char* begin = field.data();
+    const char* end = begin + field.size();
+    negative = (begin != end && *begin == '-');
+    if (begin != end && (*begin == '-' || *begin == '+'))
+        ++begin;
+    return parse_digits(begin, end, magnitude);
+}
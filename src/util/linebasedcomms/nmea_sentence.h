@@ -25,15 +25,20 @@
 #ifndef GOBY_UTIL_LINEBASEDCOMMS_NMEA_SENTENCE_H
 #define GOBY_UTIL_LINEBASEDCOMMS_NMEA_SENTENCE_H
 
-#include <algorithm> // for max
-#include <memory>    // for allocator_trait...
-#include <sstream>   // for ostream
-#include <stdexcept> // for runtime_error
-#include <string>    // for string, operator+
-#include <vector>    // for vector
+#include <algorithm>   // for max
+#include <cstddef>     // for size_t
+#include <limits>      // for numeric_limits
+#include <memory>      // for allocator_trait...
+#include <sstream>     // for ostream
+#include <stdexcept>   // for runtime_error
+#include <string>      // for string, operator+
+#include <type_traits> // for enable_if, is_...
+#include <vector>      // for vector
 
 #include <boost/algorithm/string/classification.hpp> // for is_any_ofF, is_...
+#include <boost/algorithm/string/predicate.hpp>      // for iequals
 #include <boost/algorithm/string/split.hpp>          // for split
+#include <boost/utility/string_view.hpp>             // for string_view
 
 #include "goby/util/as.h" // for as
 
@@ -48,6 +53,8 @@ class bad_nmea_sentence : public std::runtime_error
     bad_nmea_sentence(const std::string& s) : std::runtime_error(s) {}
 };
 
+class NMEASentenceView;
+
 class NMEASentence : public std::vector<std::string>
 {
   public:
@@ -60,6 +67,8 @@ class NMEASentence : public std::vector<std::string>
 
     NMEASentence() = default;
     NMEASentence(std::string s, strategy cs_strat = VALIDATE);
+    // Copies the fields of an already parsed (and validated) sentence
+    explicit NMEASentence(const NMEASentenceView& view);
 
     // Bare message, no checksum or \r\n
     std::string message_no_cs() const;
@@ -102,6 +111,142 @@ class NMEASentence : public std::vector<std::string>
 
     static bool enforce_talker_length;
 };
+
+/// \brief Read-only, allocation-free alternative to NMEASentence for parsing.
+///
+/// The sentence is copied once into a buffer that is reused by subsequent calls to parse(), and the
+/// fields are referenced by their offset into this buffer. Validation (trimming, checksum strategy,
+/// talker length) and the exceptions thrown are the same as for NMEASentence. The string_views
+/// returned by at() are only valid until the next call to parse() or clear().
+class NMEASentenceView
+{
+  public:
+    NMEASentenceView() = default;
+    NMEASentenceView(boost::string_view s,
+                     NMEASentence::strategy cs_strat = NMEASentence::VALIDATE)
+    {
+        parse(s, cs_strat);
+    }
+
+    /// \brief Parse (and validate) a new sentence, replacing the current contents
+    ///
+    /// \throw bad_nmea_sentence if the sentence is invalid (the view is then empty)
+    void parse(boost::string_view s, NMEASentence::strategy cs_strat = NMEASentence::VALIDATE);
+
+    void clear()
+    {
+        buffer_.clear();
+        offsets_.clear();
+    }
+
+    // number of fields, including the first ("$CCCFG")
+    std::size_t size() const { return offsets_.size(); }
+    bool empty() const { return offsets_.empty(); }
+
+    boost::string_view operator[](std::size_t i) const
+    {
+        std::size_t end = (i + 1 < offsets_.size()) ? offsets_[i + 1] - 1 : buffer_.size();
+        return boost::string_view(buffer_.data() + offsets_[i], end - offsets_[i]);
+    }
+
+    boost::string_view at(std::size_t i) const
+    {
+        if (i >= size())
+            throw std::out_of_range("NMEASentenceView::at: no field " + std::to_string(i));
+        return (*this)[i];
+    }
+
+    boost::string_view front() const { return at(0); }
+
+    // first two talker (CC)
+    boost::string_view talker_id() const
+    {
+        return empty() ? boost::string_view() : front().substr(1, 2);
+    }
+
+    // last three (CFG)
+    boost::string_view sentence_id() const
+    {
+        return empty() ? boost::string_view() : front().substr(3);
+    }
+
+    /// \brief Convert field i, with the same results as NMEASentence::as
+    ///
+    /// Numeric fields are converted in place (without copying or streams): invalid or out of range
+    /// values return NaN (floating point) or the maximum value of the type (integers).
+    template <typename T> T as(std::size_t i) const { return field_as<T>(at(i)); }
+
+  private:
+    template <typename T>
+    using is_numeric_integer =
+        std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                         (sizeof(T) > 1) && !std::is_same<T, wchar_t>::value &&
+                                         !std::is_same<T, char16_t>::value &&
+                                         !std::is_same<T, char32_t>::value>;
+
+    template <typename T>
+    static typename std::enable_if<std::is_floating_point<T>::value, T>::type
+    field_as(boost::string_view field)
+    {
+        T value;
+        return from_chars(field, value) ? value : std::numeric_limits<T>::quiet_NaN();
+    }
+
+    template <typename T>
+    static
+        typename std::enable_if<is_numeric_integer<T>::value && std::is_signed<T>::value, T>::type
+        field_as(boost::string_view field)
+    {
+        long long value;
+        if (!from_chars(field, value) || value < std::numeric_limits<T>::min() ||
+            value > std::numeric_limits<T>::max())
+            return std::numeric_limits<T>::max();
+        return static_cast<T>(value);
+    }
+
+    template <typename T>
+    static
+        typename std::enable_if<is_numeric_integer<T>::value && std::is_unsigned<T>::value, T>::type
+        field_as(boost::string_view field)
+    {
+        unsigned long long magnitude;
+        bool negative;
+        if (!from_chars(field, magnitude, negative) || magnitude > std::numeric_limits<T>::max())
+            return std::numeric_limits<T>::max();
+        // negative values wrap around, as for lexical_cast
+        return negative ? static_cast<T>(-static_cast<T>(magnitude)) : static_cast<T>(magnitude);
+    }
+
+    template <typename T>
+    static typename std::enable_if<std::is_same<T, bool>::value, T>::type
+    field_as(boost::string_view field)
+    {
+        return boost::iequals(field, "true") || field == "1";
+    }
+
+    template <typename T>
+    static typename std::enable_if<!std::is_floating_point<T>::value &&
+                                       !is_numeric_integer<T>::value &&
+                                       !std::is_same<T, bool>::value,
+                                   T>::type
+    field_as(boost::string_view field)
+    {
+        return goby::util::as<T>(std::string(field.data(), field.size()));
+    }
+
+    // field must be followed by a NUL character (true of all the fields in buffer_)
+    static bool from_chars(boost::string_view field, float& value);
+    static bool from_chars(boost::string_view field, double& value);
+    static bool from_chars(boost::string_view field, long double& value);
+    static bool from_chars(boost::string_view field, long long& value);
+    static bool from_chars(boost::string_view field, unsigned long long& magnitude,
+                           bool& negative);
+
+    // sentence without checksum, with each ',' replaced by '\0'
+    std::string buffer_;
+    // offset of the start of each field in buffer_
+    std::vector<std::size_t> offsets_;
+};
 } // namespace util
 } // namespace goby
 
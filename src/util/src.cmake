@@ -1,6 +1,7 @@
 protobuf_generate_cpp(UTIL_PROTO_SRCS UTIL_PROTO_HDRS 
   util/protobuf/linebasedcomms.proto
   util/protobuf/debug_logger.proto
+  util/protobuf/debug_logger_binary.proto
   util/protobuf/ais.proto
   )
 
@@ -17,6 +18,7 @@ set(UTIL_SRC
   util/debug_logger/flex_ostream.cpp 
   util/debug_logger/logger_manipulators.cpp 
   util/debug_logger/term_color.cpp
+  util/debug_logger/binary_log.cpp
   ${UTIL_PROTO_SRCS} ${UTIL_PROTO_HDRS}
   )
 
@@ -22,8 +22,10 @@
 // along with Goby.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <algorithm>   // for copy, max, copy_backward, equal, set_d...
-#include <cstring>     // for memcpy, size_t
+#include <cctype>      // for isalnum
+#include <cstring>     // for memcpy, size_t, strchr
 #include <ostream>     // for endl, basic_ostream, basic_ostream<>::...
+#include <sstream>     // for stringstream
 #include <stdexcept>   // for runtime_error
 #include <type_traits> // for __success_type<>::type
 #include <utility>     // for pair, move
@@ -56,6 +58,163 @@ bool zmq_socket_recv(zmq::socket_t& socket, zmq::message_t& msg,
 #endif
 }
 
+// literal prefix of each top-level alternative of an (ECMAScript) regex, and whether the
+// alternative is entirely literal
+std::vector<std::pair<std::string, bool>> regex_literal_prefixes(const std::string& regex)
+{
+    std::vector<std::string> alternatives(1);
+    int depth = 0;
+    bool in_brackets = false;
+    for (std::size_t i = 0, n = regex.size(); i < n; ++i)
+    {
+        char c = regex[i];
+        if (c == '\\' && i + 1 < n)
+        {
+            alternatives.back() += regex.substr(i++, 2);
+            continue;
+        }
+
+        if (in_brackets)
+            in_brackets = (c != ']');
+        else if (c == '[')
+            in_brackets = true;
+        else if (c == '(')
+            ++depth;
+        else if (c == ')')
+            --depth;
+        else if (c == '|' && depth == 0)
+        {
+            alternatives.emplace_back();
+            continue;
+        }
+        alternatives.back() += c;
+    }
+
+    // unbalanced, so we may have missed an alternative
+    if (depth != 0 || in_brackets)
+        return {std::make_pair(std::string(), false)};
+
+    std::vector<std::pair<std::string, bool>> prefixes;
+    for (const auto& alternative : alternatives)
+    {
+        std::string prefix;
+        bool complete = true;
+        std::size_t i = (!alternative.empty() && alternative[0] == '^') ? 1 : 0;
+        for (std::size_t n = alternative.size(); i < n; ++i)
+        {
+            char c = alternative[i];
+            std::size_t next = i + 1;
+            char literal = c;
+            if (c == '\\')
+            {
+                // escaped letters and digits are character classes, back references, etc.
+                if (next == n || std::isalnum(alternative[next]))
+                {
+                    complete = false;
+                    break;
+                }
+                literal = alternative[next++];
+            }
+            else if (c == '$' && next == n)
+            {
+                break;
+            }
+            else if (std::strchr(".[](){}*+?|^$", c))
+            {
+                complete = false;
+                break;
+            }
+
+            // a quantifier applies to this literal
+            if (next < n && std::strchr("*?{+", alternative[next]))
+            {
+                if (alternative[next] == '+')
+                    prefix += literal;
+                complete = false;
+                break;
+            }
+
+            prefix += literal;
+            i = next - 1;
+        }
+        prefixes.emplace_back(prefix, complete);
+    }
+    return prefixes;
+}
+
+std::vector<std::string> goby::zeromq::regex_subscription_filters(const std::set<int>& schemes,
+                                                                  const std::string& type_regex,
+                                                                  const std::string& group_regex)
+{
+    // identifiers are "/group/scheme/type/process/thread/"
+    std::set<std::string> filters;
+    bool all_schemes = schemes.count(goby::middleware::MarshallingScheme::ALL_SCHEMES);
+    for (const auto& group : regex_literal_prefixes(group_regex))
+    {
+        if (!group.second)
+        {
+            filters.insert("/" + group.first);
+        }
+        else if (all_schemes)
+        {
+            filters.insert("/" + group.first + "/");
+        }
+        else
+        {
+            for (int scheme : schemes)
+            {
+                for (const auto& type : regex_literal_prefixes(type_regex))
+                    filters.insert("/" + group.first + "/" + identifier_part_to_string(scheme) +
+                                   "/" + type.first + (type.second ? "/" : ""));
+            }
+        }
+    }
+
+    // sorted, so any filter covered by a shorter one directly follows it (or another it covers)
+    std::vector<std::string> result;
+    for (const auto& filter : filters)
+    {
+        if (result.empty() || filter.compare(0, result.back().size(), result.back()) != 0)
+            result.push_back(filter);
+    }
+    return result;
+}
+
+std::string goby::zeromq::make_trace(std::chrono::steady_clock::time_point publish_time)
+{
+    std::stringstream ss;
+    ss << 't' << std::hex
+       << std::chrono::duration_cast<std::chrono::nanoseconds>(publish_time.time_since_epoch())
+              .count();
+    return ss.str();
+}
+
+bool goby::zeromq::parse_trace(const std::string& frame,
+                               std::chrono::steady_clock::time_point& publish_time)
+{
+    auto null_pos = frame.find('\0');
+    if (null_pos == std::string::npos)
+        return false;
+
+    // identifiers end in "/", so the trace (if any) follows the last slash
+    auto slash_pos = frame.rfind('/', null_pos);
+    if (slash_pos == std::string::npos || slash_pos + 2 >= null_pos || frame[slash_pos + 1] != 't')
+        return false;
+
+    try
+    {
+        std::chrono::nanoseconds since_epoch(
+            std::stoull(frame.substr(slash_pos + 2, null_pos - slash_pos - 2), nullptr, 16));
+        publish_time = std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(since_epoch));
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
 void goby::zeromq::setup_socket(zmq::socket_t& socket, const protobuf::Socket& cfg)
 {
     int send_hwm = cfg.send_queue_size();
@@ -96,7 +255,9 @@ void goby::zeromq::setup_socket(zmq::socket_t& socket, const protobuf::Socket& c
 //
 
 goby::zeromq::InterProcessPortalMainThread::InterProcessPortalMainThread(zmq::context_t& context)
-    : control_socket_(context, ZMQ_PAIR), publish_socket_(context, ZMQ_PUB)
+    : control_socket_(context, ZMQ_PAIR),
+      publish_socket_(context, ZMQ_PUB),
+      discrete_event_socket_(context, ZMQ_PUB)
 {
     control_socket_.bind("inproc://control");
 }
@@ -120,6 +281,8 @@ bool goby::zeromq::InterProcessPortalMainThread::recv(protobuf::InprocControl* c
 void goby::zeromq::InterProcessPortalMainThread::set_publish_cfg(const protobuf::Socket& cfg)
 {
     setup_socket(publish_socket_, cfg);
+    if (goby::time::DiscreteEventClock::enabled())
+        setup_socket(discrete_event_socket_, cfg);
     have_pubsub_sockets_ = true;
 }
 
@@ -221,6 +384,16 @@ void goby::zeromq::InterProcessPortalMainThread::reader_shutdown()
     send_control_msg(control);
 }
 
+void goby::zeromq::InterProcessPortalMainThread::publish_discrete_event_state(
+    const std::string& identifier, const protobuf::ManagerRequest& req)
+{
+    auto size = req.ByteSizeLong();
+    zmq::message_t msg(identifier.size() + size);
+    memcpy(msg.data(), identifier.data(), identifier.size());
+    req.SerializeToArray(static_cast<char*>(msg.data()) + identifier.size(), size);
+    discrete_event_socket_.send(msg, zmq_send_flags_none);
+}
+
 void goby::zeromq::InterProcessPortalMainThread::send_control_msg(
     const protobuf::InprocControl& control)
 {
@@ -235,13 +408,15 @@ void goby::zeromq::InterProcessPortalMainThread::send_control_msg(
 //
 goby::zeromq::InterProcessPortalReadThread::InterProcessPortalReadThread(
     const protobuf::InterProcessPortalConfig& cfg, zmq::context_t& context,
-    std::atomic<bool>& alive, std::shared_ptr<std::condition_variable_any> poller_cv)
+    std::atomic<bool>& alive, std::shared_ptr<std::condition_variable_any> poller_cv,
+    std::shared_ptr<std::timed_mutex> poller_mutex)
     : cfg_(cfg),
       control_socket_(context, ZMQ_PAIR),
       subscribe_socket_(context, ZMQ_SUB),
       manager_socket_(context, ZMQ_REQ),
       alive_(alive),
-      poller_cv_(std::move(poller_cv))
+      poller_cv_(std::move(poller_cv)),
+      poller_mutex_(std::move(poller_mutex))
 {
     poll_items_.resize(NUMBER_SOCKETS);
     poll_items_[SOCKET_CONTROL] = {(void*)control_socket_, 0, ZMQ_POLLIN, 0};
@@ -291,10 +466,10 @@ void goby::zeromq::InterProcessPortalReadThread::run()
 
                 send_manager_request(req);
 
-                auto start = goby::time::SystemClock::now();
+                auto start = std::chrono::steady_clock::now();
                 while (!have_pubsub_sockets_ &&
                        (start + std::chrono::seconds(cfg_.manager_timeout_seconds()) >
-                        goby::time::SystemClock::now()))
+                        std::chrono::steady_clock::now()))
                     poll(cfg_.manager_timeout_seconds() * 1000);
 
                 if (!have_pubsub_sockets_)
@@ -302,19 +477,31 @@ void goby::zeromq::InterProcessPortalReadThread::run()
                         goby::glog << "No response from gobyd: " << cfg_.ShortDebugString()
                                    << std::endl;
             }
-            else if (hold_ && goby::time::SystemClock::now() >= next_hold_state_request_time_)
+            else if (hold_state_acknowledged_)
             {
-                goby::glog.is_debug3() &&
-                    goby::glog << "InterProcessPortalReadThread requesting hold state" << std::endl;
-                protobuf::InprocControl control;
-                control.set_type(protobuf::InprocControl::REQUEST_HOLD_STATE);
-                send_control_msg(control);
-                next_hold_state_request_time_ =
-                    goby::time::SystemClock::now() + hold_state_request_period_;
+                // the Manager will push the release of the hold
+                poll();
             }
             else
             {
-                poll(10);
+                auto now = std::chrono::steady_clock::now();
+                if (now >= next_hold_state_request_time_)
+                {
+                    goby::glog.is_debug3() &&
+                        goby::glog << "InterProcessPortalReadThread requesting hold state"
+                                   << std::endl;
+                    protobuf::InprocControl control;
+                    control.set_type(protobuf::InprocControl::REQUEST_HOLD_STATE);
+                    send_control_msg(control);
+                    next_hold_state_request_time_ = now + hold_state_request_period_;
+                    hold_state_request_period_ =
+                        std::min(2 * hold_state_request_period_, max_hold_state_request_period_);
+                }
+
+                poll(std::chrono::duration_cast<std::chrono::milliseconds>(
+                         next_hold_state_request_time_ - now)
+                         .count() +
+                     1);
             }
         }
     }
@@ -416,6 +603,8 @@ void goby::zeromq::InterProcessPortalReadThread::control_data(const zmq::message
                 glog.is(DEBUG3) && glog << "InterProcessPortal**Read**Thread: Hold off"
                                         << std::endl;
             hold_ = control_msg.hold();
+            // the main thread only notifies us upon a response from the Manager
+            hold_state_acknowledged_ = true;
             break;
         }
 
@@ -465,6 +654,16 @@ void goby::zeromq::InterProcessPortalReadThread::send_control_msg(
     zmq::message_t zmq_control_msg(control.ByteSizeLong());
     control.SerializeToArray((char*)zmq_control_msg.data(), zmq_control_msg.size());
     control_socket_.send(zmq_control_msg, zmq_send_flags_none);
+
+    if (goby::time::DiscreteEventClock::enabled())
+    {
+        // lock to ensure the main thread isn't between polling and waiting as idle, where the
+        // notification would be lost and the simulation time advanced with this data pending
+        {
+            std::lock_guard<std::timed_mutex> lock(*poller_mutex_);
+        }
+        goby::time::DiscreteEventClock::wake(poller_cv_.get());
+    }
     poller_cv_->notify_all();
 }
 
@@ -600,10 +799,20 @@ void goby::zeromq::Manager::run()
     {
         while (true)
         {
+            // wake up in time to advance the discrete event simulation time
+            long timeout_ms = -1;
+            if (discrete_event_advance_time_ != std::chrono::steady_clock::time_point::max())
+            {
+                auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                    discrete_event_advance_time_ - std::chrono::steady_clock::now());
+                // round up
+                timeout_ms = std::max<long>(0, (remaining.count() + 999) / 1000);
+            }
+
 #ifdef USE_OLD_CPPZMQ_POLL
-            zmq::poll(&poll_items_[0], poll_items_.size(), -1);
+            zmq::poll(&poll_items_[0], poll_items_.size(), timeout_ms);
 #else
-            zmq::poll(&poll_items_[0], poll_items_.size(), std::chrono::milliseconds(-1));
+            zmq::poll(&poll_items_[0], poll_items_.size(), std::chrono::milliseconds(timeout_ms));
 #endif
 
             for (int i = 0, n = poll_items_.size(); i < n; ++i)
@@ -637,22 +846,26 @@ void goby::zeromq::Manager::run()
                                                                              request.size() -
                                                                              (null_delim_it + 1));
 
-                            auto pb_response = handle_request(pb_request);
-
-                            glog.is_debug3() && glog << "Manager:: Sending response: "
-                                                     << pb_response.DebugString() << std::endl;
-
-                            auto size = pb_response.ByteSizeLong();
-                            zmq::message_t reply(zmq_filter_rep_.size() + size);
-                            memcpy(reply.data(), zmq_filter_rep_.data(), zmq_filter_rep_.size());
-                            pb_response.SerializeToArray(
-                                static_cast<char*>(reply.data()) + zmq_filter_rep_.size(), size);
-
-                            publish_socket_->send(reply, zmq_send_flags_none);
+                            if (pb_request.request() == protobuf::REPORT_DISCRETE_EVENT_STATE)
+                            {
+                                handle_discrete_event_report(pb_request);
+                            }
+                            else
+                            {
+                                publish_response(handle_request(pb_request));
+                                check_hold_state();
+                            }
+
+                            // the hold may have been released or a client became idle
+                            if (!discrete_event_clients_.empty())
+                                check_discrete_event();
                             break;
                     }
                 }
             }
+
+            if (std::chrono::steady_clock::now() >= discrete_event_advance_time_)
+                advance_discrete_event();
         }
     }
     catch (const zmq::error_t& e)
@@ -684,22 +897,193 @@ goby::zeromq::Manager::handle_request(const protobuf::ManagerRequest& pb_request
     pb_response.set_client_name(pb_request.client_name());
     pb_response.set_client_pid(pb_request.client_pid());
 
+    auto now = std::chrono::steady_clock::now();
+    std::string key = pb_request.client_name() + "/" + std::to_string(pb_request.client_pid());
+
     if (pb_request.request() == protobuf::PROVIDE_PUB_SUB_SOCKETS)
     {
         *pb_response.mutable_subscribe_socket() = subscribe_socket_cfg();
         *pb_response.mutable_publish_socket() = publish_socket_cfg();
+
+        auto& startup = client_startup_[key];
+        startup.client_name = pb_request.client_name();
+        startup.client_pid = pb_request.client_pid();
+        startup.sockets_requested = now;
     }
     else if (pb_request.request() == protobuf::PROVIDE_HOLD_STATE)
     {
         if (pb_request.ready() && required_clients_.count(pb_request.client_name()))
             reported_clients_.insert(pb_request.client_name());
 
+        auto& startup = client_startup_[key];
+        startup.client_name = pb_request.client_name();
+        startup.client_pid = pb_request.client_pid();
+        if (startup.hold_state_requested == std::chrono::steady_clock::time_point())
+            startup.hold_state_requested = now;
+        if (pb_request.ready() && startup.ready == std::chrono::steady_clock::time_point())
+            startup.ready = now;
+
         pb_response.set_hold(hold_state());
+
+        // joined after the hold was released
+        if (!hold_)
+        {
+            add_startup_latency(&pb_response, startup, now);
+            glog.is_verbose() && glog << "(Manager) Client " << key
+                                      << " joined after the hold was released: "
+                                      << pb_response.startup_latency(0).ShortDebugString()
+                                      << std::endl;
+            client_startup_.erase(key);
+        }
     }
 
     return pb_response;
 }
 
+void goby::zeromq::Manager::publish_response(const protobuf::ManagerResponse& pb_response)
+{
+    glog.is_debug3() && glog << "Manager:: Sending response: " << pb_response.DebugString()
+                             << std::endl;
+
+    auto size = pb_response.ByteSizeLong();
+    zmq::message_t reply(zmq_filter_rep_.size() + size);
+    memcpy(reply.data(), zmq_filter_rep_.data(), zmq_filter_rep_.size());
+    pb_response.SerializeToArray(static_cast<char*>(reply.data()) + zmq_filter_rep_.size(), size);
+
+    publish_socket_->send(reply, zmq_send_flags_none);
+}
+
+void goby::zeromq::Manager::check_hold_state()
+{
+    if (!hold_ || hold_state())
+        return;
+
+    hold_ = false;
+    auto now = std::chrono::steady_clock::now();
+
+    // push to all the clients, rather than waiting for their next request
+    protobuf::ManagerResponse pb_response;
+    pb_response.set_request(protobuf::PROVIDE_HOLD_STATE);
+    pb_response.set_client_name(cfg_.client_name());
+    pb_response.set_client_pid(getpid());
+    pb_response.set_hold(false);
+    pb_response.set_all_clients(true);
+
+    for (const auto& client_pair : client_startup_)
+        add_startup_latency(&pb_response, client_pair.second, now);
+    // clients that connect later are reported individually
+    client_startup_.clear();
+
+    if (glog.is_verbose())
+    {
+        glog << "(Manager) Hold released. Startup latency of each client (microseconds after "
+                "requesting sockets):"
+             << std::endl;
+        for (const auto& latency : pb_response.startup_latency())
+            glog << "\t" << latency.ShortDebugString() << std::endl;
+    }
+
+    publish_response(pb_response);
+}
+
+void goby::zeromq::Manager::add_startup_latency(protobuf::ManagerResponse* pb_response,
+                                                const ClientStartup& startup,
+                                                std::chrono::steady_clock::time_point released)
+{
+    auto& latency = *pb_response->add_startup_latency();
+    latency.set_client_name(startup.client_name);
+    latency.set_client_pid(startup.client_pid);
+
+    // e.g. the Manager was restarted after this client connected
+    if (startup.sockets_requested == std::chrono::steady_clock::time_point())
+        return;
+
+    auto us = [&](std::chrono::steady_clock::time_point t) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(t - startup.sockets_requested)
+            .count();
+    };
+    if (startup.hold_state_requested != std::chrono::steady_clock::time_point())
+        latency.set_connected(us(startup.hold_state_requested));
+    if (startup.ready != std::chrono::steady_clock::time_point())
+        latency.set_ready(us(startup.ready));
+    latency.set_released(us(released));
+}
+
+void goby::zeromq::Manager::handle_discrete_event_report(const protobuf::ManagerRequest& pb_request)
+{
+    glog.is_debug3() && glog << "(Manager) Received discrete event report: "
+                             << pb_request.ShortDebugString() << std::endl;
+
+    const auto& state = pb_request.discrete_event();
+    std::string key = pb_request.client_name() + "/" + std::to_string(pb_request.client_pid());
+
+    if (!state.participating())
+    {
+        // client is disconnecting
+        discrete_event_clients_.erase(key);
+        client_startup_.erase(key);
+        return;
+    }
+
+    auto& client = discrete_event_clients_[key];
+    // ignore reports that arrive out of order
+    if (client.sequence != 0 && state.sequence() <= client.sequence)
+        return;
+
+    client.sequence = state.sequence();
+    client.idle = state.idle();
+    client.next_deadline =
+        state.has_next_deadline()
+            ? goby::time::SystemClock::time_point(std::chrono::microseconds(state.next_deadline()))
+            : goby::time::SystemClock::time_point::max();
+}
+
+void goby::zeromq::Manager::check_discrete_event()
+{
+    bool all_idle = std::all_of(discrete_event_clients_.begin(), discrete_event_clients_.end(),
+                                [](const std::pair<const std::string, DiscreteEventClient>& c) {
+                                    return c.second.idle;
+                                });
+
+    // (re)start the settle time on every change so that messages in flight are delivered first
+    if (all_idle && !hold_state())
+        discrete_event_advance_time_ = std::chrono::steady_clock::now() +
+                                       goby::time::SimulatorSettings::discrete_event_settle_time;
+    else
+        discrete_event_advance_time_ = std::chrono::steady_clock::time_point::max();
+}
+
+void goby::zeromq::Manager::advance_discrete_event()
+{
+    discrete_event_advance_time_ = std::chrono::steady_clock::time_point::max();
+
+    auto next_deadline = goby::time::SystemClock::time_point::max();
+    for (const auto& c : discrete_event_clients_)
+        next_deadline = std::min(next_deadline, c.second.next_deadline);
+
+    // all clients are waiting for data only
+    if (next_deadline == goby::time::SystemClock::time_point::max())
+        return;
+
+    discrete_event_time_ = std::max(discrete_event_time_, next_deadline);
+
+    // these will now wake up, so wait for them to report idle again
+    for (auto& c : discrete_event_clients_)
+    {
+        if (c.second.next_deadline <= discrete_event_time_)
+            c.second.idle = false;
+    }
+
+    protobuf::ManagerResponse pb_response;
+    pb_response.set_request(protobuf::REPORT_DISCRETE_EVENT_STATE);
+    pb_response.set_client_name(cfg_.client_name());
+    pb_response.set_client_pid(getpid());
+    pb_response.set_discrete_event_time(std::chrono::duration_cast<std::chrono::microseconds>(
+                                            discrete_event_time_.time_since_epoch())
+                                            .count());
+    publish_response(pb_response);
+}
+
 goby::zeromq::protobuf::Socket goby::zeromq::Manager::publish_socket_cfg()
 {
     protobuf::Socket publish_socket;
@@ -32,8 +32,10 @@
 #include <deque>              // for deque
 #include <functional>         // for func...
 #include <iosfwd>             // for size_t
+#include <map>                // for map
 #include <memory>             // for shar...
 #include <mutex>              // for time...
+#include <random>             // for mins...
 #include <set>                // for set
 #include <string>             // for string
 #include <thread>             // for get_id
@@ -47,15 +49,18 @@
 #include <zmq.hpp> // for sock...
 
 #include "goby/middleware/common.h"                             // for thre...
+#include "goby/middleware/coroner/profiler.h"                   // for Call...
 #include "goby/middleware/group.h"                              // for Group
 #include "goby/middleware/marshalling/interface.h"              // for Seri...
 #include "goby/middleware/protobuf/serializer_transporter.pb.h" // for Seri...
 #include "goby/middleware/protobuf/transporter_config.pb.h"     // for Tran...
 #include "goby/middleware/transport/interface.h"                // for Poll...
 #include "goby/middleware/transport/interprocess.h"             // for Inte...
+#include "goby/middleware/transport/metrics.h"                  // for Tran...
 #include "goby/middleware/transport/null.h"                     // for Null...
 #include "goby/middleware/transport/serialization_handlers.h"   // for Seri...
 #include "goby/middleware/transport/subscriber.h"               // for Subs...
+#include "goby/time/discrete_event.h"                           // for Disc...
 #include "goby/time/system_clock.h"                             // for Syst...
 #include "goby/util/debug_logger/flex_ostream.h"                // for Flex...
 #include "goby/util/debug_logger/flex_ostreambuf.h"             // for lock
@@ -157,6 +162,21 @@ make_identifier(const std::string& type_name, int scheme, const std::string& gro
     }
 }
 
+/// \brief Returns the ZeroMQ subscription filters (identifier prefixes) for a regex subscription
+///
+/// Literal prefixes of the group regex (and, for fully literal groups, of the type regex) narrow the filters, so that messages that cannot match are dropped by ZeroMQ (at the publisher) rather than after the regex match. Falls back to "/" (all messages) when no literal prefix can be derived.
+std::vector<std::string> regex_subscription_filters(const std::set<int>& schemes,
+                                                    const std::string& type_regex,
+                                                    const std::string& group_regex);
+
+/// \brief Returns the trace added to the end of the identifier (after the thread, before the '\\0') of sampled publications (see InterProcessPortalConfig::trace_sample_rate)
+///
+/// The trace is "t" followed by the publish time (std::chrono::steady_clock, that is, CLOCK_MONOTONIC on Linux, so only comparable between processes on the same host) in hexadecimal nanoseconds. Receivers that don't use the trace ignore it, as it follows the last identifier component.
+std::string make_trace(std::chrono::steady_clock::time_point publish_time);
+
+/// \brief Parses the trace (if any) from a received frame (identifier, '\\0', data)
+bool parse_trace(const std::string& frame, std::chrono::steady_clock::time_point& publish_time);
+
 #ifdef USE_OLD_ZMQ_CPP_API
 using zmq_recv_flags_type = int;
 using zmq_send_flags_type = int;
@@ -175,9 +195,11 @@ class InterProcessPortalMainThread
 #ifdef USE_OLD_CPPZMQ_SETSOCKOPT
         control_socket_.setsockopt(ZMQ_LINGER, 0);
         publish_socket_.setsockopt(ZMQ_LINGER, 0);
+        discrete_event_socket_.setsockopt(ZMQ_LINGER, 0);
 #else
         control_socket_.set(zmq::sockopt::linger, 0);
         publish_socket_.set(zmq::sockopt::linger, 0);
+        discrete_event_socket_.set(zmq::sockopt::linger, 0);
 #endif
     }
 
@@ -197,6 +219,10 @@ class InterProcessPortalMainThread
     void unsubscribe(const std::string& identifier);
     void reader_shutdown();
 
+    /// \brief Publish a REPORT_DISCRETE_EVENT_STATE request to the Manager. Unlike the other methods, this is called from any thread (but never concurrently) and uses its own socket.
+    void publish_discrete_event_state(const std::string& identifier,
+                                      const protobuf::ManagerRequest& req);
+
     std::deque<protobuf::InprocControl>& control_buffer() { return control_buffer_; }
     void send_control_msg(const protobuf::InprocControl& control);
 
@@ -204,6 +230,7 @@ class InterProcessPortalMainThread
   private:
     zmq::socket_t control_socket_;
     zmq::socket_t publish_socket_;
+    zmq::socket_t discrete_event_socket_;
     bool hold_{true};
     bool have_pubsub_sockets_{false};
 
@@ -220,7 +247,8 @@ class InterProcessPortalReadThread
   public:
     InterProcessPortalReadThread(const protobuf::InterProcessPortalConfig& cfg,
                                  zmq::context_t& context, std::atomic<bool>& alive,
-                                 std::shared_ptr<std::condition_variable_any> poller_cv);
+                                 std::shared_ptr<std::condition_variable_any> poller_cv,
+                                 std::shared_ptr<std::timed_mutex> poller_mutex);
     void run();
     ~InterProcessPortalReadThread()
     {
@@ -250,6 +278,7 @@ class InterProcessPortalReadThread
     zmq::socket_t manager_socket_;
     std::atomic<bool>& alive_;
     std::shared_ptr<std::condition_variable_any> poller_cv_;
+    std::shared_ptr<std::timed_mutex> poller_mutex_;
     std::vector<zmq::pollitem_t> poll_items_;
     enum
     {
@@ -264,11 +293,18 @@ class InterProcessPortalReadThread
     bool have_pubsub_sockets_{false};
     bool hold_{true};
     bool manager_waiting_for_reply_{false};
-
-    goby::time::SystemClock::time_point next_hold_state_request_time_{
-        goby::time::SystemClock::now()};
-    const goby::time::SystemClock::duration hold_state_request_period_{
-        std::chrono::milliseconds(100)};
+    // the Manager has responded to our hold state request, so it will push the release of the hold
+    bool hold_state_acknowledged_{false};
+
+    // real time, as the simulation time may not be advancing (discrete event) during the hold
+    std::chrono::steady_clock::time_point next_hold_state_request_time_{
+        std::chrono::steady_clock::now()};
+    // the request (or response) may be lost while the pub/sub sockets are connecting, so retry
+    // with exponential backoff until acknowledged
+    std::chrono::steady_clock::duration hold_state_request_period_{
+        std::chrono::milliseconds(10)};
+    const std::chrono::steady_clock::duration max_hold_state_request_period_{
+        std::chrono::seconds(1)};
 };
 
 template <typename InnerTransporter,
@@ -285,7 +321,8 @@ class InterProcessPortalImplementation
         : cfg_(cfg),
           zmq_context_(cfg.zeromq_number_io_threads()),
           zmq_main_(zmq_context_),
-          zmq_read_thread_(cfg_, zmq_context_, zmq_alive_, middleware::PollerInterface::cv())
+          zmq_read_thread_(cfg_, zmq_context_, zmq_alive_, middleware::PollerInterface::cv(),
+                           middleware::PollerInterface::poll_mutex())
     {
         _init();
     }
@@ -296,13 +333,23 @@ class InterProcessPortalImplementation
           cfg_(cfg),
           zmq_context_(cfg.zeromq_number_io_threads()),
           zmq_main_(zmq_context_),
-          zmq_read_thread_(cfg_, zmq_context_, zmq_alive_, middleware::PollerInterface::cv())
+          zmq_read_thread_(cfg_, zmq_context_, zmq_alive_, middleware::PollerInterface::cv(),
+                           middleware::PollerInterface::poll_mutex())
     {
         _init();
     }
 
     ~InterProcessPortalImplementation()
     {
+        if (time::DiscreteEventClock::enabled())
+        {
+            // no further calls to the handler after this returns
+            time::DiscreteEventClock::set_state_handler(nullptr);
+            if (discrete_event_reporting_)
+                _publish_discrete_event_state(
+                    {false, time::DiscreteEventClock::time_point::max(), 0}, false);
+        }
+
         if (zmq_thread_)
         {
             zmq_main_.reader_shutdown();
@@ -311,7 +358,16 @@ class InterProcessPortalImplementation
     }
 
     /// \brief When using hold functionality, call when the process is ready to receive publications (typically done after most or all subscribe calls)
-    void ready() { ready_ = true; }
+    void ready()
+    {
+        if (!ready_)
+        {
+            ready_ = true;
+            // tell the Manager now, rather than waiting for the next request
+            if (zmq_main_.hold_state())
+                _publish_hold_state_request();
+        }
+    }
 
     /// \brief When using hold functionality, returns whether the system is holding (true) and thus waiting for all processes to connect and be ready, or running (false).
     bool hold_state() { return zmq_main_.hold_state(); }
@@ -324,6 +380,8 @@ class InterProcessPortalImplementation
     {
         goby::glog.set_lock_action(goby::util::logger_lock::lock);
 
+        startup_time_ = std::chrono::steady_clock::now();
+
         // start zmq read thread
         zmq_thread_ = std::make_unique<std::thread>([this]() { zmq_read_thread_.run(); });
 
@@ -342,6 +400,24 @@ class InterProcessPortalImplementation
             }
         }
 
+        goby::glog.is_debug2() && goby::glog << "Received pub/sub sockets from gobyd after "
+                                             << _ms_since_startup() << " ms" << std::endl;
+
+        if (time::DiscreteEventClock::enabled())
+        {
+            discrete_event_identifier_ =
+                _make_fully_qualified_identifier(
+                    middleware::SerializerParserHelper<
+                        protobuf::ManagerRequest,
+                        middleware::MarshallingScheme::PROTOBUF>::type_name(),
+                    middleware::MarshallingScheme::PROTOBUF, groups::manager_request) +
+                '\0';
+
+            // the Manager (gobyd) advances the time, once all clients are idle. Until the hold
+            // is released (and so the sockets are connected) reports are dropped
+            _set_discrete_event_state_handler();
+        }
+
         //
         // Handle hold state request/response using pub sub so that we ensure
         // publishing and subscribe is completely functional before releasing the hold
@@ -351,14 +427,34 @@ class InterProcessPortalImplementation
                 goby::glog.is_debug3() && goby::glog << "Received ManagerResponse: "
                                                      << response->ShortDebugString() << std::endl;
                 if (response->request() == protobuf::PROVIDE_HOLD_STATE &&
-                    response->client_pid() == getpid() &&
-                    response->client_name() == cfg_.client_name())
+                    (response->all_clients() || (response->client_pid() == getpid() &&
+                                                 response->client_name() == cfg_.client_name())))
                 {
+                    bool was_held = zmq_main_.hold_state();
                     zmq_main_.set_hold_state(response->hold());
+                    if (was_held && zmq_main_.publish_ready())
+                        goby::glog.is_verbose() &&
+                            goby::glog << "Hold released after " << _ms_since_startup()
+                                       << " ms (startup latency)" << std::endl;
+
+                    if (time::DiscreteEventClock::enabled() && zmq_main_.publish_ready() &&
+                        !discrete_event_reporting_)
+                    {
+                        discrete_event_reporting_ = true;
+                        // reports the current state
+                        _set_discrete_event_state_handler();
+                    }
+                }
+                else if (response->request() == protobuf::REPORT_DISCRETE_EVENT_STATE &&
+                         response->has_discrete_event_time())
+                {
+                    time::DiscreteEventClock::advance(time::DiscreteEventClock::time_point(
+                        std::chrono::microseconds(response->discrete_event_time())));
                 }
 
-                // we're good to go now, so let's unsubscribe to this group
-                if (zmq_main_.publish_ready())
+                // we're good to go now, so let's unsubscribe to this group (unless the Manager
+                // is advancing the discrete event time)
+                if (zmq_main_.publish_ready() && !time::DiscreteEventClock::enabled())
                 {
                     _unsubscribe<protobuf::ManagerResponse,
                                  middleware::MarshallingScheme::PROTOBUF>(
@@ -373,16 +469,29 @@ class InterProcessPortalImplementation
     void _publish(const Data& d, const goby::middleware::Group& group,
                   const middleware::Publisher<Data>& /*publisher*/, bool ignore_buffer = false)
     {
+        const bool metrics = middleware::TransportMetrics::enabled();
+        auto serialize_start = metrics ? middleware::TransportMetrics::Clock::now()
+                                       : middleware::TransportMetrics::Clock::time_point();
         std::vector<char> bytes(middleware::SerializerParserHelper<Data, scheme>::serialize(d));
         std::string type_name = middleware::SerializerParserHelper<Data, scheme>::type_name(d);
+        if (metrics)
+            middleware::TransportMetrics::serialized(
+                middleware::protobuf::LAYER_INTERPROCESS, group, type_name,
+                middleware::TransportMetrics::Clock::now() - serialize_start);
         _publish_serialized(type_name, scheme, bytes, group, ignore_buffer);
     }
 
     void _publish_serialized(std::string type_name, int scheme, const std::vector<char>& bytes,
                              const goby::middleware::Group& group, bool ignore_buffer = false)
     {
-        std::string identifier = _make_fully_qualified_identifier(type_name, scheme, group) + '\0';
+        std::string identifier = _make_fully_qualified_identifier(type_name, scheme, group);
+        if (trace_sample_rate_ > 0 && trace_distribution_(trace_generator_) < trace_sample_rate_)
+            identifier += make_trace(std::chrono::steady_clock::now());
+        identifier += '\0';
         zmq_main_.publish(identifier, &bytes[0], bytes.size(), ignore_buffer);
+        if (middleware::TransportMetrics::enabled())
+            middleware::TransportMetrics::published(middleware::protobuf::LAYER_INTERPROCESS,
+                                                    group, type_name, bytes.size());
     }
 
     template <typename Data, int scheme>
@@ -456,9 +565,14 @@ class InterProcessPortalImplementation
         // regex
         if (regex_subscriptions_.size() > 0)
         {
+            auto regex_range = regex_subscriptions_.equal_range(subscriber_id);
+            for (auto it = regex_range.first; it != regex_range.second; ++it)
+            {
+                auto filters_it = regex_subscription_filters_.find(it->second.get());
+                _release_regex_filters(filters_it->second.filters);
+                regex_subscription_filters_.erase(filters_it);
+            }
             regex_subscriptions_.erase(subscriber_id);
-            if (regex_subscriptions_.empty())
-                zmq_main_.unsubscribe("/");
         }
     }
 
@@ -476,6 +590,19 @@ class InterProcessPortalImplementation
         while (zmq_main_.recv(&new_control_msg, flags))
             zmq_main_.control_buffer().push_back(new_control_msg);
 
+        // regexes changed with update_type_regex() / update_group_regex()
+        for (auto& sub : regex_subscriptions_)
+        {
+            auto& filters = regex_subscription_filters_.at(sub.second.get());
+            if (filters.regex_version != sub.second->regex_version())
+            {
+                // subscribe to the new filters before releasing the old ones
+                auto old_filters = std::move(filters.filters);
+                _add_regex_filters(*sub.second);
+                _release_regex_filters(old_filters);
+            }
+        }
+
         while (!zmq_main_.control_buffer().empty())
         {
             const auto& control_msg = zmq_main_.control_buffer().front();
@@ -492,6 +619,30 @@ class InterProcessPortalImplementation
                     std::string group, type, thread;
                     int scheme, process;
                     std::tie(group, scheme, type, process, thread) = parse_identifier(data);
+                    if (middleware::TransportMetrics::enabled())
+                    {
+                        auto payload_size =
+                            data.size() - (std::find(data.begin(), data.end(), '\0') -
+                                           data.begin() + 1);
+                        middleware::TransportMetrics::received(
+                            middleware::protobuf::LAYER_INTERPROCESS, group, type, payload_size);
+                        middleware::TransportMetrics::queued(
+                            middleware::protobuf::LAYER_INTERPROCESS, group, type,
+                            zmq_main_.control_buffer().size());
+                    }
+
+                    std::chrono::steady_clock::time_point publish_time;
+                    if ((middleware::TransportMetrics::enabled() ||
+                         middleware::CallbackProfiler::enabled()) &&
+                        parse_trace(data, publish_time))
+                    {
+                        auto latency = std::chrono::steady_clock::now() - publish_time;
+                        if (middleware::TransportMetrics::enabled())
+                            middleware::TransportMetrics::latency(
+                                middleware::protobuf::LAYER_INTERPROCESS, group, type, latency);
+                        if (middleware::CallbackProfiler::enabled())
+                            middleware::CallbackProfiler::this_thread().dispatch(latency);
+                    }
                     std::string identifier = _make_identifier(
                         type, scheme, group, IdentifierWildcard::PROCESS_THREAD_WILDCARD);
 
@@ -509,10 +660,25 @@ class InterProcessPortalImplementation
                     {
                         const auto& data = control_msg.received_data();
                         auto null_delim_it = std::find(std::begin(data), std::end(data), '\0');
+                        const bool profile = middleware::CallbackProfiler::enabled();
                         for (auto& sub : subs_to_post)
                         {
                             if (auto sub_sp = sub.lock())
-                                sub_sp->post(null_delim_it + 1, data.end());
+                            {
+                                if (profile)
+                                {
+                                    // includes parsing
+                                    auto start = middleware::CallbackProfiler::Clock::now();
+                                    sub_sp->post(null_delim_it + 1, data.end());
+                                    middleware::CallbackProfiler::this_thread().handler(
+                                        group, type,
+                                        middleware::CallbackProfiler::Clock::now() - start);
+                                }
+                                else
+                                {
+                                    sub_sp->post(null_delim_it + 1, data.end());
+                                }
+                            }
                         }
                     }
 
@@ -539,22 +705,8 @@ class InterProcessPortalImplementation
                 break;
 
                 case protobuf::InprocControl::REQUEST_HOLD_STATE:
-                {
-                    protobuf::ManagerRequest req;
-
-                    req.set_ready(ready_);
-                    req.set_request(protobuf::PROVIDE_HOLD_STATE);
-                    req.set_client_name(cfg_.client_name());
-                    req.set_client_pid(getpid());
-
-                    goby::glog.is_debug3() && goby::glog << "Published ManagerRequest: "
-                                                         << req.ShortDebugString() << std::endl;
-
-                    _publish<protobuf::ManagerRequest, middleware::MarshallingScheme::PROTOBUF>(
-                        req, groups::manager_request,
-                        middleware::Publisher<protobuf::ManagerRequest>(), true);
-                }
-                break;
+                    _publish_hold_state_request();
+                    break;
 
                 default: break;
             }
@@ -563,6 +715,60 @@ class InterProcessPortalImplementation
         return items;
     }
 
+    void _publish_hold_state_request()
+    {
+        protobuf::ManagerRequest req;
+
+        req.set_ready(ready_);
+        req.set_request(protobuf::PROVIDE_HOLD_STATE);
+        req.set_client_name(cfg_.client_name());
+        req.set_client_pid(getpid());
+
+        goby::glog.is_debug3() && goby::glog << "Published ManagerRequest: "
+                                             << req.ShortDebugString() << std::endl;
+
+        _publish<protobuf::ManagerRequest, middleware::MarshallingScheme::PROTOBUF>(
+            req, groups::manager_request, middleware::Publisher<protobuf::ManagerRequest>(),
+            true);
+    }
+
+    long _ms_since_startup()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - startup_time_)
+            .count();
+    }
+
+    void _set_discrete_event_state_handler()
+    {
+        time::DiscreteEventClock::set_state_handler(
+            [this](const time::DiscreteEventClock::State& state) {
+                if (discrete_event_reporting_)
+                    _publish_discrete_event_state(state);
+            });
+    }
+
+    void _publish_discrete_event_state(const time::DiscreteEventClock::State& state,
+                                       bool participating = true)
+    {
+        protobuf::ManagerRequest req;
+        req.set_request(protobuf::REPORT_DISCRETE_EVENT_STATE);
+        req.set_client_name(cfg_.client_name());
+        req.set_client_pid(getpid());
+
+        auto& discrete_event = *req.mutable_discrete_event();
+        discrete_event.set_sequence(state.sequence);
+        discrete_event.set_idle(state.idle);
+        if (state.next_deadline != time::DiscreteEventClock::time_point::max())
+            discrete_event.set_next_deadline(
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    state.next_deadline.time_since_epoch())
+                    .count());
+        discrete_event.set_participating(participating);
+
+        zmq_main_.publish_discrete_event_state(discrete_event_identifier_, req);
+    }
+
     void _receive_publication_forwarded(
         const goby::middleware::protobuf::SerializerTransporterMessage& msg)
     {
@@ -658,12 +864,37 @@ class InterProcessPortalImplementation
     void _subscribe_regex(
         const std::shared_ptr<const middleware::SerializationSubscriptionRegex>& new_sub)
     {
-        if (regex_subscriptions_.empty())
-            zmq_main_.subscribe("/");
-
+        _add_regex_filters(*new_sub);
         regex_subscriptions_.insert(std::make_pair(new_sub->subscriber_id(), new_sub));
     }
 
+    void _add_regex_filters(const middleware::SerializationSubscriptionRegex& sub)
+    {
+        auto& filters = regex_subscription_filters_[&sub];
+        filters.regex_version = sub.regex_version();
+        filters.filters =
+            regex_subscription_filters(sub.schemes(), sub.type_regex(), sub.group_regex());
+
+        for (const auto& filter : filters.filters)
+        {
+            if (regex_filters_[filter]++ == 0)
+                zmq_main_.subscribe(filter);
+        }
+    }
+
+    void _release_regex_filters(const std::vector<std::string>& filters)
+    {
+        for (const auto& filter : filters)
+        {
+            auto it = regex_filters_.find(filter);
+            if (--it->second == 0)
+            {
+                zmq_main_.unsubscribe(filter);
+                regex_filters_.erase(it);
+            }
+        }
+    }
+
     template <typename Data, int scheme>
     std::string _make_identifier(const goby::middleware::Group& group, IdentifierWildcard wildcard)
     {
@@ -712,6 +943,11 @@ class InterProcessPortalImplementation
   private:
     const protobuf::InterProcessPortalConfig cfg_;
 
+    // publication tracing
+    const double trace_sample_rate_{cfg_.trace_sample_rate()};
+    std::minstd_rand trace_generator_{std::random_device()()};
+    std::uniform_real_distribution<double> trace_distribution_{0, 1};
+
     std::unique_ptr<std::thread> zmq_thread_;
     std::atomic<bool> zmq_alive_{true};
     zmq::context_t zmq_context_;
@@ -733,11 +969,27 @@ class InterProcessPortalImplementation
     std::unordered_multimap<std::string,
                             std::shared_ptr<const middleware::SerializationSubscriptionRegex>>
         regex_subscriptions_;
+
+    struct RegexFilters
+    {
+        int regex_version{0};
+        std::vector<std::string> filters;
+    };
+    // ZeroMQ filters subscribed for each regex subscription
+    std::unordered_map<const middleware::SerializationSubscriptionRegex*, RegexFilters>
+        regex_subscription_filters_;
+    // filter -> number of regex subscriptions using it
+    std::unordered_map<std::string, int> regex_filters_;
+
     std::string process_{std::to_string(getpid())};
     std::unordered_map<int, std::string> schemes_;
     std::unordered_map<std::thread::id, std::string> threads_;
 
     bool ready_{false};
+    std::chrono::steady_clock::time_point startup_time_;
+
+    std::string discrete_event_identifier_;
+    std::atomic<bool> discrete_event_reporting_{false};
 };
 
 class Router
@@ -784,9 +1036,50 @@ class Manager
 
     bool hold_state();
 
+  private:
+    void publish_response(const protobuf::ManagerResponse& pb_response);
+
+    // push the release of the hold (and the startup latency of each client) to all the clients
+    void check_hold_state();
+
+    // coordination of discrete event simulation time across the clients
+    void handle_discrete_event_report(const protobuf::ManagerRequest& pb_request);
+    void check_discrete_event();
+    void advance_discrete_event();
+
   private:
     std::set<std::string> reported_clients_;
     std::set<std::string> required_clients_;
+    bool hold_{true};
+
+    // startup latency of each client, relative to its request for the pub/sub sockets
+    struct ClientStartup
+    {
+        std::string client_name;
+        int client_pid{0};
+        std::chrono::steady_clock::time_point sockets_requested;
+        std::chrono::steady_clock::time_point hold_state_requested;
+        std::chrono::steady_clock::time_point ready;
+    };
+    // key is client name and pid; entries are removed once reported (or the client disconnects)
+    std::map<std::string, ClientStartup> client_startup_;
+    void add_startup_latency(protobuf::ManagerResponse* pb_response, const ClientStartup& startup,
+                             std::chrono::steady_clock::time_point released);
+
+    struct DiscreteEventClient
+    {
+        std::uint64_t sequence{0};
+        bool idle{false};
+        goby::time::SystemClock::time_point next_deadline{
+            goby::time::SystemClock::time_point::max()};
+    };
+    // key is client name and pid
+    std::map<std::string, DiscreteEventClient> discrete_event_clients_;
+    goby::time::SystemClock::time_point discrete_event_time_{
+        goby::time::SystemClock::time_point::min()};
+    // real time to advance the simulation time at, if all the clients are still idle
+    std::chrono::steady_clock::time_point discrete_event_advance_time_{
+        std::chrono::steady_clock::time_point::max()};
 
     zmq::context_t& context_;
     const protobuf::InterProcessPortalConfig& cfg_;